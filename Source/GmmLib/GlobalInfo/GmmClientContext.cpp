@@ -23,6 +23,13 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "Internal/Common/GmmLibInc.h"
 #include "External/Common/GmmClientContext.h"
 
+#ifndef __GMM_KMD__
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+#endif
+
 #if !__GMM_KMD__ && LHDM
 #include "..\..\inc\common\gfxEscape.h"
 #include "..\..\..\miniport\LHDM\inc\gmmEscape.h"
@@ -42,7 +49,11 @@ GmmLib::GmmClientContext::GmmClientContext(GMM_CLIENT ClientType, Context *pLibC
       pClientContextAilFlags(),
       pGmmUmdContext(),
       DeviceCB(),
-      IsDeviceCbReceived(0)
+      IsDeviceCbReceived(0),
+      pResInfoPool(),
+      pSharedResInfo(),
+      LayoutCacheEnabled(0),
+      pResInfoBatches()
 {
     this->ClientType     = ClientType;
     this->pGmmLibContext = pLibContext;
@@ -55,13 +66,64 @@ GmmLib::GmmClientContext::GmmClientContext(GMM_CLIENT ClientType, Context *pLibC
     {
         pClientContextAilFlags = NULL;
     }
+
+#ifndef __GMM_KMD__
+    pResInfoBatches = new GmmResInfoBatchSet(); // NULL just fails CreateResInfoObjects().
+#endif
 }
+#ifndef __GMM_KMD__
+/////////////////////////////////////////////////////////////////////////////////////
+/// Destructs a pooled ResInfo Object in place, for GmmResInfoPool.
+///
+/// @param[in] pObject: Pooled GMM_RESOURCE_INFO
+/////////////////////////////////////////////////////////////////////////////////////
+static void GmmDestroyPooledResInfo(void *pObject)
+{
+    GMM_RESOURCE_INFO *pResInfo = static_cast<GMM_RESOURCE_INFO *>(pObject);
+
+#ifdef _WIN32
+    pResInfo->~GmmResourceInfoWin();
+#else
+    pResInfo->~GmmResourceInfoLin();
+#endif
+}
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////
 /// Destructor to free  GmmLib::GmmClientContext object memory
 /////////////////////////////////////////////////////////////////////////////////////
 GmmLib::GmmClientContext::~GmmClientContext()
 {
     pGmmLibContext = NULL;
+
+#ifndef __GMM_KMD__
+    // Shared objects still in the table are still referenced, so aren't freed
+    // here: like other leaked objects, heap ones stay leaked and pooled ones go
+    // with the pool below.
+    if(pSharedResInfo)
+    {
+        GMM_ASSERTDPF(pSharedResInfo->GetNumShared() == 0, "Shared ResInfo objects leaked!");
+
+        delete pSharedResInfo;
+        pSharedResInfo = NULL;
+    }
+
+    if(pResInfoBatches)
+    {
+        delete pResInfoBatches;
+        pResInfoBatches = NULL;
+    }
+
+    // Bulk release of pooled ResInfo objects, including any the client leaked
+    // (destroyed first, as they may own GMM-allocated system memory).
+    if(pResInfoPool)
+    {
+        pResInfoPool->DestroyAllocated(GmmDestroyPooledResInfo);
+        delete pResInfoPool;
+        pResInfoPool = NULL;
+    }
+#endif
+
     if (pClientContextAilFlags)
     {
         free(pClientContextAilFlags);
@@ -291,6 +353,104 @@ const SWIZZLE_DESCRIPTOR *GMM_STDCALL GmmLib::GmmClientContext::GetSwizzleDesc(E
     return pSwizzleDesc;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class to return the CPU swizzling BLT
+/// function specialized for the swizzle GetSwizzleDesc() would return.
+/// Returned function has the same signature and behavior as CpuSwizzleBlt,
+/// which is returned when no specialized kernel exists for the swizzle.
+///
+/// @param[in] EXTERNAL_SWIZZLE_NAME
+/// @param[in] EXTERNAL_RES_TYPE
+/// @param[in] bpe
+/// @param[in] Upload: true for linear-to-swizzled, false for swizzled-to-linear
+/// @return  CPU_SWIZZLE_BLT_KERNEL
+/////////////////////////////////////////////////////////////////////////////////////
+CPU_SWIZZLE_BLT_KERNEL GMM_STDCALL GmmLib::GmmClientContext::GetSwizzleBltKernel(EXTERNAL_SWIZZLE_NAME ExternalSwizzleName, EXTERNAL_RES_TYPE ResType, uint8_t bpe, bool Upload, bool isStdSwizzle)
+{
+    return CpuSwizzleBltKernel(GetSwizzleDesc(ExternalSwizzleName, ResType, bpe, isStdSwizzle), Upload);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class to convert an array of surface
+/// positions to swizzled offsets--i.e. SwizzleOffset() for each position.
+///
+/// @param[in]  pSwizzle: Swizzle descriptor (e.g. from GetSwizzleDesc())
+/// @param[in]  Pitch: Surface row pitch, in bytes
+/// @param[in]  Count: Number of positions
+/// @param[in]  pOffsetX: Horizontal offsets, in bytes
+/// @param[in]  pOffsetY: Vertical offsets, in rows
+/// @param[in]  pOffsetZ: 3D slice/MSAA sample within tile depth, or NULL if N/A
+/// @param[out] pSwizzledOffset: Receives Count swizzled offsets
+/////////////////////////////////////////////////////////////////////////////////////
+void GMM_STDCALL GmmLib::GmmClientContext::SwizzleOffsetBatch(const SWIZZLE_DESCRIPTOR *pSwizzle, int Pitch, int Count, const int *pOffsetX, const int *pOffsetY, const int *pOffsetZ, int *pSwizzledOffset)
+{
+    ::SwizzleOffsetBatch(pSwizzle, Pitch, Count, pOffsetX, pOffsetY, pOffsetZ, pSwizzledOffset);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class to convert an array of swizzled
+/// offsets back to surface positions. Inverse of SwizzleOffsetBatch().
+///
+/// @param[in]  pSwizzle: Swizzle descriptor (e.g. from GetSwizzleDesc())
+/// @param[in]  Pitch: Surface row pitch, in bytes
+/// @param[in]  Count: Number of offsets
+/// @param[in]  pSwizzledOffset: Swizzled offsets
+/// @param[out] pOffsetX: Receives horizontal offsets, in bytes
+/// @param[out] pOffsetY: Receives vertical offsets, in rows
+/// @param[out] pOffsetZ: Receives 3D slice/MSAA sample within tile depth, or NULL if N/A
+/////////////////////////////////////////////////////////////////////////////////////
+void GMM_STDCALL GmmLib::GmmClientContext::SwizzleOffsetInverseBatch(const SWIZZLE_DESCRIPTOR *pSwizzle, int Pitch, int Count, const int *pSwizzledOffset, int *pOffsetX, int *pOffsetY, int *pOffsetZ)
+{
+    ::SwizzleOffsetInverseBatch(pSwizzle, Pitch, Count, pSwizzledOffset, pOffsetX, pOffsetY, pOffsetZ);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for returning the counters of the lib
+/// context's resource layout cache (shared by all clients of the context), and
+/// whether this client has opted in to it.
+///
+/// @param[out] pStats: Receives the counters--all zero if there's no cache
+/////////////////////////////////////////////////////////////////////////////////////
+void GMM_STDCALL GmmLib::GmmClientContext::GetLayoutCacheStats(GMM_LAYOUT_CACHE_STATS *pStats)
+{
+    __GMM_ASSERTPTR(pStats, VOIDRETURN);
+
+    memset(pStats, 0, sizeof(*pStats));
+    if(pGmmLibContext->GetLayoutCache())
+    {
+        pGmmLibContext->GetLayoutCache()->GetStats(pStats);
+        pStats->Enabled = LayoutCacheEnabled;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for opting this client's creates in
+/// to (or back out of) the lib context's resource layout cache. Off by default;
+/// while off every create computes its layout from scratch. Other clients of
+/// the lib context are unaffected. Intended to be called right after client
+/// context creation. Not thread-safe against concurrent ResInfo creation.
+///
+/// @param[in]  Enable: true to enable, false to disable
+/////////////////////////////////////////////////////////////////////////////////////
+void GMM_STDCALL GmmLib::GmmClientContext::SetLayoutCacheEnable(uint8_t Enable)
+{
+    LayoutCacheEnabled = Enable ? 1 : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for dropping all layouts held by the
+/// lib context's resource layout cache. Needed only if context state has been
+/// modified other than through the context's setters, which invalidate the
+/// cache themselves.
+/////////////////////////////////////////////////////////////////////////////////////
+void GMM_STDCALL GmmLib::GmmClientContext::FlushLayoutCache()
+{
+    if(pGmmLibContext->GetLayoutCache())
+    {
+        pGmmLibContext->GetLayoutCache()->Flush();
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////////////////
 /// Member function of ClientContext class for returning Max MOCS index used
 /// on a platform
@@ -540,7 +700,7 @@ GMM_RESOURCE_INFO *GMM_STDCALL GmmLib::GmmClientContext::CreateCustomResInfoObje
 
     pClientContextIn = this;
 
-    if((pRes = new GMM_RESOURCE_INFO(pClientContextIn)) == NULL)
+    if((pRes = AllocResInfoObject(pClientContextIn)) == NULL)
     {
         GMM_ASSERTDPF(0, "Allocation failed!");
         goto ERROR_CASE;
@@ -577,7 +737,7 @@ GMM_RESOURCE_INFO *GMM_STDCALL GmmLib::GmmClientContext::CreateCustomResInfoObje
 
     pClientContextIn = this;
 
-    if((pRes = new GMM_RESOURCE_INFO(pClientContextIn)) == NULL)
+    if((pRes = AllocResInfoObject(pClientContextIn)) == NULL)
     {
         GMM_ASSERTDPF(0, "Allocation failed!");
         goto ERROR_CASE;
@@ -611,6 +771,10 @@ GMM_RESOURCE_INFO *GMM_STDCALL GmmLib::GmmClientContext::CreateResInfoObject(GMM
 {
     GMM_RESOURCE_INFO *pRes             = NULL;
     GmmClientContext * pClientContextIn = NULL;
+#ifndef __GMM_KMD__
+    GmmLayoutCache::KEY SharedKey;
+    uint8_t             Shared = 0;
+#endif
 
 #if(!defined(GMM_UNIFIED_LIB))
     pClientContextIn = pGmmLibContext->pGmmGlobalClientContext;
@@ -620,6 +784,23 @@ GMM_RESOURCE_INFO *GMM_STDCALL GmmLib::GmmClientContext::CreateResInfoObject(GMM
 
     GMM_DPF_ENTER;
 
+#ifndef __GMM_KMD__
+    // Identical creates resolve to one shared object.
+    if(pSharedResInfo &&
+       !pCreateParams->pPreallocatedResInfo &&
+       GmmLayoutCache::IsCacheable(*pCreateParams))
+    {
+        Shared = 1;
+        GmmLayoutCache::MakeKey(pGmmLibContext, pClientContextIn, pClientContextIn->GetClientType(), *pCreateParams, SharedKey);
+
+        if((pRes = pSharedResInfo->Acquire(SharedKey, *pCreateParams)) != NULL)
+        {
+            GMM_DPF_EXIT;
+            return (pRes);
+        }
+    }
+#endif
+
     // GMM_RESOURCE_INFO...
     if(pCreateParams->pPreallocatedResInfo)
     {
@@ -629,7 +810,7 @@ GMM_RESOURCE_INFO *GMM_STDCALL GmmLib::GmmClientContext::CreateResInfoObject(GMM
     }
     else
     {
-        if((pRes = new GMM_RESOURCE_INFO(pClientContextIn)) == NULL)
+        if((pRes = AllocResInfoObject(pClientContextIn)) == NULL)
         {
             GMM_ASSERTDPF(0, "Allocation failed!");
             goto ERROR_CASE;
@@ -641,6 +822,19 @@ GMM_RESOURCE_INFO *GMM_STDCALL GmmLib::GmmClientContext::CreateResInfoObject(GMM
         goto ERROR_CASE;
     }
 
+#ifndef __GMM_KMD__
+    if(Shared)
+    {
+        GMM_RESOURCE_INFO *pSharedRes = pSharedResInfo->Publish(SharedKey, *pCreateParams, pRes);
+
+        if(pSharedRes != pRes) // Racing create published first.
+        {
+            FreeResInfoObject(pRes);
+            pRes = pSharedRes;
+        }
+    }
+#endif
+
     GMM_DPF_EXIT;
 
     return (pRes);
@@ -654,6 +848,255 @@ ERROR_CASE:
     return (NULL);
 }
 
+#ifndef __GMM_KMD__
+typedef struct GMM_CREATE_RES_INFO_BATCH_REC
+{
+    GmmLib::Context         *pGmmLibContext;
+    GMM_RESCREATE_PARAMS    *pCreateParams;
+    GMM_RESOURCE_INFO       **ppRes;
+    const uint32_t          *pUnique;       // Indices of first occurrences of distinct descriptors.
+    uint32_t                NumUnique;
+    uint32_t                PerTask;        // Descriptors per task.
+    std::atomic<uint8_t>    Failed;
+} GMM_CREATE_RES_INFO_BATCH;
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Task of CreateResInfoObjects: computes the layouts of one run of its distinct
+/// descriptors.
+///
+/// @param[in]  pTaskContext: GMM_CREATE_RES_INFO_BATCH
+/// @param[in]  TaskIndex: Selects run of pUnique
+/////////////////////////////////////////////////////////////////////////////////////
+static void GMM_STDCALL GmmCreateResInfoBatchTask(void *pTaskContext, uint32_t TaskIndex)
+{
+    GMM_CREATE_RES_INFO_BATCH *pBatch = static_cast<GMM_CREATE_RES_INFO_BATCH *>(pTaskContext);
+    uint32_t                   First  = TaskIndex * pBatch->PerTask;
+    uint32_t                   Last   = GFX_MIN(First + pBatch->PerTask, pBatch->NumUnique);
+
+    for(uint32_t u = First; u < Last && !pBatch->Failed.load(std::memory_order_relaxed); u++)
+    {
+        uint32_t i = pBatch->pUnique[u];
+
+        if(pBatch->ppRes[i]->Create(*pBatch->pGmmLibContext, pBatch->pCreateParams[i]) != GMM_SUCCESS)
+        {
+            pBatch->Failed.store(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for bulk creation of ResourceInfo
+/// Objects, e.g. when loading a scene's textures. Equivalent to calling
+/// CreateResInfoObject() on each descriptor, but...
+///     - Objects are allocated in one contiguous block.
+///     - Identical descriptors have their layout computed once.
+///     - With pParallel, distinct descriptors' layouts are computed across
+///       threads (see GMM_TASK_PARALLEL).
+/// Creation is all-or-nothing. Objects must be freed by DestroyResInfoObjects()
+/// (DestroyResInfoObject() on one just resets it, as with pPreallocatedResInfo).
+/// The client context tracks batch blocks itself--objects' resource flags are
+/// as CreateResInfoObject() would leave them.
+/// @see        GmmLib::GmmResourceInfoCommon::Create()
+///
+/// @param[in/out] pCreateParams: Array of descriptors (normalized on return, as by
+///                CreateResInfoObject()); pPreallocatedResInfo must be NULL
+/// @param[in]  Count: Number of descriptors
+/// @param[out] ppRes: Receives Count objects, in descriptor order--or NULLs on failure
+/// @param[in]  pParallel: Threading controls, or NULL to compute on calling thread
+/// @return     GMM_SUCCESS, or the failure status
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_STATUS GMM_STDCALL GmmLib::GmmClientContext::CreateResInfoObjects(GMM_RESCREATE_PARAMS *pCreateParams, uint32_t Count, GMM_RESOURCE_INFO **ppRes, const GMM_TASK_PARALLEL *pParallel)
+{
+    GMM_RESOURCE_INFO *                    pBlock           = NULL;
+    GmmClientContext *                     pClientContextIn = NULL;
+    GMM_CREATE_RES_INFO_BATCH              Batch;
+    std::vector<uint32_t>                  Unique, Source;
+    std::vector<GmmLayoutCache::KEY>       Keys;
+    std::unordered_multimap<uint64_t, uint32_t> Seen;
+    uint32_t                               MaxThreads = 1, NumTasks;
+
+    __GMM_ASSERTPTR(pCreateParams, GMM_INVALIDPARAM);
+    __GMM_ASSERTPTR(ppRes, GMM_INVALIDPARAM);
+    __GMM_ASSERT(Count <= SIZE_MAX / sizeof(GMM_RESOURCE_INFO));
+
+#if(!defined(GMM_UNIFIED_LIB))
+    pClientContextIn = pGmmLibContext->pGmmGlobalClientContext;
+#else
+    pClientContextIn = this;
+#endif
+
+    GMM_DPF_ENTER;
+
+    memset(ppRes, 0, Count * sizeof(*ppRes));
+    if(!Count)
+    {
+        return GMM_SUCCESS;
+    }
+
+    for(uint32_t i = 0; i < Count; i++)
+    {
+        if(pCreateParams[i].pPreallocatedResInfo)
+        {
+            GMM_ASSERTDPF(0, "pPreallocatedResInfo not supported by batch creation!");
+            return GMM_INVALIDPARAM;
+        }
+    }
+
+    if((pBlock = static_cast<GMM_RESOURCE_INFO *>(GMM_MALLOC(Count * sizeof(GMM_RESOURCE_INFO)))) == NULL)
+    {
+        GMM_ASSERTDPF(0, "Allocation failed!");
+        return GMM_OUT_OF_MEMORY;
+    }
+
+    // Registered up front, so a failed batch's DestroyResInfoObjects() finds it.
+    if(!pResInfoBatches || !pResInfoBatches->Add(pBlock, Count * sizeof(GMM_RESOURCE_INFO)))
+    {
+        GMM_FREE(pBlock);
+        GMM_ASSERTDPF(0, "Allocation failed!");
+        return GMM_OUT_OF_MEMORY;
+    }
+
+    try
+    {
+        Unique.reserve(Count);
+        Source.resize(Count);
+        Keys.resize(Count);
+        Seen.reserve(Count);
+
+        // Dedupe descriptors by layout cache key (which ignores struct padding)--
+        // done up front, since Create normalizes them. Those with existing sys
+        // mem own per-object state, so are never shared.
+        for(uint32_t i = 0; i < Count; i++)
+        {
+            Source[i] = i;
+
+            if(!pCreateParams[i].Flags.Info.ExistingSysMem)
+            {
+                GmmLayoutCache::MakeKey(pGmmLibContext, pClientContextIn, pClientContextIn->GetClientType(), pCreateParams[i], Keys[i]);
+
+                uint64_t Hash  = GmmLayoutCache::HashKey(Keys[i]);
+                auto     Range = Seen.equal_range(Hash);
+                for(auto It = Range.first; It != Range.second; ++It)
+                {
+                    if(!memcmp(&Keys[It->second], &Keys[i], sizeof(GmmLayoutCache::KEY)))
+                    {
+                        Source[i] = It->second;
+                        break;
+                    }
+                }
+
+                if(Source[i] == i)
+                {
+                    Seen.emplace(Hash, i);
+                }
+            }
+
+            if(Source[i] == i)
+            {
+                Unique.push_back(i);
+            }
+        }
+    }
+    catch(...)
+    {
+        pResInfoBatches->Remove(pBlock);
+        GMM_FREE(pBlock);
+        GMM_ASSERTDPF(0, "Allocation failed!");
+        return GMM_OUT_OF_MEMORY;
+    }
+
+    for(uint32_t i = 0; i < Count; i++)
+    {
+        ppRes[i] = new(&pBlock[i]) GmmLib::GmmResourceInfo(pClientContextIn);
+    }
+
+    Batch.pGmmLibContext = pGmmLibContext;
+    Batch.pCreateParams  = pCreateParams;
+    Batch.ppRes          = ppRes;
+    Batch.pUnique        = Unique.data();
+    Batch.NumUnique      = static_cast<uint32_t>(Unique.size());
+    Batch.PerTask        = Batch.NumUnique;
+    Batch.Failed.store(0, std::memory_order_relaxed);
+
+    if(pParallel)
+    {
+        MaxThreads    = GmmTaskMaxThreads(pParallel);
+        Batch.PerTask = GFX_MAX(Batch.NumUnique / (MaxThreads * 4), 16u); // Amortize task overhead over ~us Create's.
+    }
+
+    NumTasks = (Batch.NumUnique + Batch.PerTask - 1) / Batch.PerTask;
+
+    if((MaxThreads > 1) && (NumTasks > 1))
+    {
+        GmmRunTasks(pParallel, MaxThreads, NumTasks, GmmCreateResInfoBatchTask, &Batch);
+    }
+    else
+    {
+        for(uint32_t Task = 0; Task < NumTasks; Task++)
+        {
+            GmmCreateResInfoBatchTask(&Batch, Task);
+        }
+    }
+
+    if(Batch.Failed.load(std::memory_order_relaxed))
+    {
+        DestroyResInfoObjects(ppRes, Count);
+        GMM_DPF_EXIT;
+        return GMM_ERROR;
+    }
+
+    for(uint32_t i = 0; i < Count; i++)
+    {
+        if(Source[i] != i)
+        {
+            *ppRes[i]        = *ppRes[Source[i]];
+            pCreateParams[i] = pCreateParams[Source[i]];
+        }
+    }
+
+    GMM_DPF_EXIT;
+    return GMM_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for destroying ResourceInfo Objects
+/// created by CreateResInfoObjects().
+///
+/// @param[in]  ppRes: Objects, as returned by CreateResInfoObjects()
+/// @param[in]  Count: Number of objects, as passed to CreateResInfoObjects()
+/////////////////////////////////////////////////////////////////////////////////////
+void GMM_STDCALL GmmLib::GmmClientContext::DestroyResInfoObjects(GMM_RESOURCE_INFO **ppRes, uint32_t Count)
+{
+    __GMM_ASSERTPTR(ppRes, VOIDRETURN);
+
+    if(!Count || !ppRes[0])
+    {
+        return;
+    }
+
+    GMM_RESOURCE_INFO *pBlock = ppRes[0];
+
+    if(!pResInfoBatches || !pResInfoBatches->Remove(pBlock))
+    {
+        GMM_ASSERTDPF(0, "Not a CreateResInfoObjects() batch!");
+        return;
+    }
+
+    for(uint32_t i = 0; i < Count; i++)
+    {
+        __GMM_ASSERT(ppRes[i] == &pBlock[i]);
+#ifdef _WIN32
+        ppRes[i]->~GmmResourceInfoWin();
+#else
+        ppRes[i]->~GmmResourceInfoLin();
+#endif
+        ppRes[i] = NULL;
+    }
+
+    GMM_FREE(pBlock);
+}
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////
 /// Member function of ClientContext class for creation of ResourceInfo Object from
 /// already created Src ResInfo object
@@ -675,7 +1118,7 @@ GMM_RESOURCE_INFO *GMM_STDCALL GmmLib::GmmClientContext::CopyResInfoObject(GMM_R
 
     __GMM_ASSERTPTR(pSrcRes, NULL);
 
-    pResCopy = new GMM_RESOURCE_INFO(pClientContextIn);
+    pResCopy = AllocResInfoObject(pClientContextIn);
     if(!pResCopy)
     {
         GMM_ASSERTDPF(0, "Allocation failed.");
@@ -737,17 +1180,628 @@ void GMM_STDCALL GmmLib::GmmClientContext::DestroyResInfoObject(GMM_RESOURCE_INF
 {
     __GMM_ASSERTPTR(pResInfo, VOIDRETURN);
 
-    if(pResInfo->GetResFlags().Info.__PreallocatedResInfo)
+#ifndef __GMM_KMD__
+    uint8_t Last;
+
+    if(pSharedResInfo && pSharedResInfo->Release(pResInfo, &Last))
+    {
+        if(Last)
+        {
+            FreeResInfoObject(pResInfo);
+        }
+        return;
+    }
+#endif
+
+    if(pResInfo->GetResFlags().Info.__PreallocatedResInfo
+#ifndef __GMM_KMD__
+       || (pResInfoBatches && pResInfoBatches->Contains(pResInfo)) // Freed with its block.
+#endif
+       )
     {
         *pResInfo = GmmLib::GmmResourceInfo();
     }
     else
     {
-        delete pResInfo;
+        FreeResInfoObject(pResInfo);
         pResInfo = NULL;
     }
 }
 
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for allocating a ResInfo Object--from
+/// the ResInfo pool if enabled and not exhausted, else from the heap.
+///
+/// @param[in] pClientContextIn: Client context to construct object with
+/// @return     Pointer to constructed GmmResourceInfo, or NULL
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_RESOURCE_INFO *GmmLib::GmmClientContext::AllocResInfoObject(GmmClientContext *pClientContextIn)
+{
+#ifndef __GMM_KMD__
+    void *pMem;
+
+    if(pResInfoPool && ((pMem = pResInfoPool->Allocate()) != NULL))
+    {
+        return new(pMem) GMM_RESOURCE_INFO(pClientContextIn);
+    }
+#endif
+
+    return new GMM_RESOURCE_INFO(pClientContextIn);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for freeing a ResInfo Object from
+/// AllocResInfoObject()--of this or any other client context, pooled objects
+/// going back to the pool they came from.
+///
+/// @param[in] pResInfo: Pointer to ResInfoObject
+/////////////////////////////////////////////////////////////////////////////////////
+void GmmLib::GmmClientContext::FreeResInfoObject(GMM_RESOURCE_INFO *pResInfo)
+{
+#ifndef __GMM_KMD__
+    GmmResInfoPool *pOwner = (pResInfoPool && pResInfoPool->Owns(pResInfo)) ? pResInfoPool : GmmResInfoPool::FindOwner(pResInfo);
+
+    if(pOwner)
+    {
+        GmmDestroyPooledResInfo(pResInfo);
+        pOwner->Free(pResInfo);
+        return;
+    }
+#endif
+
+    delete pResInfo;
+}
+
+#ifndef __GMM_KMD__
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for opting in to pooled allocation of
+/// ResInfo Objects: CreateResInfoObject(), CopyResInfoObject() etc. then carve
+/// objects from slabs owned by this client context, recycling destroyed ones,
+/// and destroying the client context releases all slabs at once. Intended to
+/// be called right after client context creation; objects allocated before are
+/// unaffected. Not thread-safe against concurrent ResInfo creation.
+///
+/// @return     GMM_SUCCESS, or GMM_OUT_OF_MEMORY
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_STATUS GMM_STDCALL GmmLib::GmmClientContext::EnableResInfoPool()
+{
+    if(!pResInfoPool)
+    {
+        pResInfoPool = new GmmResInfoPool(sizeof(GMM_RESOURCE_INFO));
+    }
+
+    return pResInfoPool ? GMM_SUCCESS : GMM_OUT_OF_MEMORY;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for opting in to shared layouts:
+/// CreateResInfoObject() calls with identical params then return one shared
+/// ResInfo Object, and each DestroyResInfoObject() drops a reference, the last
+/// one freeing the object. Resources with client or GMM allocated system memory,
+/// or created into preallocated memory, aren't shared. CopyResInfoObject() and
+/// ResMemcpy() still make private copies, which clients may modify.
+///
+/// Shared objects are immutable: their Override*/Set* mutators (e.g.
+/// SetPrivateData) assert and do nothing, rather than leak into other resources'
+/// layouts. Clients must not write through GetResFlags() either. Objects still
+/// referenced at client context destruction are leaked, not freed.
+/// Intended to be called right after client context creation. Not thread-safe
+/// against concurrent ResInfo creation.
+///
+/// @return     GMM_SUCCESS, or GMM_OUT_OF_MEMORY
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_STATUS GMM_STDCALL GmmLib::GmmClientContext::EnableSharedLayouts()
+{
+    if(!pSharedResInfo)
+    {
+        pSharedResInfo = new GmmSharedResInfo();
+    }
+
+    return pSharedResInfo ? GMM_SUCCESS : GMM_OUT_OF_MEMORY;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for checking whether a ResInfo Object
+/// is shared via EnableSharedLayouts(), and so immutable.
+///
+/// @param[in] pResInfo: Pointer to ResInfoObject
+/// @return     1 if shared, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmClientContext::IsSharedResInfo(const GMM_RESOURCE_INFO *pResInfo)
+{
+    return pSharedResInfo ? pSharedResInfo->Contains(pResInfo) : 0;
+}
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns whether a tile mode is worth trying for a create--i.e. exists on the
+/// platform and isn't ruled out by the resource type, MSAA or usage.
+/////////////////////////////////////////////////////////////////////////////////////
+static uint8_t GmmTileAdviceApplies(GmmLib::Context *pGmmLibContext, const GMM_RESCREATE_PARAMS &Params, GMM_TILE_ADVICE_MODE Mode)
+{
+    uint8_t  TileY        = pGmmLibContext->GetSkuTable().FtrTileY;
+    uint32_t BitsPerPixel = pGmmLibContext->GetPlatformInfo().FormatTable[Params.Format].Element.BitsPer;
+    uint8_t  LinearOnly   = (Params.Type == RESOURCE_BUFFER) || (Params.Type == RESOURCE_1D) || (Params.Type == RESOURCE_SCRATCH);
+    uint8_t  NeedsYMajor  = (Params.MSAA.NumSamples > 1) || Params.Flags.Gpu.Depth || Params.Flags.Gpu.SeparateStencil || Params.Flags.Gpu.HiZ;
+    uint8_t  Needs64KB    = Params.Flags.Gpu.TiledResource || Params.Flags.Info.StdSwizzle;
+
+    switch(Mode)
+    {
+        case GMM_TILE_ADVICE_LINEAR:
+            return !NeedsYMajor && !Needs64KB;
+        case GMM_TILE_ADVICE_TILEX:
+            return !LinearOnly && !NeedsYMajor && !Needs64KB;
+        case GMM_TILE_ADVICE_TILEY:
+            return TileY && !LinearOnly && !Needs64KB;
+        case GMM_TILE_ADVICE_TILEYS:
+            return TileY && !LinearOnly && GMM_IS_SUPPORTED_BPP_ON_TILE_64_YF_YS(BitsPerPixel) &&
+                   (GFX_GET_CURRENT_RENDERCORE(pGmmLibContext->GetPlatformInfo().Platform) >= IGFX_GEN9_CORE);
+        case GMM_TILE_ADVICE_TILE4:
+            return !TileY && !LinearOnly && !Needs64KB && (Params.MSAA.NumSamples <= 1);
+        case GMM_TILE_ADVICE_TILE64:
+            return !TileY && !LinearOnly && GMM_IS_SUPPORTED_BPP_ON_TILE_64_YF_YS(BitsPerPixel);
+        default:
+            return 0;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the candidate mode a created resource ended up in.
+/////////////////////////////////////////////////////////////////////////////////////
+static GMM_TILE_ADVICE_MODE GmmTileAdviceMode(GMM_RESOURCE_INFO &Res)
+{
+    switch(Res.GetTileType())
+    {
+        case GMM_NOT_TILED:
+            return GMM_TILE_ADVICE_LINEAR;
+        case GMM_TILED_X:
+            return GMM_TILE_ADVICE_TILEX;
+        case GMM_TILED_Y:
+            return Res.GetResFlags().Info.TiledYs ? GMM_TILE_ADVICE_TILEYS :
+                   Res.GetResFlags().Info.TiledYf ? GMM_TILE_ADVICE_MODES :
+                                                    GMM_TILE_ADVICE_TILEY;
+        case GMM_TILED_4:
+            return GMM_TILE_ADVICE_TILE4;
+        case GMM_TILED_64:
+            return GMM_TILE_ADVICE_TILE64;
+        default:
+            return GMM_TILE_ADVICE_MODES;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the bytes of texel data a created resource holds--every MIP, array
+/// slice (or cube face) and sample, without any pitch, alignment or tiling
+/// padding. Planar YUV counts its chroma planes by their subsampling.
+/////////////////////////////////////////////////////////////////////////////////////
+static GMM_GFX_SIZE_T GmmTileAdvicePayload(GMM_RESOURCE_INFO &Res)
+{
+    GMM_GFX_SIZE_T Payload = 0;
+    uint32_t       ElementBytes = GFX_MAX(Res.GetBitsPerPixel() / CHAR_BIT, 1u);
+    uint32_t       Slices       = GFX_MAX(Res.GetArraySize(), 1u) * ((Res.GetResourceType() == RESOURCE_CUBE) ? 6 : 1);
+
+    if(GmmIsPlanar(Res.GetResourceFormat()))
+    {
+        uint32_t Num = 3, Den = 2; // Luma + chroma samples, per luma sample.
+
+        switch(Res.GetResourceFormat())
+        {
+            case GMM_FORMAT_P208:
+            case GMM_FORMAT_P216:
+            case GMM_FORMAT_MFX_JPEG_YUV422H:
+            case GMM_FORMAT_MFX_JPEG_YUV422V:
+                Num = 2;
+                Den = 1;
+                break;
+            case GMM_FORMAT_MFX_JPEG_YUV444:
+            case GMM_FORMAT_RGBP:
+            case GMM_FORMAT_BGRP:
+                Num = 3;
+                Den = 1;
+                break;
+            case GMM_FORMAT_YVU9:
+                Num = 9;
+                Den = 8;
+                break;
+            default: // 4:2:0 and 4:1:1
+                break;
+        }
+
+        return Res.GetBaseWidth() * Res.GetBaseHeight() * ElementBytes * Num / Den * Slices;
+    }
+
+    for(uint32_t Lod = 0; Lod <= Res.GetMaxLod(); Lod++)
+    {
+        Payload += GFX_CEIL_DIV(Res.GetMipWidth(Lod), Res.GetCompressionBlockWidth()) *
+                   GFX_CEIL_DIV(Res.GetMipHeight(Lod), Res.GetCompressionBlockHeight()) *
+                   GFX_CEIL_DIV(Res.GetMipDepth(Lod), Res.GetCompressionBlockDepth()) *
+                   ElementBytes;
+    }
+
+    return Payload * Slices * GFX_MAX(Res.GetNumSamples(), 1u);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for querying how a create would be laid
+/// out under each candidate tile mode (Linear, TileX, TileY/Ys or Tile4/64,
+/// per platform), along with the mode GMM picks by default. Each candidate is
+/// a full layout computation on a stack ResInfo, with the params' tiling flags
+/// replaced--so sizes include GMM's padding WA's, and Compressible reflects its
+/// compression-denial heuristics. Linear and TileX candidates are computed
+/// without compression, as it requires Y-major tiling. None of these creates
+/// go through the layout cache, so queries don't evict real creates' layouts.
+///
+/// @param[in]  pCreateParams: Create params, as would be passed to CreateResInfoObject()
+///                            (not modified); ExistingSysMem isn't supported
+/// @param[out] pAdvice: Receives the candidates
+/// @return     GMM_SUCCESS, or the status of creating with the params as given
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_STATUS GMM_STDCALL GmmLib::GmmClientContext::GetTileModeAdvice(const GMM_RESCREATE_PARAMS *pCreateParams, GMM_TILE_ADVICE *pAdvice)
+{
+    GmmClientContext *pClientContextIn = NULL;
+    GMM_STATUS        Status;
+    uint8_t           Requested = 0;
+
+    __GMM_ASSERTPTR(pCreateParams, GMM_INVALIDPARAM);
+    __GMM_ASSERTPTR(pAdvice, GMM_INVALIDPARAM);
+
+#if(!defined(GMM_UNIFIED_LIB))
+    pClientContextIn = pGmmLibContext->pGmmGlobalClientContext;
+#else
+    pClientContextIn = this;
+#endif
+
+    memset(pAdvice, 0, sizeof(*pAdvice));
+
+    if(pCreateParams->Flags.Info.ExistingSysMem ||
+       pCreateParams->pExistingSysMem ||
+       (pCreateParams->Format <= GMM_FORMAT_INVALID) ||
+       (pCreateParams->Format >= GMM_RESOURCE_FORMATS))
+    {
+        GMM_ASSERTDPF(0, "Invalid parameter!");
+        return GMM_INVALIDPARAM;
+    }
+
+    Requested = pCreateParams->Flags.Info.RenderCompressed || pCreateParams->Flags.Info.MediaCompressed;
+
+    { // GMM's own choice...
+        GMM_RESCREATE_PARAMS Params = *pCreateParams;
+        GMM_RESOURCE_INFO    Res(pClientContextIn);
+
+        Params.pPreallocatedResInfo = NULL;
+        if((Status = Res.Create(*pGmmLibContext, Params, 0)) != GMM_SUCCESS)
+        {
+            return Status;
+        }
+
+        pAdvice->Default = GmmTileAdviceMode(Res);
+    }
+
+    for(uint32_t Mode = 0; Mode < GMM_TILE_ADVICE_MODES; Mode++)
+    {
+        GMM_TILE_ADVICE_ENTRY *pEntry = &pAdvice->Modes[Mode];
+        GMM_RESCREATE_PARAMS   Params = *pCreateParams;
+        GMM_RESOURCE_INFO      Res(pClientContextIn);
+
+        if(!GmmTileAdviceApplies(pGmmLibContext, Params, (GMM_TILE_ADVICE_MODE)Mode))
+        {
+            continue;
+        }
+
+        Params.pPreallocatedResInfo = NULL;
+        Params.Flags.Info.Linear    = 0;
+        Params.Flags.Info.TiledW    = 0;
+        Params.Flags.Info.TiledX    = 0;
+        Params.Flags.Info.TiledY    = 0;
+        Params.Flags.Info.TiledYf   = 0;
+        Params.Flags.Info.TiledYs   = 0;
+        Params.Flags.Info.Tile4     = 0;
+        Params.Flags.Info.Tile64    = 0;
+
+        switch(Mode)
+        {
+            case GMM_TILE_ADVICE_LINEAR:
+                Params.Flags.Info.Linear = 1;
+                break;
+            case GMM_TILE_ADVICE_TILEX:
+                Params.Flags.Info.TiledX = 1;
+                break;
+            case GMM_TILE_ADVICE_TILEY:
+                Params.Flags.Info.TiledY = 1;
+                break;
+            case GMM_TILE_ADVICE_TILEYS:
+                Params.Flags.Info.TiledY  = 1;
+                Params.Flags.Info.TiledYs = 1;
+                break;
+            case GMM_TILE_ADVICE_TILE4:
+                Params.Flags.Info.Tile4 = 1;
+                break;
+            default:
+                Params.Flags.Info.Tile64 = 1;
+                break;
+        }
+
+        if((Mode == GMM_TILE_ADVICE_LINEAR) || (Mode == GMM_TILE_ADVICE_TILEX))
+        {
+            Params.Flags.Info.RenderCompressed = 0;
+            Params.Flags.Info.MediaCompressed  = 0;
+            Params.Flags.Gpu.CCS               = 0;
+            if(!(Params.Flags.Gpu.MCS || Params.Flags.Gpu.HiZ))
+            {
+                Params.Flags.Gpu.IndirectClearColor = 0;
+                Params.Flags.Gpu.UnifiedAuxSurface  = 0;
+            }
+        }
+
+        // Silently remapped (e.g. stencil to TileW)? Then not a real option.
+        if((Res.Create(*pGmmLibContext, Params, 0) != GMM_SUCCESS) ||
+           (GmmTileAdviceMode(Res) != Mode))
+        {
+            continue;
+        }
+
+        pEntry->Valid              = 1;
+        pEntry->Size               = Res.GetSizeMainSurface();
+        pEntry->PaddingWaste       = pEntry->Size - GFX_MIN(GmmTileAdvicePayload(Res), pEntry->Size);
+        pEntry->AuxSize            = Res.GetSizeAuxSurface(GMM_AUX_SURF);
+        pEntry->BaseAlignment      = Res.GetBaseAlignment();
+        pEntry->Pitch              = Res.GetRenderPitch();
+        pEntry->Is64KBPageSuitable = Res.Is64KBPageSuitable();
+
+        if((Mode != GMM_TILE_ADVICE_LINEAR) && (Mode != GMM_TILE_ADVICE_TILEX))
+        {
+            // Xe2 compression is by PAT index, so never denied here.
+            pEntry->Compressible = pGmmLibContext->GetSkuTable().FtrXe2Compression ?
+                                   Requested :
+                                   (Res.GetResFlags().Info.RenderCompressed || Res.GetResFlags().Info.MediaCompressed);
+        }
+    }
+
+    return GMM_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for sizing a resource without creating
+/// a ResInfo Object--for budgeting memory before committing to an allocation.
+/// The layout is computed as by CreateResInfoObject(), but into a stack ResInfo,
+/// so there's no heap allocation and nothing to destroy. Safe to call from any
+/// number of threads at once: beyond stack state, it only reads the lib
+/// context. The layout cache is bypassed, so budgeting over many candidate
+/// sizes neither evicts real creates' layouts nor skews the cache's stats.
+///
+/// @param[in]  pCreateParams: Create params, as would be passed to CreateResInfoObject()
+///                            (not modified); ExistingSysMem isn't supported
+/// @param[out] pEstimate: Receives the sizes
+/// @return     GMM_SUCCESS, or the status the create would fail with
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_STATUS GMM_STDCALL GmmLib::GmmClientContext::EstimateResourceSize(const GMM_RESCREATE_PARAMS *pCreateParams, GMM_SIZE_ESTIMATE *pEstimate)
+{
+    GmmClientContext *pClientContextIn = NULL;
+    GMM_STATUS        Status;
+
+    __GMM_ASSERTPTR(pCreateParams, GMM_INVALIDPARAM);
+    __GMM_ASSERTPTR(pEstimate, GMM_INVALIDPARAM);
+
+#if(!defined(GMM_UNIFIED_LIB))
+    pClientContextIn = pGmmLibContext->pGmmGlobalClientContext;
+#else
+    pClientContextIn = this;
+#endif
+
+    memset(pEstimate, 0, sizeof(*pEstimate));
+
+    // GMM would allocate the system memory itself.
+    if(pCreateParams->Flags.Info.ExistingSysMem ||
+       pCreateParams->pExistingSysMem)
+    {
+        GMM_ASSERTDPF(0, "Invalid parameter!");
+        return GMM_INVALIDPARAM;
+    }
+
+    GMM_RESCREATE_PARAMS Params = *pCreateParams;
+    GMM_RESOURCE_INFO    Res(pClientContextIn);
+
+    Params.pPreallocatedResInfo = NULL;
+    if((Status = Res.Create(*pGmmLibContext, Params, 0)) != GMM_SUCCESS)
+    {
+        return Status;
+    }
+
+    pEstimate->SizeAllocation     = Res.GetSizeAllocation();
+    pEstimate->SizeMainSurface    = Res.GetSizeMainSurface();
+    pEstimate->SizeAuxSurface     = Res.GetSizeAuxSurface(GMM_AUX_SURF);
+    pEstimate->BaseAlignment      = Res.GetBaseAlignment();
+    pEstimate->Is64KBPageSuitable = Res.Is64KBPageSuitable();
+
+    return GMM_SUCCESS;
+}
+
+#ifndef __GMM_KMD__
+/////////////////////////////////////////////////////////////////////////////////////
+/// Member function of ClientContext class for packing many small resources into
+/// fixed-size heaps for suballocation. Only placements are computed--nothing is
+/// allocated or mapped--so it can run offline, without a GPU.
+///
+/// Each resource is placed at a multiple of its base alignment, its tile size
+/// if tiled, and 64KB if it is compressed on an AUX-table platform or if
+/// Use64KBPages is set and it is 64KB-page suitable. Compressed resources get
+/// their own heaps, since compression is a property of the backing pages.
+/// Placement is first-fit, from the largest alignment and size down, into the
+/// gaps earlier placements left as well as heap tails. The same inputs always
+/// give the same placements.
+///
+/// @param[in]  ppRes: Resources to pack
+/// @param[in]  Count: Number of resources
+/// @param[in]  pParams: Packing controls
+/// @param[out] pPlacements: Receives Count placements, in ppRes order
+/// @param[out] pReport: Receives the packing summary
+/// @return     GMM_SUCCESS, GMM_INVALIDPARAM, or GMM_OUT_OF_MEMORY
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_STATUS GMM_STDCALL GmmLib::GmmClientContext::PackResInfoObjects(GMM_RESOURCE_INFO **ppRes, uint32_t Count, const GMM_SUBALLOC_PARAMS *pParams, GMM_SUBALLOC_PLACEMENT *pPlacements, GMM_SUBALLOC_REPORT *pReport)
+{
+    typedef struct
+    {
+        GMM_GFX_SIZE_T Offset, Size;
+    } HOLE;
+
+    typedef struct
+    {
+        uint8_t           Compressed;
+        std::vector<HOLE> Holes; // Free space, by offset.
+    } HEAP;
+
+    const GMM_PLATFORM_INFO &Platform = pGmmLibContext->GetPlatformInfo();
+    std::vector<uint32_t>    Order;
+    std::vector<HEAP>        Heaps;
+
+    __GMM_ASSERTPTR(ppRes || !Count, GMM_INVALIDPARAM);
+    __GMM_ASSERTPTR(pParams, GMM_INVALIDPARAM);
+    __GMM_ASSERTPTR(pPlacements || !Count, GMM_INVALIDPARAM);
+    __GMM_ASSERTPTR(pReport, GMM_INVALIDPARAM);
+
+    memset(pReport, 0, sizeof(*pReport));
+
+    if(!pParams->HeapSize)
+    {
+        GMM_ASSERTDPF(0, "Invalid parameter!");
+        return GMM_INVALIDPARAM;
+    }
+
+    try
+    {
+        for(uint32_t i = 0; i < Count; i++)
+        {
+            GMM_RESOURCE_INFO *     pRes   = ppRes[i];
+            GMM_SUBALLOC_PLACEMENT &Place  = pPlacements[i];
+            GMM_GFX_SIZE_T          Align;
+
+            __GMM_ASSERTPTR(pRes, GMM_INVALIDPARAM);
+
+            Align = GFX_MAX(pRes->GetBaseAlignment(), GMM_KBYTE(4));
+            if(pRes->GetTileType() != GMM_NOT_TILED)
+            {
+                Align = GFX_MAX(Align, Platform.TileInfo[pRes->GmmGetTileMode()].LogicalSize);
+            }
+
+            Place.HeapIndex  = GMM_SUBALLOC_STANDALONE;
+            Place.Offset     = 0;
+            Place.Size       = pRes->GetSizeAllocation();
+            Place.Compressed = pRes->GetResFlags().Info.RenderCompressed || pRes->GetResFlags().Info.MediaCompressed;
+
+            if((pParams->Use64KBPages && pRes->Is64KBPageSuitable()) ||
+               (Place.Compressed && pGmmLibContext->GetSkuTable().FtrE2ECompression && !pGmmLibContext->GetSkuTable().FtrFlatPhysCCS))
+            {
+                Align = GFX_MAX(Align, GMM_KBYTE(64)); // 64KB pages / AUX-table granule.
+            }
+            Place.Alignment = Align;
+
+            Order.push_back(i);
+        }
+
+        std::stable_sort(Order.begin(), Order.end(), [pPlacements](uint32_t a, uint32_t b) {
+            const GMM_SUBALLOC_PLACEMENT &A = pPlacements[a], &B = pPlacements[b];
+
+            return (A.Compressed != B.Compressed) ? (A.Compressed < B.Compressed) :
+                   (A.Alignment != B.Alignment)   ? (A.Alignment > B.Alignment) :
+                                                    (A.Size > B.Size);
+        });
+
+        for(uint32_t i = 0; i < Count; i++)
+        {
+            GMM_SUBALLOC_PLACEMENT &Place = pPlacements[Order[i]];
+
+            if(!Place.Size || (Place.Size > pParams->HeapSize))
+            {
+                pReport->NumStandalone++;
+                pReport->StandaloneBytes += Place.Size;
+                continue;
+            }
+
+            for(uint32_t h = 0; (Place.HeapIndex == GMM_SUBALLOC_STANDALONE); h++)
+            {
+                if(h == Heaps.size())
+                {
+                    HEAP Heap;
+                    HOLE All = {0, pParams->HeapSize};
+
+                    Heap.Compressed = Place.Compressed;
+                    Heap.Holes.push_back(All);
+                    Heaps.push_back(Heap);
+                }
+
+                if(Heaps[h].Compressed != Place.Compressed)
+                {
+                    continue;
+                }
+
+                std::vector<HOLE> &Holes = Heaps[h].Holes;
+                for(size_t k = 0; k < Holes.size(); k++)
+                {
+                    HOLE           Hole   = Holes[k];
+                    GMM_GFX_SIZE_T End    = Hole.Offset + Hole.Size;
+                    GMM_GFX_SIZE_T Offset = GFX_ALIGN(Hole.Offset, Place.Alignment);
+
+                    if((Offset >= End) || (Place.Size > End - Offset))
+                    {
+                        continue;
+                    }
+
+                    Holes.erase(Holes.begin() + k);
+                    if(Offset + Place.Size < End)
+                    {
+                        HOLE Back = {Offset + Place.Size, End - (Offset + Place.Size)};
+                        Holes.insert(Holes.begin() + k, Back);
+                    }
+                    if(Offset > Hole.Offset)
+                    {
+                        HOLE Front = {Hole.Offset, Offset - Hole.Offset};
+                        Holes.insert(Holes.begin() + k, Front);
+                    }
+
+                    Place.HeapIndex = h;
+                    Place.Offset    = Offset;
+                    break;
+                }
+            }
+
+            pReport->UsedBytes += Place.Size;
+            pReport->SeparateBytes += GFX_ALIGN(Place.Size, Place.Alignment);
+        }
+    }
+    catch(...)
+    {
+        memset(pReport, 0, sizeof(*pReport));
+        GMM_ASSERTDPF(0, "Allocation failed!");
+        return GMM_OUT_OF_MEMORY;
+    }
+
+    pReport->NumHeaps  = static_cast<uint32_t>(Heaps.size());
+    pReport->HeapBytes = pReport->NumHeaps * pParams->HeapSize;
+
+    for(uint32_t h = 0; h < Heaps.size(); h++)
+    {
+        for(size_t k = 0; k < Heaps[h].Holes.size(); k++)
+        {
+            const HOLE &Hole = Heaps[h].Holes[k];
+
+            pReport->FreeBytes += Hole.Size;
+            pReport->LargestFreeBlock = GFX_MAX(pReport->LargestFreeBlock, Hole.Size);
+            if(Hole.Offset + Hole.Size < pParams->HeapSize)
+            {
+                pReport->InteriorFreeBytes += Hole.Size;
+            }
+        }
+    }
+
+    if(pReport->FreeBytes)
+    {
+        pReport->FragmentationPct = static_cast<uint32_t>(((pReport->FreeBytes - pReport->LargestFreeBlock) * 100) / pReport->FreeBytes);
+    }
+
+    return GMM_SUCCESS;
+}
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////
 /// Member function of ClientContext class for creation of PAgeTableMgr Object .
 /// @see        GmmLib::GMM_PAGETABLE_MGR::GMM_PAGETABLE_MGR
@@ -1042,3 +2096,18 @@ extern "C" void GMM_STDCALL GmmDeleteClientContext(GMM_CLIENT_CONTEXT *pGmmClien
         pGmmClientContext = NULL;
     }
 }
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmLib::GmmClientContext::EstimateResourceSize
+/// @see        GmmLib::GmmClientContext::EstimateResourceSize()
+///
+/// @param[in]  pGmmClientContext: Pointer to ClientContext object
+/// @param[in]  pCreateParams: Create params
+/// @param[out] pEstimate: Receives the sizes
+/// @return     ::GMM_STATUS
+/////////////////////////////////////////////////////////////////////////////////////
+extern "C" GMM_STATUS GMM_STDCALL GmmEstimateResourceSize(GMM_CLIENT_CONTEXT *pGmmClientContext, const GMM_RESCREATE_PARAMS *pCreateParams, GMM_SIZE_ESTIMATE *pEstimate)
+{
+    __GMM_ASSERTPTR(pGmmClientContext, GMM_INVALIDPARAM);
+    return pGmmClientContext->EstimateResourceSize(pCreateParams, pEstimate);
+}
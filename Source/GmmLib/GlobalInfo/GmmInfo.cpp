@@ -85,6 +85,8 @@ extern "C" GMM_LIB_API_CONSTRUCTOR void GmmCreateMultiAdapterContext()
 /////////////////////////////////////////////////////////////////////////////////////
 extern "C" GMM_LIB_API_DESTRUCTOR void GmmDestroyMultiAdapterContext()
 {
+    GmmTaskRunnerShutdown();
+
     if(pGmmMALibContext)
     {
         // Before destroying GmmMultiAdapterContext, check if all the Adapters have
@@ -829,6 +831,8 @@ GmmLib::Context::Context()
     AllowedPaddingFor64KBTileSurf        = 10;
     UsageBasedPaddingFor64KBTileSurf         = 50;
     MultiEngineAccessCompressedWAEnable      = 0;
+    LayoutGeneration                         = 0;
+    pLayoutCache                             = NULL;
 
 #if(!defined(__GMM_KMD__) && !defined(GMM_UNIFIED_LIB))
     pGmmGlobalClientContext = NULL;
@@ -1040,6 +1044,16 @@ GMM_CLIENT               ClientType)
         return GMM_ERROR;
     }
 
+    BumpLayoutGeneration();
+
+#if(!defined(__GMM_KMD__))
+    if(this->pLayoutCache == NULL)
+    {
+        // Not fatal--Create just computes every layout.
+        this->pLayoutCache = new GmmLayoutCache();
+    }
+#endif
+
     return GMM_SUCCESS;
 }
 
@@ -1066,6 +1080,14 @@ void GMM_STDCALL GmmLib::Context::DestroyContext()
             delete this->pPlatformInfo;
             this->pPlatformInfo = NULL;
     }
+
+#if(!defined(__GMM_KMD__))
+    if(this->pLayoutCache)
+    {
+            delete this->pLayoutCache;
+            this->pLayoutCache = NULL;
+    }
+#endif
 }
 
 void GMM_STDCALL GmmLib::Context::OverrideSkuWa()
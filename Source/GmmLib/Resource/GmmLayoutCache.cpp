@@ -0,0 +1,427 @@
+/*==============================================================================
+Copyright(c) 2017 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and / or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+============================================================================*/
+
+#include "Internal/Common/GmmLibInc.h"
+
+#if(!defined(__GMM_KMD__))
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Constructs an empty layout cache.
+/////////////////////////////////////////////////////////////////////////////////////
+GmmLib::GmmLayoutCache::GmmLayoutCache()
+    : Clock(0),
+      Hits(0),
+      Misses(0),
+      Evictions(0)
+{
+    for(uint32_t Set = 0; Set < NumSets; Set++)
+    {
+        for(uint32_t Way = 0; Way < NumWays; Way++)
+        {
+            Entries[Set][Way].Sequence.store(0, std::memory_order_relaxed);
+            Entries[Set][Way].Hash.store(0, std::memory_order_relaxed);
+            Entries[Set][Way].LastUse.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns whether a create with the given params can be served from/entered
+/// into the cache. Creates with client-provided or GMM-allocated system memory
+/// carry per-object state beyond their layout, so aren't.
+///
+/// @param[in]  CreateParams: Client's create params
+/// @return     1 if cacheable, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GmmLib::GmmLayoutCache::IsCacheable(const GMM_RESCREATE_PARAMS &CreateParams)
+{
+    return (!CreateParams.Flags.Info.ExistingSysMem &&
+            !CreateParams.pExistingSysMem &&
+            !CreateParams.ExistingSysMemSize);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Copies resource flags field by field into Flags (zeroed first), leaving the
+/// undefined tail bits of the Info/Wa words--which clients needn't clear--zero.
+/// Must list every field of GMM_RESOURCE_FLAG, else creates differing only in
+/// a missing flag would share a layout.
+///
+/// @param[in]  CreateFlags: Client's flags
+/// @param[out] Flags: Receives the copy
+/////////////////////////////////////////////////////////////////////////////////////
+static void GmmLayoutCacheCopyFlags(const GMM_RESOURCE_FLAG &CreateFlags, GMM_RESOURCE_FLAG &Flags)
+{
+    memset(&Flags, 0, sizeof(Flags));
+
+    Flags.Gpu.CameraCapture          = CreateFlags.Gpu.CameraCapture;
+    Flags.Gpu.CCS                    = CreateFlags.Gpu.CCS;
+    Flags.Gpu.ColorDiscard           = CreateFlags.Gpu.ColorDiscard;
+    Flags.Gpu.ColorSeparation        = CreateFlags.Gpu.ColorSeparation;
+    Flags.Gpu.ColorSeparationRGBX    = CreateFlags.Gpu.ColorSeparationRGBX;
+    Flags.Gpu.Constant               = CreateFlags.Gpu.Constant;
+    Flags.Gpu.Depth                  = CreateFlags.Gpu.Depth;
+    Flags.Gpu.FlipChain              = CreateFlags.Gpu.FlipChain;
+    Flags.Gpu.FlipChainPreferred     = CreateFlags.Gpu.FlipChainPreferred;
+    Flags.Gpu.HistoryBuffer          = CreateFlags.Gpu.HistoryBuffer;
+    Flags.Gpu.HiZ                    = CreateFlags.Gpu.HiZ;
+    Flags.Gpu.Index                  = CreateFlags.Gpu.Index;
+    Flags.Gpu.IndirectClearColor     = CreateFlags.Gpu.IndirectClearColor;
+    Flags.Gpu.InstructionFlat        = CreateFlags.Gpu.InstructionFlat;
+    Flags.Gpu.InterlacedScan         = CreateFlags.Gpu.InterlacedScan;
+    Flags.Gpu.MCS                    = CreateFlags.Gpu.MCS;
+    Flags.Gpu.MMC                    = CreateFlags.Gpu.MMC;
+    Flags.Gpu.MotionComp             = CreateFlags.Gpu.MotionComp;
+    Flags.Gpu.NoRestriction          = CreateFlags.Gpu.NoRestriction;
+    Flags.Gpu.Overlay                = CreateFlags.Gpu.Overlay;
+    Flags.Gpu.Presentable            = CreateFlags.Gpu.Presentable;
+    Flags.Gpu.ProceduralTexture      = CreateFlags.Gpu.ProceduralTexture;
+    Flags.Gpu.Query                  = CreateFlags.Gpu.Query;
+    Flags.Gpu.RenderTarget           = CreateFlags.Gpu.RenderTarget;
+    Flags.Gpu.S3d                    = CreateFlags.Gpu.S3d;
+    Flags.Gpu.S3dDx                  = CreateFlags.Gpu.S3dDx;
+    Flags.Gpu.__S3dNonPacked         = CreateFlags.Gpu.__S3dNonPacked;
+    Flags.Gpu.__S3dWidi              = CreateFlags.Gpu.__S3dWidi;
+    Flags.Gpu.ScratchFlat            = CreateFlags.Gpu.ScratchFlat;
+    Flags.Gpu.SeparateStencil        = CreateFlags.Gpu.SeparateStencil;
+    Flags.Gpu.State                  = CreateFlags.Gpu.State;
+    Flags.Gpu.StateDx9ConstantBuffer = CreateFlags.Gpu.StateDx9ConstantBuffer;
+    Flags.Gpu.Stream                 = CreateFlags.Gpu.Stream;
+    Flags.Gpu.TextApi                = CreateFlags.Gpu.TextApi;
+    Flags.Gpu.Texture                = CreateFlags.Gpu.Texture;
+    Flags.Gpu.TiledResource          = CreateFlags.Gpu.TiledResource;
+    Flags.Gpu.TilePool               = CreateFlags.Gpu.TilePool;
+    Flags.Gpu.UnifiedAuxSurface      = CreateFlags.Gpu.UnifiedAuxSurface;
+    Flags.Gpu.Vertex                 = CreateFlags.Gpu.Vertex;
+    Flags.Gpu.Video                  = CreateFlags.Gpu.Video;
+    Flags.Gpu.__NonMsaaTileXCcs      = CreateFlags.Gpu.__NonMsaaTileXCcs;
+    Flags.Gpu.__NonMsaaTileYCcs      = CreateFlags.Gpu.__NonMsaaTileYCcs;
+    Flags.Gpu.__MsaaTileMcs          = CreateFlags.Gpu.__MsaaTileMcs;
+    Flags.Gpu.__NonMsaaLinearCCS     = CreateFlags.Gpu.__NonMsaaLinearCCS;
+    Flags.Gpu.__Remaining            = CreateFlags.Gpu.__Remaining;
+
+    Flags.Info.AllowVirtualPadding      = CreateFlags.Info.AllowVirtualPadding;
+    Flags.Info.BigPage                  = CreateFlags.Info.BigPage;
+    Flags.Info.Cacheable                = CreateFlags.Info.Cacheable;
+    Flags.Info.ContigPhysMemoryForiDART = CreateFlags.Info.ContigPhysMemoryForiDART;
+    Flags.Info.CornerTexelMode          = CreateFlags.Info.CornerTexelMode;
+    Flags.Info.ExistingSysMem           = CreateFlags.Info.ExistingSysMem;
+    Flags.Info.ForceResidency           = CreateFlags.Info.ForceResidency;
+    Flags.Info.Gfdt                     = CreateFlags.Info.Gfdt;
+    Flags.Info.GttMapType               = CreateFlags.Info.GttMapType;
+    Flags.Info.HardwareProtected        = CreateFlags.Info.HardwareProtected;
+    Flags.Info.KernelModeMapped         = CreateFlags.Info.KernelModeMapped;
+    Flags.Info.LayoutBelow              = CreateFlags.Info.LayoutBelow;
+    Flags.Info.LayoutMono               = CreateFlags.Info.LayoutMono;
+    Flags.Info.LayoutRight              = CreateFlags.Info.LayoutRight;
+    Flags.Info.LocalOnly                = CreateFlags.Info.LocalOnly;
+    Flags.Info.Linear                   = CreateFlags.Info.Linear;
+    Flags.Info.MediaCompressed          = CreateFlags.Info.MediaCompressed;
+    Flags.Info.NoOptimizationPadding    = CreateFlags.Info.NoOptimizationPadding;
+    Flags.Info.NoPhysMemory             = CreateFlags.Info.NoPhysMemory;
+    Flags.Info.NotLockable              = CreateFlags.Info.NotLockable;
+    Flags.Info.NonLocalOnly             = CreateFlags.Info.NonLocalOnly;
+    Flags.Info.StdSwizzle               = CreateFlags.Info.StdSwizzle;
+    Flags.Info.PseudoStdSwizzle         = CreateFlags.Info.PseudoStdSwizzle;
+    Flags.Info.Undefined64KBSwizzle     = CreateFlags.Info.Undefined64KBSwizzle;
+    Flags.Info.RedecribedPlanes         = CreateFlags.Info.RedecribedPlanes;
+    Flags.Info.RenderCompressed         = CreateFlags.Info.RenderCompressed;
+    Flags.Info.Rotated                  = CreateFlags.Info.Rotated;
+    Flags.Info.Shared                   = CreateFlags.Info.Shared;
+    Flags.Info.SoftwareProtected        = CreateFlags.Info.SoftwareProtected;
+    Flags.Info.SVM                      = CreateFlags.Info.SVM;
+    Flags.Info.TiledW                   = CreateFlags.Info.TiledW;
+    Flags.Info.TiledX                   = CreateFlags.Info.TiledX;
+    Flags.Info.TiledY                   = CreateFlags.Info.TiledY;
+    Flags.Info.TiledYf                  = CreateFlags.Info.TiledYf;
+    Flags.Info.TiledYs                  = CreateFlags.Info.TiledYs;
+    Flags.Info.WddmProtected            = CreateFlags.Info.WddmProtected;
+    Flags.Info.XAdapter                 = CreateFlags.Info.XAdapter;
+    Flags.Info.__PreallocatedResInfo    = CreateFlags.Info.__PreallocatedResInfo;
+    Flags.Info.__PreWddm2SVM            = CreateFlags.Info.__PreWddm2SVM;
+    Flags.Info.Tile4                    = CreateFlags.Info.Tile4;
+    Flags.Info.Tile64                   = CreateFlags.Info.Tile64;
+    Flags.Info.NotCompressed            = CreateFlags.Info.NotCompressed;
+    Flags.Info.__MapCompressible        = CreateFlags.Info.__MapCompressible;
+    Flags.Info.__MapUnCompressible      = CreateFlags.Info.__MapUnCompressible;
+
+    Flags.Wa.GTMfx2ndLevelBatchRingSizeAlign       = CreateFlags.Wa.GTMfx2ndLevelBatchRingSizeAlign;
+    Flags.Wa.ILKNeedAvcMprRowStore32KAlign         = CreateFlags.Wa.ILKNeedAvcMprRowStore32KAlign;
+    Flags.Wa.ILKNeedAvcDmvBuffer32KAlign           = CreateFlags.Wa.ILKNeedAvcDmvBuffer32KAlign;
+    Flags.Wa.NoBufferSamplerPadding                = CreateFlags.Wa.NoBufferSamplerPadding;
+    Flags.Wa.NoLegacyPlanarLinearVideoRestrictions = CreateFlags.Wa.NoLegacyPlanarLinearVideoRestrictions;
+    Flags.Wa.CHVAstcSkipVirtualMips                = CreateFlags.Wa.CHVAstcSkipVirtualMips;
+    Flags.Wa.DisablePackedMipTail                  = CreateFlags.Wa.DisablePackedMipTail;
+    Flags.Wa.__ForceOtherHVALIGN4                  = CreateFlags.Wa.__ForceOtherHVALIGN4;
+    Flags.Wa.DisableDisplayCcsClearColor           = CreateFlags.Wa.DisableDisplayCcsClearColor;
+    Flags.Wa.DisableDisplayCcsCompression          = CreateFlags.Wa.DisableDisplayCcsCompression;
+    Flags.Wa.PreGen12FastClearOnly                 = CreateFlags.Wa.PreGen12FastClearOnly;
+    Flags.Wa.MediaPipeUsage                        = CreateFlags.Wa.MediaPipeUsage;
+    Flags.Wa.ForceStdAllocAlign                    = CreateFlags.Wa.ForceStdAllocAlign;
+    Flags.Wa.DeniableLocalOnlyForCompression       = CreateFlags.Wa.DeniableLocalOnlyForCompression;
+    Flags.Wa.SlicePitchPadding64KB                 = CreateFlags.Wa.SlicePitchPadding64KB;
+    Flags.Wa.SizePadding64KB                       = CreateFlags.Wa.SizePadding64KB;
+    Flags.Wa.IgnoreMultiEngineCompression64KBWA    = CreateFlags.Wa.IgnoreMultiEngineCompression64KBWA;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Copies the create params a layout depends on, member by member, into Params
+/// (zeroed first)--so padding and unused union bytes in the client's struct,
+/// which needn't be zero-initialized, can't perturb the key.
+/// pPreallocatedResInfo, which is per-object, is left NULL.
+///
+/// @param[in]  CreateParams: Client's create params
+/// @param[out] Params: Receives the copy
+/////////////////////////////////////////////////////////////////////////////////////
+static void GmmLayoutCacheCopyParams(const GMM_RESCREATE_PARAMS &CreateParams, GMM_RESCREATE_PARAMS &Params)
+{
+    memset(&Params, 0, sizeof(Params));
+
+    Params.Type                      = CreateParams.Type;
+    Params.Format                    = CreateParams.Format;
+    GmmLayoutCacheCopyFlags(CreateParams.Flags, Params.Flags);
+    Params.MSAA.SamplePattern        = CreateParams.MSAA.SamplePattern;
+    Params.MSAA.NumSamples           = CreateParams.MSAA.NumSamples;
+    Params.Usage                     = CreateParams.Usage;
+    Params.CpTag                     = CreateParams.CpTag;
+    Params.BaseWidth64               = CreateParams.BaseWidth64; // Create reads all of the union.
+    Params.BaseHeight                = CreateParams.BaseHeight;
+    Params.Depth                     = CreateParams.Depth;
+    Params.MaxLod                    = CreateParams.MaxLod;
+    Params.ArraySize                 = CreateParams.ArraySize;
+    Params.BaseAlignment             = CreateParams.BaseAlignment;
+    Params.OverridePitch             = CreateParams.OverridePitch;
+#if(LHDM)
+    Params.DdiRefreshRate            = CreateParams.DdiRefreshRate;
+    Params.DdiD3d9Flags              = CreateParams.DdiD3d9Flags;
+    Params.DdiD3d9Format             = CreateParams.DdiD3d9Format;
+    Params.DdiVidPnSrcId             = CreateParams.DdiVidPnSrcId;
+#endif
+    Params.RotateInfo                = CreateParams.RotateInfo;
+    Params.pExistingSysMem           = CreateParams.pExistingSysMem;
+    Params.ExistingSysMemSize        = CreateParams.ExistingSysMemSize;
+#ifdef _WIN32
+    Params.hParentAllocation         = CreateParams.hParentAllocation;
+#endif
+    Params.MaximumRenamingListLength = CreateParams.MaximumRenamingListLength;
+    Params.NoGfxMemory               = CreateParams.NoGfxMemory;
+
+    Params.MultiTileArch.Enable                 = CreateParams.MultiTileArch.Enable;
+    Params.MultiTileArch.TileInstanced          = CreateParams.MultiTileArch.TileInstanced;
+    Params.MultiTileArch.GpuVaMappingSet        = CreateParams.MultiTileArch.GpuVaMappingSet;
+    Params.MultiTileArch.LocalMemEligibilitySet = CreateParams.MultiTileArch.LocalMemEligibilitySet;
+    Params.MultiTileArch.LocalMemPreferredSet   = CreateParams.MultiTileArch.LocalMemPreferredSet;
+    Params.MultiTileArch.Reserved               = CreateParams.MultiTileArch.Reserved;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Builds the cache key for a create.
+///
+/// @param[in]  pGmmLibContext: Lib context the resource is created on
+/// @param[in]  pClientContext: Creating client's context, or NULL
+/// @param[in]  ClientType: Creating client's type
+/// @param[in]  CreateParams: Client's create params (before CopyClientParams)
+/// @param[out] Key: Receives the key
+/////////////////////////////////////////////////////////////////////////////////////
+void GmmLib::GmmLayoutCache::MakeKey(Context *pGmmLibContext, GmmClientContext *pClientContext, GMM_CLIENT ClientType, const GMM_RESCREATE_PARAMS &CreateParams, KEY &Key)
+{
+    // Zero first so struct padding doesn't perturb hash/compare.
+    memset(&Key, 0, sizeof(Key));
+    GmmLayoutCacheCopyParams(CreateParams, Key.Params);
+
+    if(pClientContext && pClientContext->GmmGetAIL())
+    {
+        memcpy(&Key.Ail, pClientContext->GmmGetAIL(), GFX_MIN(sizeof(Key.Ail), sizeof(GMM_AIL_STRUCT)));
+    }
+
+    Key.ClientType = ClientType;
+    Key.TileMask   = pGmmLibContext->GetGtSysInfoPtr()->MultiTileArchInfo.TileMask;
+    Key.Generation = pGmmLibContext->GetLayoutGeneration();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// 64-bit FNV-1a of a key. Never returns 0, which marks empty entries.
+/////////////////////////////////////////////////////////////////////////////////////
+uint64_t GmmLib::GmmLayoutCache::HashKey(const KEY &Key)
+{
+    const uint8_t *pByte = reinterpret_cast<const uint8_t *>(&Key);
+    uint64_t       Hash  = 0xcbf29ce484222325ull;
+
+    for(size_t i = 0; i < sizeof(Key); i++)
+    {
+        Hash = (Hash ^ pByte[i]) * 0x100000001b3ull;
+    }
+
+    return Hash ? Hash : 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Looks up the layout for a key. Lock-free; safe against concurrent Insert's
+/// and Flush's (an entry being rewritten is just treated as a miss).
+///
+/// @param[in]  Key: Key from MakeKey()
+/// @param[out] Layout: Receives the cached layout on a hit
+/// @return     1 on a hit, 0 on a miss
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GmmLib::GmmLayoutCache::Lookup(const KEY &Key, LAYOUT &Layout)
+{
+    uint64_t Hash = HashKey(Key);
+    ENTRY *  pSet = Entries[Hash % NumSets];
+
+    for(uint32_t Way = 0; Way < NumWays; Way++)
+    {
+        ENTRY &  Entry    = pSet[Way];
+        uint32_t Sequence = Entry.Sequence.load(std::memory_order_acquire);
+
+        if((Sequence & 1) ||
+           (Entry.Hash.load(std::memory_order_relaxed) != Hash) ||
+           memcmp(&Entry.Key, &Key, sizeof(Key)))
+        {
+            continue;
+        }
+
+        memcpy(&Layout, &Entry.Layout, sizeof(Layout));
+
+        // Entry rewritten while we copied it?
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(Entry.Sequence.load(std::memory_order_relaxed) != Sequence)
+        {
+            continue;
+        }
+
+        Entry.LastUse.store(Clock.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+        Hits.fetch_add(1, std::memory_order_relaxed);
+        return 1;
+    }
+
+    Misses.fetch_add(1, std::memory_order_relaxed);
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Enters a freshly computed layout, replacing the least recently used entry
+/// of its set if the set is full.
+///
+/// @param[in]  Key: Key from MakeKey()
+/// @param[in]  Layout: Layout Create computed for the key
+/////////////////////////////////////////////////////////////////////////////////////
+void GmmLib::GmmLayoutCache::Insert(const KEY &Key, const LAYOUT &Layout)
+{
+    uint64_t Hash    = HashKey(Key);
+    ENTRY *  pSet    = Entries[Hash % NumSets];
+    ENTRY *  pVictim = NULL;
+
+    std::lock_guard<std::mutex> Lock(InsertMutex);
+
+    for(uint32_t Way = 0; Way < NumWays; Way++)
+    {
+        if((pSet[Way].Hash.load(std::memory_order_relaxed) == Hash) &&
+           !memcmp(&pSet[Way].Key, &Key, sizeof(Key)))
+        {
+            return; // Racing create got here first.
+        }
+    }
+
+    for(uint32_t Way = 0; Way < NumWays; Way++)
+    {
+        if(pSet[Way].Hash.load(std::memory_order_relaxed) == 0)
+        {
+            pVictim = &pSet[Way];
+            break;
+        }
+
+        if(!pVictim ||
+           (pSet[Way].LastUse.load(std::memory_order_relaxed) < pVictim->LastUse.load(std::memory_order_relaxed)))
+        {
+            pVictim = &pSet[Way];
+        }
+    }
+
+    if(pVictim->Hash.load(std::memory_order_relaxed))
+    {
+        Evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint32_t Sequence = pVictim->Sequence.load(std::memory_order_relaxed);
+
+    pVictim->Sequence.store(Sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    memcpy(&pVictim->Key, &Key, sizeof(Key));
+    memcpy(&pVictim->Layout, &Layout, sizeof(Layout));
+    pVictim->Hash.store(Hash, std::memory_order_relaxed);
+    pVictim->LastUse.store(Clock.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+
+    pVictim->Sequence.store(Sequence + 2, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Drops all cached layouts. Counters are kept.
+/////////////////////////////////////////////////////////////////////////////////////
+void GmmLib::GmmLayoutCache::Flush()
+{
+    std::lock_guard<std::mutex> Lock(InsertMutex);
+
+    for(uint32_t Set = 0; Set < NumSets; Set++)
+    {
+        for(uint32_t Way = 0; Way < NumWays; Way++)
+        {
+            ENTRY &  Entry    = Entries[Set][Way];
+            uint32_t Sequence = Entry.Sequence.load(std::memory_order_relaxed);
+
+            if(Entry.Hash.load(std::memory_order_relaxed))
+            {
+                Entry.Sequence.store(Sequence + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                Entry.Hash.store(0, std::memory_order_relaxed);
+                Entry.Sequence.store(Sequence + 2, std::memory_order_release);
+            }
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the cache's counters.
+///
+/// @param[out] pStats: Receives the counters
+/////////////////////////////////////////////////////////////////////////////////////
+void GmmLib::GmmLayoutCache::GetStats(GMM_LAYOUT_CACHE_STATS *pStats)
+{
+    uint32_t Used = 0;
+
+    __GMM_ASSERTPTR(pStats, VOIDRETURN);
+
+    for(uint32_t Set = 0; Set < NumSets; Set++)
+    {
+        for(uint32_t Way = 0; Way < NumWays; Way++)
+        {
+            Used += !!Entries[Set][Way].Hash.load(std::memory_order_relaxed);
+        }
+    }
+
+    pStats->Capacity  = NumSets * NumWays;
+    pStats->Entries   = Used;
+    pStats->Hits      = Hits.load(std::memory_order_relaxed);
+    pStats->Misses    = Misses.load(std::memory_order_relaxed);
+    pStats->Evictions = Evictions.load(std::memory_order_relaxed);
+}
+
+#endif // !__GMM_KMD__
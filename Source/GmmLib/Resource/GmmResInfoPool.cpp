@@ -0,0 +1,339 @@
+/*==============================================================================
+Copyright(c) 2017 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and / or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+============================================================================*/
+
+#include "Internal/Common/GmmLibInc.h"
+
+#if(!defined(__GMM_KMD__))
+
+#if defined(_WIN32)
+#define GMM_SLAB_MALLOC(Size, Alignment) _aligned_malloc(Size, Alignment)
+#define GMM_SLAB_FREE(p) _aligned_free(p)
+#else
+static void *GmmSlabMalloc(size_t Size, size_t Alignment)
+{
+    void *p = NULL;
+    return (posix_memalign(&p, Alignment, Size) == 0) ? p : NULL;
+}
+#define GMM_SLAB_MALLOC(Size, Alignment) GmmSlabMalloc(Size, Alignment)
+#define GMM_SLAB_FREE(p) free(p)
+#endif
+
+std::mutex                             GmmLib::GmmResInfoPool::RegistryMutex;
+GmmLib::GmmResInfoPool *               GmmLib::GmmResInfoPool::pRegistry = NULL;
+std::atomic<uint32_t>                  GmmLib::GmmResInfoPool::NumPools(0);
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Constructs an empty pool, and registers it for FindOwner().
+///
+/// @param[in]  ObjectSize: Size of pooled objects, in bytes
+/////////////////////////////////////////////////////////////////////////////////////
+GmmLib::GmmResInfoPool::GmmResInfoPool(size_t ObjectSize)
+    : NumSlabs(0)
+{
+    // Cache-line granular, so objects never share lines across threads.
+    this->ObjectSize = GFX_ALIGN(GFX_MAX(ObjectSize, sizeof(FREE_NODE)), 64);
+
+    for(uint32_t i = 0; i < NumShards; i++)
+    {
+        Shards[i].pFree = NULL;
+    }
+
+    for(uint32_t i = 0; i < TableSize; i++)
+    {
+        SlabTable[i].store(0, std::memory_order_relaxed);
+    }
+
+    std::lock_guard<std::mutex> Lock(RegistryMutex);
+
+    pNextPool = pRegistry;
+    pRegistry = this;
+    NumPools.fetch_add(1, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Unregisters the pool and releases all slabs. Objects still allocated must
+/// have been destroyed first (see DestroyAllocated()); their memory goes with
+/// the slabs.
+/////////////////////////////////////////////////////////////////////////////////////
+GmmLib::GmmResInfoPool::~GmmResInfoPool()
+{
+    {
+        std::lock_guard<std::mutex> Lock(RegistryMutex);
+        GmmResInfoPool **           ppLink = &pRegistry;
+
+        while(*ppLink != this)
+        {
+            ppLink = &(*ppLink)->pNextPool;
+        }
+        *ppLink = pNextPool;
+        NumPools.fetch_sub(1, std::memory_order_release);
+    }
+
+    for(uint32_t i = 0; i < TableSize; i++)
+    {
+        uintptr_t Slab = SlabTable[i].load(std::memory_order_relaxed);
+
+        if(Slab)
+        {
+            GMM_SLAB_FREE(reinterpret_cast<void *>(Slab));
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the calling thread's free-list shard. Threads are dealt shards
+/// round-robin on first use.
+/////////////////////////////////////////////////////////////////////////////////////
+uint32_t GmmLib::GmmResInfoPool::GetThreadShard()
+{
+    static std::atomic<uint32_t> NextShard(0);
+    static thread_local uint32_t Shard = NextShard.fetch_add(1, std::memory_order_relaxed) % NumShards;
+
+    return Shard;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the home bucket of a slab in SlabTable.
+/////////////////////////////////////////////////////////////////////////////////////
+uint32_t GmmLib::GmmResInfoPool::HashSlab(uintptr_t Slab)
+{
+    return static_cast<uint32_t>(((uint64_t)(Slab >> SlabShift) * 0x9e3779b97f4a7c15ull) >> 32) % TableSize;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Allocates a slab and registers it in SlabTable.
+///
+/// @return     Free list of the slab's objects, or NULL if the pool can't grow
+/////////////////////////////////////////////////////////////////////////////////////
+GmmLib::GmmResInfoPool::FREE_NODE *GmmLib::GmmResInfoPool::AllocateSlab()
+{
+    uint8_t *  pSlab;
+    FREE_NODE *pList = NULL;
+
+    std::lock_guard<std::mutex> Lock(SlabMutex);
+
+    if(NumSlabs >= TableSize / 2)
+    {
+        return NULL; // Keep probe sequences short--callers fall back to the heap.
+    }
+
+    if((pSlab = static_cast<uint8_t *>(GMM_SLAB_MALLOC(SlabSize, SlabSize))) == NULL)
+    {
+        return NULL;
+    }
+
+    uint32_t Bucket = HashSlab(reinterpret_cast<uintptr_t>(pSlab));
+    while(SlabTable[Bucket].load(std::memory_order_relaxed))
+    {
+        Bucket = (Bucket + 1) % TableSize;
+    }
+    SlabTable[Bucket].store(reinterpret_cast<uintptr_t>(pSlab), std::memory_order_release);
+    NumSlabs++;
+
+    for(size_t Offset = (SlabSize / ObjectSize - 1) * ObjectSize;; Offset -= ObjectSize)
+    {
+        FREE_NODE *pNode = reinterpret_cast<FREE_NODE *>(pSlab + Offset);
+
+        pNode->pNext = pList;
+        pNode->Magic = FreeMagic;
+        pList        = pNode;
+
+        if(!Offset)
+        {
+            break;
+        }
+    }
+
+    return pList;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Allocates an object's memory.
+///
+/// @return     ObjectSize bytes, or NULL if the pool is exhausted (caller should
+///             then use the heap)
+/////////////////////////////////////////////////////////////////////////////////////
+void *GmmLib::GmmResInfoPool::Allocate()
+{
+    uint32_t   Home = GetThreadShard();
+    FREE_NODE *pList, *pNode;
+
+    {
+        std::lock_guard<std::mutex> Lock(Shards[Home].Mutex);
+
+        if((pNode = Shards[Home].pFree) != NULL)
+        {
+            Shards[Home].pFree = pNode->pNext;
+            pNode->Magic       = 0;
+            return pNode;
+        }
+    }
+
+    // Home shard dry--take over another shard's free list, else grow.
+    pList = NULL;
+    for(uint32_t i = 1; (i < NumShards) && !pList; i++)
+    {
+        SHARD &Other = Shards[(Home + i) % NumShards];
+
+        if(Other.Mutex.try_lock())
+        {
+            pList       = Other.pFree;
+            Other.pFree = NULL;
+            Other.Mutex.unlock();
+        }
+    }
+
+    if(!pList && ((pList = AllocateSlab()) == NULL))
+    {
+        return NULL;
+    }
+
+    pNode        = pList;
+    pList        = pList->pNext;
+    pNode->Magic = 0;
+
+    if(pList)
+    {
+        std::lock_guard<std::mutex> Lock(Shards[Home].Mutex);
+
+        while(pList)
+        {
+            FREE_NODE *pNext = pList->pNext;
+
+            pList->pNext       = Shards[Home].pFree;
+            Shards[Home].pFree = pList;
+            pList              = pNext;
+        }
+    }
+
+    return pNode;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns whether pObject was allocated from this pool. Lock-free.
+///
+/// @param[in]  pObject: Any object pointer
+/// @return     1 if pooled, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GmmLib::GmmResInfoPool::Owns(const void *pObject)
+{
+    uintptr_t Slab   = reinterpret_cast<uintptr_t>(pObject) & ~(SlabSize - 1);
+    uint32_t  Bucket = HashSlab(Slab);
+    uintptr_t Entry;
+
+    while((Entry = SlabTable[Bucket].load(std::memory_order_acquire)) != 0)
+    {
+        if(Entry == Slab)
+        {
+            return 1;
+        }
+        Bucket = (Bucket + 1) % TableSize;
+    }
+
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Recycles a pooled object's memory (object must already be destructed).
+///
+/// @param[in]  pObject: Object from Allocate()
+/////////////////////////////////////////////////////////////////////////////////////
+void GmmLib::GmmResInfoPool::Free(void *pObject)
+{
+    FREE_NODE *pNode = static_cast<FREE_NODE *>(pObject);
+    uint32_t   Home  = GetThreadShard();
+
+    __GMM_ASSERT(Owns(pObject));
+
+    std::lock_guard<std::mutex> Lock(Shards[Home].Mutex);
+
+    pNode->pNext       = Shards[Home].pFree;
+    pNode->Magic       = FreeMagic;
+    Shards[Home].pFree = pNode;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the number of slabs the pool has grown to.
+/////////////////////////////////////////////////////////////////////////////////////
+uint32_t GmmLib::GmmResInfoPool::GetNumSlabs()
+{
+    std::lock_guard<std::mutex> Lock(SlabMutex);
+
+    return NumSlabs;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Destroys every object still allocated from the pool (i.e. leaked by the
+/// client), returning its memory to the pool. For use right before the pool
+/// itself is destroyed--not thread-safe against concurrent Allocate/Free.
+///
+/// @param[in]  pfnDestroy: Destructs an object (without freeing its memory)
+/////////////////////////////////////////////////////////////////////////////////////
+void GmmLib::GmmResInfoPool::DestroyAllocated(void (*pfnDestroy)(void *pObject))
+{
+    size_t SlabBytes = (SlabSize / ObjectSize) * ObjectSize;
+
+    for(uint32_t i = 0; i < TableSize; i++)
+    {
+        uint8_t *pSlab = reinterpret_cast<uint8_t *>(SlabTable[i].load(std::memory_order_relaxed));
+
+        for(size_t Offset = 0; pSlab && (Offset < SlabBytes); Offset += ObjectSize)
+        {
+            FREE_NODE *pNode = reinterpret_cast<FREE_NODE *>(pSlab + Offset);
+
+            if(pNode->Magic != FreeMagic)
+            {
+                pfnDestroy(pNode);
+                Free(pNode);
+            }
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the live pool an object was allocated from, if any--so objects
+/// freed through a client context other than their own go back to their pool.
+///
+/// @param[in]  pObject: Any object pointer
+/// @return     Owning pool, or NULL if not pooled
+/////////////////////////////////////////////////////////////////////////////////////
+GmmLib::GmmResInfoPool *GmmLib::GmmResInfoPool::FindOwner(const void *pObject)
+{
+    if(!NumPools.load(std::memory_order_acquire))
+    {
+        return NULL;
+    }
+
+    std::lock_guard<std::mutex> Lock(RegistryMutex);
+
+    for(GmmResInfoPool *pPool = pRegistry; pPool; pPool = pPool->pNextPool)
+    {
+        if(pPool->Owns(pObject))
+        {
+            return pPool;
+        }
+    }
+
+    return NULL;
+}
+
+#endif // !__GMM_KMD__
@@ -154,6 +154,13 @@ void GMM_STDCALL GmmResFree(GMM_RESOURCE_INFO *pRes)
     {
         *pRes = GmmLib::GmmResourceInfo();
     }
+#if(!defined(__GMM_KMD__))
+    else if(pRes->GetGmmClientContext())
+    {
+        // Client context knows whether object is shared or came from its ResInfo pool.
+        pRes->GetGmmClientContext()->DestroyResInfoObject(pRes);
+    }
+#endif
     else
     {
         delete pRes;
@@ -1266,6 +1273,227 @@ uint8_t GMM_STDCALL GmmResCpuBlt(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_B
     return pGmmResource->CpuBlt(pBlt);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::CpuBltParallel
+/// @see    GmmLib::GmmResourceInfoCommon::CpuBltParallel()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT for more info.
+/// @param[in]  pParallel: Threading controls. See ::GMM_TASK_PARALLEL for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmResCpuBltParallel(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, const GMM_TASK_PARALLEL *pParallel)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->CpuBltParallel(pBlt, pParallel);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::CpuBltResource
+/// @see    GmmLib::GmmResourceInfoCommon::CpuBltResource()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class of destination resource
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT_RESOURCE for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmResCpuBltResource(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT_RESOURCE *pBlt)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->CpuBltResource(pBlt);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::CpuBltStream
+/// @see    GmmLib::GmmResourceInfoCommon::CpuBltStream()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT for more info.
+/// @param[in]  pStream: Band callback and controls. See ::GMM_RES_COPY_BLT_STREAM for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmResCpuBltStream(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, const GMM_RES_COPY_BLT_STREAM *pStream)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->CpuBltStream(pBlt, pStream);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::CpuBltConvert
+/// @see    GmmLib::GmmResourceInfoCommon::CpuBltConvert()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT for more info.
+/// @param[in]  pConvert: System memory format. See ::GMM_RES_COPY_BLT_CONVERT for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmResCpuBltConvert(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, const GMM_RES_COPY_BLT_CONVERT *pConvert)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->CpuBltConvert(pBlt, pConvert);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::CpuFill
+/// @see    GmmLib::GmmResourceInfoCommon::CpuFill()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  pFill: Describes the fill operation. See ::GMM_RES_CPU_FILL for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmResCpuFill(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_CPU_FILL *pFill)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->CpuFill(pFill);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::CpuBltSubresources
+/// @see    GmmLib::GmmResourceInfoCommon::CpuBltSubresources()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT_SUBRESOURCES for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmResCpuBltSubresources(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT_SUBRESOURCES *pBlt)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->CpuBltSubresources(pBlt);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::GetCpuBltSubresourceLayout
+/// @see    GmmLib::GmmResourceInfoCommon::GetCpuBltSubresourceLayout()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[out] pSubresources: Receives the packed image's subresource table; NULL to just size.
+/// @param[out] pNumSubresources: Receives number of table entries.
+/// @return     Size in bytes of the packed image
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_GFX_SIZE_T GMM_STDCALL GmmResGetCpuBltSubresourceLayout(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT_SUBRESOURCE *pSubresources, uint32_t *pNumSubresources)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->GetCpuBltSubresourceLayout(pSubresources, pNumSubresources);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::CpuBltPlanar
+/// @see    GmmLib::GmmResourceInfoCommon::CpuBltPlanar()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT_PLANAR for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmResCpuBltPlanar(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT_PLANAR *pBlt)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->CpuBltPlanar(pBlt);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::CpuBltRects
+/// @see    GmmLib::GmmResourceInfoCommon::CpuBltRects()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT for more info.
+/// @param[in]  pRects: Rectangles to BLT. See ::GMM_RES_COPY_BLT_RECTS for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmResCpuBltRects(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, GMM_RES_COPY_BLT_RECTS *pRects)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->CpuBltRects(pBlt, pRects);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::CpuHash
+/// @see    GmmLib::GmmResourceInfoCommon::CpuHash()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  pBlt: Rectangle to hash. See ::GMM_RES_COPY_BLT for more info.
+/// @param[out] pHash: Receives the CRC32C of the rectangle's linear rows
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmResCpuHash(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, uint32_t *pHash)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->CpuHash(pBlt, pHash);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::CpuCompare
+/// @see    GmmLib::GmmResourceInfoCommon::CpuCompare()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  pBlt: Rectangle to compare, and reference image. See ::GMM_RES_COPY_BLT for more info.
+/// @param[out] pCompare: Receives result. See ::GMM_RES_CPU_COMPARE for more info.
+/// @return     1 if compare completed, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmResCpuCompare(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, GMM_RES_CPU_COMPARE *pCompare)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->CpuCompare(pBlt, pCompare);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::CreateOffsetTable
+/// @see    GmmLib::GmmResourceInfoCommon::CreateOffsetTable()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[out] ppTable: Receives the table, or NULL
+/// @return     ::GMM_STATUS
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_STATUS GMM_STDCALL GmmResCreateOffsetTable(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_OFFSET_TABLE **ppTable)
+{
+    __GMM_ASSERTPTR(pGmmResource, GMM_ERROR);
+    return pGmmResource->CreateOffsetTable(ppTable);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::GetOffsetFromTable
+/// @see    GmmLib::GmmResourceInfoCommon::GetOffsetFromTable()
+///
+/// @param[in]      pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]      pTable: Table from GmmResCreateOffsetTable, or NULL
+/// @param[in/out]  pReqInfo: Offset request, as for GmmResGetOffset
+/// @return     ::GMM_STATUS
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_STATUS GMM_STDCALL GmmResGetOffsetFromTable(GMM_RESOURCE_INFO *pGmmResource, const GMM_RES_OFFSET_TABLE *pTable, GMM_REQ_OFFSET_INFO *pReqInfo)
+{
+    __GMM_ASSERTPTR(pGmmResource, GMM_ERROR);
+    __GMM_ASSERTPTR(pReqInfo, GMM_ERROR);
+
+    return pGmmResource->GetOffsetFromTable(pTable, *pReqInfo);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::DestroyOffsetTable
+/// @see    GmmLib::GmmResourceInfoCommon::DestroyOffsetTable()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  pTable: Table from GmmResCreateOffsetTable, or NULL
+/////////////////////////////////////////////////////////////////////////////////////
+void GMM_STDCALL GmmResDestroyOffsetTable(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_OFFSET_TABLE *pTable)
+{
+    __GMM_ASSERTPTR(pGmmResource, VOIDRETURN);
+    pGmmResource->DestroyOffsetTable(pTable);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::GetAllSubresourceOffsets
+/// @see    GmmLib::GmmResourceInfoCommon::GetAllSubresourceOffsets()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  pRange: Subresources to query, or NULL for all
+/// @param[out] pOffsets: Receives the offsets, or NULL to just count
+/// @param[in]  NumOffsets: Entries at pOffsets
+/// @return     Number of subresources in range
+/////////////////////////////////////////////////////////////////////////////////////
+uint32_t GMM_STDCALL GmmResGetAllSubresourceOffsets(GMM_RESOURCE_INFO *pGmmResource, const GMM_SUBRESOURCE_RANGE *pRange, GMM_SUBRESOURCE_OFFSET *pOffsets, uint32_t NumOffsets)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->GetAllSubresourceOffsets(pRange, pOffsets, NumOffsets);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////
 /// C wrapper for GmmResourceInfoCommon::GetStdLayoutSize
 /// @see    GmmLib::GmmResourceInfoCommon::GetStdLayoutSize()
@@ -1293,6 +1521,22 @@ uint8_t GMM_STDCALL GmmResGetMappingSpanDesc(GMM_RESOURCE_INFO *pGmmResource, GM
     return pGmmResource->GetMappingSpanDesc(pMapping);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////
+/// C wrapper for GmmResourceInfoCommon::GetMappingSpans
+/// @see    GmmLib::GmmResourceInfoCommon::GetMappingSpans()
+///
+/// @param[in]  pGmmResource: Pointer to GmmResourceInfo class
+/// @param[in]  Type: Mapping to export
+/// @param[out] pSpans: Receives the spans, or NULL to just count
+/// @param[in]  NumSpans: Entries at pSpans
+/// @return     Number of spans in the mapping
+/////////////////////////////////////////////////////////////////////////////////////
+uint32_t GMM_STDCALL GmmResGetMappingSpans(GMM_RESOURCE_INFO *pGmmResource, GMM_GET_MAPPING_TYPE Type, GMM_MAPPING_SPAN *pSpans, uint32_t NumSpans)
+{
+    __GMM_ASSERTPTR(pGmmResource, 0);
+    return pGmmResource->GetMappingSpans(Type, pSpans, NumSpans);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////
 /// C wrapper for GmmResourceInfoCommon::IsColorSeparation
 /// @see    GmmLib::GmmResourceInfoCommon::IsColorSeparation()
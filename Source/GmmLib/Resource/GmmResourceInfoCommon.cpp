@@ -23,6 +23,37 @@ OTHER DEALINGS IN THE SOFTWARE.
 
 #include "Internal/Common/GmmLibInc.h"
 
+#ifndef __GMM_KMD__
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+// CRC32C instructions, selected at runtime (see GmmCpuCrc32c)--not in KMD,
+// which uses the table-driven CRC.
+#if !defined(__GMM_KMD__)
+#if(defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || \
+   (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+#define GMM_CRC32C_SSE42
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <nmmintrin.h>
+#endif
+#elif defined(__ARM_FEATURE_CRC32) || \
+     (defined(__GNUC__) && defined(__aarch64__) && defined(__linux__))
+#define GMM_CRC32C_ARMV8
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#else
+#include <sys/auxv.h>
+#endif
+#endif
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////
 /// Returns indication of whether resource is eligible for 64KB pages or not.
 /// On Windows, UMD must call this api after GmmResCreate()
@@ -423,10 +454,31 @@ ERROR_CASE:
 /// @return     ::GMM_STATUS
 /////////////////////////////////////////////////////////////////////////////////////
 GMM_STATUS GMM_STDCALL GmmLib::GmmResourceInfoCommon::Create(Context &GmmLibContext, GMM_RESCREATE_PARAMS &CreateParams)
+{
+    return Create(GmmLibContext, CreateParams, 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Create(), optionally bypassing the Context's layout cache--for GmmLib-internal
+/// what-if creates (size estimates, tile mode advice), which shouldn't evict the
+/// layouts of real creates or skew GetLayoutCacheStats.
+///
+/// @param[in]  GmmLib Context: Reference to ::GmmLibContext
+/// @param[in]  CreateParams: Flags which specify what sort of resource to create
+/// @param[in]  UseLayoutCache: 0 to neither look up nor insert the layout
+///
+/// @return     ::GMM_STATUS
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_STATUS GMM_STDCALL GmmLib::GmmResourceInfoCommon::Create(Context &GmmLibContext, GMM_RESCREATE_PARAMS &CreateParams, uint8_t UseLayoutCache)
 {
     const GMM_PLATFORM_INFO *pPlatform;
     GMM_STATUS               Status       = GMM_ERROR;
     GMM_TEXTURE_CALC *       pTextureCalc = NULL;
+#if(!defined(__GMM_KMD__))
+    GmmLayoutCache *         pLayoutCache = NULL;
+    GmmLayoutCache::KEY      LayoutKey;
+    GmmLayoutCache::LAYOUT   Layout;
+#endif
 
     GMM_DPF_ENTER;
 
@@ -434,6 +486,38 @@ GMM_STATUS GMM_STDCALL GmmLib::GmmResourceInfoCommon::Create(Context &GmmLibCont
     pGmmUmdLibContext = reinterpret_cast<uint64_t>(&GmmLibContext);
     __GMM_ASSERTPTR(pGmmUmdLibContext, GMM_ERROR);
 
+#if(!defined(__GMM_KMD__))
+    // Identical creates get identical layouts--serve repeats from the cache.
+    pLayoutCache = GmmLibContext.GetLayoutCache();
+    if(pLayoutCache &&
+       (!UseLayoutCache || !pClientContext || !pClientContext->IsLayoutCacheEnabled() || !GmmLayoutCache::IsCacheable(CreateParams)))
+    {
+        pLayoutCache = NULL;
+    }
+
+    if(pLayoutCache)
+    {
+        GmmLayoutCache::MakeKey(&GmmLibContext, pClientContext, ClientType, CreateParams, LayoutKey);
+
+        if(pLayoutCache->Lookup(LayoutKey, Layout))
+        {
+            Layout.Params.pPreallocatedResInfo = CreateParams.pPreallocatedResInfo;
+
+            CreateParams  = Layout.Params;
+            Surf          = Layout.Surf;
+            AuxSurf       = Layout.AuxSurf;
+            AuxSecSurf    = Layout.AuxSecSurf;
+            RotateInfo    = Layout.RotateInfo;
+            MultiTileArch = Layout.MultiTileArch;
+
+            GMM_DPF_EXIT;
+            return GMM_SUCCESS;
+        }
+    }
+#else
+    GMM_UNREFERENCED_PARAMETER(UseLayoutCache);
+#endif
+
     if(CreateParams.Flags.Info.ExistingSysMem &&
        (CreateParams.Flags.Info.TiledW ||
         CreateParams.Flags.Info.TiledX ||
@@ -695,6 +779,20 @@ GMM_STATUS GMM_STDCALL GmmLib::GmmResourceInfoCommon::Create(Context &GmmLibCont
         Surf.Alignment.BaseAlignment = GFX_MAX(GFX_ALIGN(Surf.Alignment.BaseAlignment, GMM_KBYTE(64)), GMM_KBYTE(64));
     }
 
+#if(!defined(__GMM_KMD__))
+    if(pLayoutCache)
+    {
+        Layout.Params        = CreateParams;
+        Layout.Surf          = Surf;
+        Layout.AuxSurf       = AuxSurf;
+        Layout.AuxSecSurf    = AuxSecSurf;
+        Layout.RotateInfo    = RotateInfo;
+        Layout.MultiTileArch = MultiTileArch;
+
+        pLayoutCache->Insert(LayoutKey, Layout);
+    }
+#endif
+
     GMM_DPF_EXIT;
     return GMM_SUCCESS;
 
@@ -1383,534 +1481,3018 @@ GMM_STATUS GMM_STDCALL GmmLib::GmmResourceInfoCommon::GetOffset(GMM_REQ_OFFSET_I
     }
 }
 
+// Largest offset table CreateOffsetTable will build (~1.7MB); beyond that,
+// e.g. huge arrays, callers are better served by GetOffset.
+#define GMM_RES_OFFSET_TABLE_MAX_ENTRIES (16 * 1024)
+
+typedef struct GMM_RES_OFFSET_TABLE_ENTRY_REC
+{
+    GMM_REQ_OFFSET_INFO Offset;         // Lock, Render and StdLayout results.
+    uint8_t             HasStdLayout;   // StdLayout results valid.
+} GMM_RES_OFFSET_TABLE_ENTRY;
+
+struct GMM_RES_OFFSET_TABLE_REC
+{
+    GMM_GFX_SIZE_T              SurfSize;                   // Of the resource table was built for.
+    uint32_t                    NumMips;
+    uint32_t                    NumArray;
+    uint32_t                    NumFaces;                   // 6 for cube maps, else 1 (face ignored).
+    uint32_t                    NumPlanes;                  // GMM_NO_PLANE onward.
+    uint32_t                    MipBase[GMM_MAX_MIPMAP];    // Index of mip's first entry.
+    uint32_t                    MipSlices[GMM_MAX_MIPMAP];  // Depth slices of mip.
+    GMM_RES_OFFSET_TABLE_ENTRY  Entries[1];
+};
+
 /////////////////////////////////////////////////////////////////////////////////////
-/// Performs a CPU BLT between a specified GPU resource and a system memory surface,
-/// as defined by the GMM_RES_COPY_BLT descriptor.
+/// Returns the index of a subresource's entry in an offset table.
+/////////////////////////////////////////////////////////////////////////////////////
+static GMM_INLINE uint32_t GmmResOffsetTableIndex(const GMM_RES_OFFSET_TABLE *pTable, uint32_t MipLevel, uint32_t ArrayIndex, uint32_t Face, uint32_t Slice, uint32_t Plane)
+{
+    return pTable->MipBase[MipLevel] +
+           (((ArrayIndex * pTable->NumFaces + Face) * pTable->MipSlices[MipLevel] + Slice) * pTable->NumPlanes + Plane);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Precomputes GetOffset's Lock, Render and (where the resource supports it)
+/// StdLayout results for every mip, array slice, cube face, depth slice and
+/// plane of the resource, for GetOffsetFromTable. Clients can build the table
+/// right after Create or on first offset query--the table is immutable, so
+/// can then be shared by any number of threads.
 ///
-/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT for more info.
-/// @return     1 if succeeded, 0 otherwise
+/// @param[out] ppTable: Receives the table, or NULL if the resource has more
+///                      subresources than a table holds
+/// @return     ::GMM_STATUS
 /////////////////////////////////////////////////////////////////////////////////////
-uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuBlt(GMM_RES_COPY_BLT *pBlt)
+GMM_STATUS GMM_STDCALL GmmLib::GmmResourceInfoCommon::CreateOffsetTable(GMM_RES_OFFSET_TABLE **ppTable)
 {
-#define REQUIRE(e)       \
-    if(!(e))             \
-    {                    \
-        __GMM_ASSERT(0); \
-        Success = 0;     \
-        goto EXIT;       \
+    GMM_RES_OFFSET_TABLE *pTable;
+    size_t                TableSize;
+    uint32_t              NumMips, NumArray, NumFaces, NumPlanes, MipLevel;
+    uint64_t              NumEntries = 0;
+    uint8_t               StdLayout;
+
+    __GMM_ASSERTPTR(ppTable, GMM_ERROR);
+
+    *ppTable = NULL;
+
+    NumMips   = GFX_MIN(Surf.MaxLod + 1, GMM_MAX_MIPMAP);
+    NumArray  = GFX_MAX(Surf.ArraySize, 1);
+    NumFaces  = (Surf.Type == RESOURCE_CUBE) ? 6 : 1;
+    NumPlanes = GmmIsPlanar(Surf.Format) ? (GmmLib::Utility::GmmGetNumPlanes(Surf.Format) + 1) : 1;
+    StdLayout = (GMM_IS_64KB_TILE(Surf.Flags) || Surf.Flags.Info.TiledYf) &&
+                ((Surf.Type == RESOURCE_2D) || (Surf.Type == RESOURCE_3D) || (Surf.Type == RESOURCE_CUBE)) &&
+                (!GmmIsPlanar(Surf.Format) || Surf.Flags.Info.RedecribedPlanes);
+
+    for(MipLevel = 0; MipLevel < NumMips; MipLevel++)
+    {
+        uint32_t Slices = (Surf.Type == RESOURCE_3D) ? GFX_MAX(Surf.Depth >> MipLevel, 1) : 1;
+
+        NumEntries += (uint64_t)NumArray * NumFaces * Slices * NumPlanes;
     }
 
-    const GMM_PLATFORM_INFO *pPlatform;
-    uint8_t                  Success = 1;
-    GMM_TEXTURE_INFO *       pTexInfo;
-    GMM_TEXTURE_CALC *       pTextureCalc;
-    GMM_TEXTURE_INFO         RedescribedPlaneInfo;
+    if(NumEntries > GMM_RES_OFFSET_TABLE_MAX_ENTRIES)
+    {
+        return GMM_ERROR;
+    }
 
-    __GMM_ASSERTPTR(pBlt, 0);
+    TableSize = sizeof(GMM_RES_OFFSET_TABLE) + (size_t)(NumEntries - 1) * sizeof(GMM_RES_OFFSET_TABLE_ENTRY);
+    if((pTable = (GMM_RES_OFFSET_TABLE *)GMM_MALLOC(TableSize)) == NULL)
+    {
+        return GMM_OUT_OF_MEMORY;
+    }
 
-    pPlatform    = GMM_OVERRIDE_PLATFORM_INFO(&Surf, GetGmmLibContext());
-    pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
+    memset(pTable, 0, TableSize);
+    pTable->SurfSize  = Surf.Size;
+    pTable->NumMips   = NumMips;
+    pTable->NumArray  = NumArray;
+    pTable->NumFaces  = NumFaces;
+    pTable->NumPlanes = NumPlanes;
 
-    __GMM_ASSERT(
-    Surf.Type == RESOURCE_1D ||
-    Surf.Type == RESOURCE_2D ||
-    Surf.Type == RESOURCE_PRIMARY ||
-    Surf.Type == RESOURCE_CUBE ||
-    Surf.Type == RESOURCE_3D);
-    __GMM_ASSERT(pBlt->Gpu.MipLevel <= Surf.MaxLod);
-    __GMM_ASSERT(Surf.MSAA.NumSamples <= 1);                          // Supported by CpuSwizzleBlt--but not yet this function.
-    __GMM_ASSERT(!Surf.Flags.Gpu.Depth || Surf.MSAA.NumSamples <= 1); // MSAA depth currently ends up with a few exchange swizzles--CpuSwizzleBlt could support with expanded XOR'ing, but probably no use case.
-    __GMM_ASSERT(!(
-    pBlt->Blt.Upload &&
-    Surf.Flags.Gpu.Depth &&
-    (Surf.BitsPerPixel == 32) &&
-    (pBlt->Sys.PixelPitch == 4) &&
-    (pBlt->Blt.BytesPerPixel == 3))); // When uploading D24 data from D24S8 to D24X8, no harm in copying S8 to X8 and upload will then be faster.
+    for(MipLevel = 0, NumEntries = 0; MipLevel < NumMips; MipLevel++)
+    {
+        pTable->MipBase[MipLevel]   = GFX_ULONG_CAST(NumEntries);
+        pTable->MipSlices[MipLevel] = (Surf.Type == RESOURCE_3D) ? GFX_MAX(Surf.Depth >> MipLevel, 1) : 1;
 
-    pTexInfo = &(Surf);
+        NumEntries += (uint64_t)NumArray * NumFaces * pTable->MipSlices[MipLevel] * NumPlanes;
+    }
 
-    // YUV Planar surface
-    if(pTextureCalc->IsTileAlignedPlanes(pTexInfo) && GmmIsPlanar(Surf.Format))
+    for(MipLevel = 0; MipLevel < NumMips; MipLevel++)
     {
-        uint32_t PlaneId = GMM_NO_PLANE;
-	
-	pTextureCalc->GetPlaneIdForCpuBlt(pTexInfo, pBlt, &PlaneId);
-        
-	if(PlaneId == GMM_MAX_PLANE)
+        for(uint32_t ArrayIndex = 0; ArrayIndex < NumArray; ArrayIndex++)
         {
-            // TODO BLT rect should not overlap between planes.
+            for(uint32_t Face = 0; Face < NumFaces; Face++)
             {
-                // __GMM_ASSERT(0); // decide later, for now blt it
-                //return 0;
-            }
+                for(uint32_t Slice = 0; Slice < pTable->MipSlices[MipLevel]; Slice++)
+                {
+                    for(uint32_t Plane = 0; Plane < NumPlanes; Plane++)
+                    {
+                        GMM_RES_OFFSET_TABLE_ENTRY *pEntry = &pTable->Entries[GmmResOffsetTableIndex(pTable, MipLevel, ArrayIndex, Face, Slice, Plane)];
+                        GMM_REQ_OFFSET_INFO         ReqInfo;
 
-            // BLT monolithic surface per plane and remove padding due to tiling.
-            for(PlaneId = GMM_PLANE_Y; PlaneId <= pTextureCalc->GetNumberOfPlanes(pTexInfo); PlaneId++)
-            {
-                pTextureCalc->GetBltInfoPerPlane(pTexInfo, pBlt, PlaneId);
-                CpuBlt(pBlt);
+                        pEntry->Offset.MipLevel   = MipLevel;
+                        pEntry->Offset.ArrayIndex = ArrayIndex;
+                        pEntry->Offset.CubeFace   = (NumFaces > 1) ? (GMM_CUBE_FACE_ENUM)Face : __GMM_NO_CUBE_MAP;
+                        pEntry->Offset.Slice      = Slice;
+                        pEntry->Offset.Plane      = (GMM_YUV_PLANE)Plane;
+                        pEntry->Offset.Frame      = GMM_DISPLAY_BASE;
+
+                        ReqInfo = pEntry->Offset;
+
+                        pEntry->Offset.ReqLock   = 1;
+                        pEntry->Offset.ReqRender = 1;
+
+                        if(GetOffset(pEntry->Offset) != GMM_SUCCESS)
+                        {
+                            GMM_FREE(pTable);
+                            return GMM_ERROR;
+                        }
+
+                        // Redescribed planes only have per-plane StdLayout offsets.
+                        if(StdLayout &&
+                           !(Surf.Flags.Info.RedecribedPlanes && (Plane == GMM_NO_PLANE)))
+                        {
+                            ReqInfo.ReqStdLayout = 1;
+
+                            if(GetOffset(ReqInfo) != GMM_SUCCESS)
+                            {
+                                GMM_FREE(pTable);
+                                return GMM_ERROR;
+                            }
+
+                            pEntry->Offset.StdLayout = ReqInfo.StdLayout;
+                            pEntry->HasStdLayout     = 1;
+                        }
+                    }
+                }
             }
         }
-        // else  continue below
     }
 
-    // UV packed planar surfaces will have different tiling geometries for the
-    // Y and UV planes. Blts cannot span across the tiling boundaries and we
-    // must select the proper mode for each plane. Non-UV packed formats will
-    // have a constant tiling mode, and so do not have the same limits
-    if(Surf.Flags.Info.RedecribedPlanes &&
-       GmmIsUVPacked(Surf.Format))
+    *ppTable = pTable;
+    return GMM_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// GetOffset, served from a table built by CreateOffsetTable. Requests the table
+/// doesn't cover--display frames of S3D resources, out-of-range subresources,
+/// StdLayout size queries--and a NULL table fall back to GetOffset.
+///
+/// @param[in]      pTable: This resource's table, or NULL
+/// @param[in/out]  ReqInfo: Offset request, as for GetOffset
+/// @return     ::GMM_STATUS
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_STATUS GMM_STDCALL GmmLib::GmmResourceInfoCommon::GetOffsetFromTable(const GMM_RES_OFFSET_TABLE *pTable, GMM_REQ_OFFSET_INFO &ReqInfo)
+{
+    const GMM_RES_OFFSET_TABLE_ENTRY *pEntry;
+    uint32_t                          Face = 0;
+
+    if(!pTable ||
+       (ReqInfo.Frame != GMM_DISPLAY_BASE) ||
+       (ReqInfo.MipLevel >= pTable->NumMips) ||
+       (ReqInfo.ArrayIndex >= pTable->NumArray) ||
+       (ReqInfo.Slice >= pTable->MipSlices[ReqInfo.MipLevel]) ||
+       ((uint32_t)ReqInfo.Plane >= pTable->NumPlanes))
     {
-        if(!((pBlt->Gpu.OffsetY >= pTexInfo->OffsetInfo.Plane.Y[GMM_PLANE_U]) ||
-             ((pBlt->Gpu.OffsetY + pBlt->Blt.Height) <= pTexInfo->OffsetInfo.Plane.Y[GMM_PLANE_U])))
-        {
-            __GMM_ASSERT(0);
-            return false;
-        }
+        return GetOffset(ReqInfo);
+    }
 
-        if(pBlt->Gpu.OffsetY < pTexInfo->OffsetInfo.Plane.Y[GMM_PLANE_U])
-        {
-	    pTextureCalc->GetRedescribedPlaneParams(pTexInfo, GMM_PLANE_Y, &RedescribedPlaneInfo);
-            // Y Plane
-            pTexInfo = &RedescribedPlaneInfo;
-        }
-        else
+    if(pTable->NumFaces > 1)
+    {
+        if((uint32_t)ReqInfo.CubeFace >= pTable->NumFaces)
         {
-            // UV Plane
-	    pTextureCalc->GetRedescribedPlaneParams(pTexInfo, GMM_PLANE_U, &RedescribedPlaneInfo);
-            pTexInfo = &RedescribedPlaneInfo;
+            return GetOffset(ReqInfo);
         }
+        Face = ReqInfo.CubeFace;
     }
 
-    if(pBlt->Blt.Slices > 1)
+    __GMM_ASSERT(pTable->SurfSize == Surf.Size); // Table of another resource?
+
+    pEntry = &pTable->Entries[GmmResOffsetTableIndex(pTable, ReqInfo.MipLevel, ReqInfo.ArrayIndex, Face, ReqInfo.Slice, ReqInfo.Plane)];
+
+    if(ReqInfo.ReqStdLayout &&
+       (!pEntry->HasStdLayout || (ReqInfo.StdLayout.Offset == (GMM_GFX_SIZE_T)-1)))
     {
-        GMM_RES_COPY_BLT SliceBlt = *pBlt;
-        uint32_t         Slice;
+        return GetOffset(ReqInfo);
+    }
 
-        SliceBlt.Blt.Slices = 1;
-        for(Slice = pBlt->Gpu.Slice;
-            Slice < (pBlt->Gpu.Slice + pBlt->Blt.Slices);
-            Slice++)
-        {
-            SliceBlt.Gpu.Slice      = Slice;
-            SliceBlt.Sys.pData      = (void *)((char *)pBlt->Sys.pData + (Slice - pBlt->Gpu.Slice) * pBlt->Sys.SlicePitch);
-            SliceBlt.Sys.BufferSize = pBlt->Sys.BufferSize - GFX_ULONG_CAST((char *)SliceBlt.Sys.pData - (char *)pBlt->Sys.pData);
-            CpuBlt(&SliceBlt);
-        }
+    if(ReqInfo.ReqLock)
+    {
+        ReqInfo.Lock = pEntry->Offset.Lock;
     }
-    else // Single Subresource...
+
+    if(ReqInfo.ReqRender)
     {
-        uint32_t            ResPixelPitch = pTexInfo->BitsPerPixel / CHAR_BIT;
-        uint32_t            BlockWidth, BlockHeight, BlockDepth;
-        uint32_t            __CopyWidthBytes, __CopyHeight, __OffsetXBytes, __OffsetY;
-        GMM_REQ_OFFSET_INFO GetOffset = {0};
+        ReqInfo.Render = pEntry->Offset.Render;
+    }
 
-        pTextureCalc->GetCompressionBlockDimensions(pTexInfo->Format, &BlockWidth, &BlockHeight, &BlockDepth);
+    if(ReqInfo.ReqStdLayout)
+    {
+        ReqInfo.StdLayout = pEntry->Offset.StdLayout;
+    }
 
-#if(LHDM)
-        if(pTexInfo->MsFormat == D3DDDIFMT_G8R8_G8B8 ||
-           pTexInfo->MsFormat == D3DDDIFMT_R8G8_B8G8)
+    return GMM_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Frees a table built by CreateOffsetTable.
+///
+/// @param[in]  pTable: Table, or NULL
+/////////////////////////////////////////////////////////////////////////////////////
+void GMM_STDCALL GmmLib::GmmResourceInfoCommon::DestroyOffsetTable(GMM_RES_OFFSET_TABLE *pTable)
+{
+    if(pTable)
+    {
+        GMM_FREE(pTable);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the Render and Lock offsets of a range of subresources in one pass,
+/// e.g. for filling descriptor heaps. Entries are ordered by plane, then array
+/// element, cube face, mip and depth slice (fastest varying).
+///
+/// For 1D/2D/cube resources whose array/face pitch keeps subresources at the
+/// same position within a tile, only the first array slice of each mip is
+/// computed, and the rest offset from it by the pitch.
+///
+/// @param[in]  pRange: Subresources to query, or NULL for all
+/// @param[out] pOffsets: Receives the offsets, or NULL to just count
+/// @param[in]  NumOffsets: Entries at pOffsets--nothing is written if fewer
+///                         than the number of subresources in range
+/// @return     Number of subresources in range, or 0 if range is invalid
+/////////////////////////////////////////////////////////////////////////////////////
+uint32_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::GetAllSubresourceOffsets(const GMM_SUBRESOURCE_RANGE *pRange, GMM_SUBRESOURCE_OFFSET *pOffsets, uint32_t NumOffsets)
+{
+    GMM_TEXTURE_CALC *       pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
+    const GMM_PLATFORM_INFO *pPlatform    = GMM_OVERRIDE_PLATFORM_INFO(&Surf, GetGmmLibContext());
+    const GMM_TILE_INFO *    pTileInfo    = &pPlatform->TileInfo[Surf.TileMode];
+    GMM_SUBRESOURCE_RANGE    Range;
+    uint32_t                 NumFaces, FirstPlane, LastPlane, MipLevel;
+    uint64_t                 Count = 0;
+    uint8_t                  Stride;
+
+    struct
+    {
+        uint8_t        Valid;
+        GMM_GFX_SIZE_T RenderPitch, LockPitch;  // Bytes from one array slice/face to the next.
+    } Strides[GMM_MAX_MIPMAP] = {};
+    GMM_SUBRESOURCE_OFFSET First[GMM_MAX_MIPMAP];
+
+    Range.FirstMip   = 0;
+    Range.NumMips    = Surf.MaxLod + 1;
+    Range.FirstArray = 0;
+    Range.NumArray   = GFX_MAX(Surf.ArraySize, 1);
+
+    if(pRange)
+    {
+        if(!pRange->NumMips || !pRange->NumArray ||
+           ((uint64_t)pRange->FirstMip + pRange->NumMips > Range.NumMips) ||
+           ((uint64_t)pRange->FirstArray + pRange->NumArray > Range.NumArray))
         {
-            BlockWidth    = 2;
-            ResPixelPitch = 4;
+            GMM_ASSERTDPF(0, "Invalid parameter!");
+            return 0;
         }
-#endif
 
-        { // __CopyWidthBytes...
-            uint32_t Width;
+        Range = *pRange;
+    }
 
-            if(!pBlt->Blt.Width) // i.e. "Full Width"
-            {
-                __GMM_ASSERT(!GmmIsPlanar(pTexInfo->Format)); // Caller must set Blt.Width--GMM "auto-size on zero" not supported with planars since multiple interpretations would confuse more than help.
+    if(Range.FirstMip + Range.NumMips > GMM_MAX_MIPMAP)
+    {
+        GMM_ASSERTDPF(0, "Invalid parameter!");
+        return 0;
+    }
 
-                Width = GFX_ULONG_CAST(pTextureCalc->GmmTexGetMipWidth(pTexInfo, pBlt->Gpu.MipLevel));
+    NumFaces   = (Surf.Type == RESOURCE_CUBE) ? 6 : 1;
+    FirstPlane = GmmIsPlanar(Surf.Format) ? GMM_PLANE_Y : GMM_NO_PLANE;
+    LastPlane  = GmmIsPlanar(Surf.Format) ? GmmLib::Utility::GmmGetNumPlanes(Surf.Format) : GMM_NO_PLANE;
 
-                __GMM_ASSERT(Width >= pBlt->Gpu.OffsetX);
-                Width -= pBlt->Gpu.OffsetX;
-                __GMM_ASSERT(Width);
-            }
-            else
-            {
-                Width = pBlt->Blt.Width;
-            }
+    for(MipLevel = Range.FirstMip; MipLevel < Range.FirstMip + Range.NumMips; MipLevel++)
+    {
+        uint32_t Slices = (Surf.Type == RESOURCE_3D) ? GFX_MAX(Surf.Depth >> MipLevel, 1) : 1;
 
-            if(((pBlt->Sys.PixelPitch == 0) ||
-                (pBlt->Sys.PixelPitch == ResPixelPitch)) &&
-               ((pBlt->Blt.BytesPerPixel == 0) ||
-                (pBlt->Blt.BytesPerPixel == ResPixelPitch)))
-            {
-                // Full-Pixel BLT...
-                __CopyWidthBytes =
-                GFX_CEIL_DIV(Width, BlockWidth) * ResPixelPitch;
-            }
-            else // Partial-Pixel BLT...
-            {
-                __GMM_ASSERT(BlockWidth == 1); // No partial-pixel support for block-compressed formats.
+        Count += (uint64_t)(LastPlane - FirstPlane + 1) * Range.NumArray * NumFaces * Slices;
+    }
 
-                // When copying between surfaces with different pixel pitches,
-                // specify CopyWidthBytes in terms of unswizzled surface
-                // (convenient convention used by CpuSwizzleBlt).
-                __CopyWidthBytes =
-                Width *
-                (pBlt->Sys.PixelPitch ?
-                 pBlt->Sys.PixelPitch :
-                 ResPixelPitch);
-            }
-        }
+    if(Count > UINT32_MAX)
+    {
+        GMM_ASSERTDPF(0, "Too many subresources!");
+        return 0;
+    }
 
-        {                         // __CopyHeight...
-            if(!pBlt->Blt.Height) // i.e. "Full Height"
+    if(!pOffsets || (NumOffsets < Count))
+    {
+        return GFX_ULONG_CAST(Count);
+    }
+
+    // Striding needs an address-linear slice index, and a stride which leaves
+    // __GmmGetRenderAlignAddress'ed X/Y offsets unchanged.
+    Stride = !GmmIsPlanar(Surf.Format) &&
+             !Surf.Flags.Gpu.S3d &&
+             !Surf.Flags.Info.RedecribedPlanes &&
+             ((Surf.Type == RESOURCE_1D) || (Surf.Type == RESOURCE_2D) || (Surf.Type == RESOURCE_CUBE)) &&
+             ((Range.NumArray * NumFaces) > 1);
+
+    GMM_SUBRESOURCE_OFFSET *pOut = pOffsets;
+
+    for(uint32_t Plane = FirstPlane; Plane <= LastPlane; Plane++)
+    {
+        for(uint32_t ArrayIndex = Range.FirstArray; ArrayIndex < Range.FirstArray + Range.NumArray; ArrayIndex++)
+        {
+            for(uint32_t Face = 0; Face < NumFaces; Face++)
+            {
+                uint32_t Linear = (ArrayIndex - Range.FirstArray) * NumFaces + Face;
+
+                for(MipLevel = Range.FirstMip; MipLevel < Range.FirstMip + Range.NumMips; MipLevel++)
+                {
+                    uint32_t Slices = (Surf.Type == RESOURCE_3D) ? GFX_MAX(Surf.Depth >> MipLevel, 1) : 1;
+
+                    for(uint32_t Slice = 0; Slice < Slices; Slice++, pOut++)
+                    {
+                        GMM_REQ_OFFSET_INFO ReqInfo = {};
+
+                        pOut->MipLevel   = MipLevel;
+                        pOut->ArrayIndex = ArrayIndex;
+                        pOut->Slice      = Slice;
+                        pOut->CubeFace   = (NumFaces > 1) ? (GMM_CUBE_FACE_ENUM)Face : __GMM_NO_CUBE_MAP;
+                        pOut->Plane      = (GMM_YUV_PLANE)Plane;
+
+                        if(Linear && Strides[MipLevel].Valid)
+                        {
+                            const GMM_SUBRESOURCE_OFFSET *pFirst = &First[MipLevel];
+
+                            pOut->RenderOffset  = pFirst->RenderOffset + Linear * Strides[MipLevel].RenderPitch;
+                            pOut->RenderXOffset = pFirst->RenderXOffset;
+                            pOut->RenderYOffset = pFirst->RenderYOffset;
+                            pOut->RenderZOffset = pFirst->RenderZOffset;
+                            pOut->LockOffset    = pFirst->LockOffset + Linear * Strides[MipLevel].LockPitch;
+                            pOut->LockPitch     = pFirst->LockPitch;
+                            continue;
+                        }
+
+                        ReqInfo.MipLevel   = MipLevel;
+                        ReqInfo.ArrayIndex = ArrayIndex;
+                        ReqInfo.Slice      = Slice;
+                        ReqInfo.CubeFace   = pOut->CubeFace;
+                        ReqInfo.Plane      = pOut->Plane;
+                        ReqInfo.ReqLock    = 1;
+                        ReqInfo.ReqRender  = 1;
+
+                        if(GetOffset(ReqInfo) != GMM_SUCCESS)
+                        {
+                            return 0;
+                        }
+
+                        pOut->RenderOffset  = ReqInfo.Render.Offset64;
+                        pOut->RenderXOffset = ReqInfo.Render.XOffset;
+                        pOut->RenderYOffset = ReqInfo.Render.YOffset;
+                        pOut->RenderZOffset = ReqInfo.Render.ZOffset;
+                        pOut->LockOffset    = ReqInfo.Lock.Offset64;
+                        pOut->LockPitch     = ReqInfo.Lock.Pitch;
+
+                        if(!Linear && Stride)
+                        {
+                            // Pitches from the first to the next slice/face, as GetTexRenderOffset/GetTexLockOffset address them.
+                            GMM_REQ_OFFSET_INFO Next = {};
+                            GMM_GFX_SIZE_T      Render[2], Lock[2];
+
+                            Next.MipLevel   = MipLevel;
+                            Next.ArrayIndex = ArrayIndex;
+                            Next.CubeFace   = pOut->CubeFace;
+                            Next.ReqRender  = 1;
+                            Render[0]       = pTextureCalc->GetMipMapByteAddress(&Surf, &Next);
+                            Next.ReqRender  = 0;
+                            Lock[0]         = pTextureCalc->GetMipMapByteAddress(&Surf, &Next);
+
+                            if(NumFaces > 1)
+                            {
+                                Next.CubeFace = (GMM_CUBE_FACE_ENUM)(Face + 1);
+                            }
+                            else
+                            {
+                                Next.ArrayIndex++;
+                            }
+
+                            Next.ReqRender = 1;
+                            Render[1]      = pTextureCalc->GetMipMapByteAddress(&Surf, &Next);
+                            Next.ReqRender = 0;
+                            Lock[1]        = pTextureCalc->GetMipMapByteAddress(&Surf, &Next);
+
+                            Strides[MipLevel].RenderPitch = Render[1] - Render[0];
+                            Strides[MipLevel].LockPitch   = Lock[1] - Lock[0];
+
+                            if(GMM_IS_TILED(*pTileInfo))
+                            {
+                                Strides[MipLevel].Valid =
+                                (Render[1] > Render[0]) && (Lock[1] > Lock[0]) && Surf.Pitch &&
+                                !(Strides[MipLevel].RenderPitch % Surf.Pitch) &&
+                                !((Strides[MipLevel].RenderPitch / Surf.Pitch) % (pTileInfo->LogicalTileHeight * pTileInfo->LogicalTileDepth));
+                            }
+                            else
+                            {
+                                Strides[MipLevel].Valid =
+                                (Render[1] > Render[0]) && (Lock[1] > Lock[0]) &&
+                                !(Strides[MipLevel].RenderPitch % GMM_BYTES(4));
+                            }
+
+                            First[MipLevel] = *pOut;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return GFX_ULONG_CAST(Count);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Gets the offset of the subresource targeted by a CpuBlt, using the same
+/// Lock/StdLayout/Render selection the BLT itself uses.
+///
+/// @param[in]  pTexInfo: Surface (or redescribed plane) being BLT'ed
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT for more info.
+/// @param[out] ReqInfo: Offset request, filled in and passed to GetOffset()
+/// @return     ::GMM_STATUS
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_STATUS GmmLib::GmmResourceInfoCommon::GetCpuBltOffset(GMM_TEXTURE_INFO *pTexInfo, GMM_RES_COPY_BLT *pBlt, GMM_REQ_OFFSET_INFO &ReqInfo)
+{
+    const GMM_PLATFORM_INFO *pPlatform = GMM_OVERRIDE_PLATFORM_INFO(&Surf, GetGmmLibContext());
+
+    ReqInfo.ReqLock      = pTexInfo->Flags.Info.Linear;
+    ReqInfo.ReqStdLayout = !ReqInfo.ReqLock && pTexInfo->Flags.Info.StdSwizzle;
+    ReqInfo.ReqRender    = !ReqInfo.ReqLock && !ReqInfo.ReqStdLayout;
+    ReqInfo.MipLevel     = pBlt->Gpu.MipLevel;
+    switch(pTexInfo->Type)
+    {
+        case RESOURCE_1D:
+        case RESOURCE_2D:
+        case RESOURCE_PRIMARY:
+        {
+            ReqInfo.ArrayIndex = pBlt->Gpu.Slice;
+            break;
+        }
+        case RESOURCE_CUBE:
+        {
+            ReqInfo.ArrayIndex = pBlt->Gpu.Slice / 6;
+            ReqInfo.CubeFace   = (GMM_CUBE_FACE_ENUM)(pBlt->Gpu.Slice % 6);
+            break;
+        }
+        case RESOURCE_3D:
+        {
+            ReqInfo.Slice = (GMM_IS_64KB_TILE(pTexInfo->Flags) || pTexInfo->Flags.Info.TiledYf) ?
+                            (pBlt->Gpu.Slice / pPlatform->TileInfo[pTexInfo->TileMode].LogicalTileDepth) :
+                            pBlt->Gpu.Slice;
+            break;
+        }
+        default:
+            __GMM_ASSERT(0);
+    }
+
+    return this->GetOffset(ReqInfo);
+}
+
+// Largest fraction of the LLC a CpuBlt may fill with temporal accesses under
+// GMM_CPU_BLT_CACHE_AUTO--the rest is left to the working set of the caller
+// and of the other cores sharing the LLC.
+#define GMM_CPU_BLT_TEMPORAL_LLC_DIVISOR 4
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Resolves the cache policy of a CpuBlt: the caller's Blt.CachePolicy hint, or
+/// for GMM_CPU_BLT_CACHE_AUTO, temporal accesses when the GPU-side transfer fits
+/// in a fraction of the LLC (so data a consumer reads again soon is still
+/// cached) and streaming otherwise (so large transfers don't evict the working
+/// set). Without a known LLC, streaming is used, as CpuBlt always has. Linear
+/// resources are copied with memcpy, so are always temporal.
+///
+/// Resolved for the whole BLT by the outermost call, so that slices, planes,
+/// bands and tasks of it don't each look "small".
+///
+/// @param[in]  pBlt: BLT whose policy to resolve. Blt.CachePolicyUsed receives the result.
+/// @return     GMM_CPU_BLT_CACHE_STREAMING or GMM_CPU_BLT_CACHE_TEMPORAL
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GmmLib::GmmResourceInfoCommon::GetCpuBltCachePolicy(GMM_RES_COPY_BLT *pBlt)
+{
+    uint8_t  CachePolicy   = pBlt->Blt.CachePolicy;
+    uint64_t TransferBytes = 0;
+
+    if(!Surf.Flags.Info.Linear && (CachePolicy == GMM_CPU_BLT_CACHE_AUTO))
+    {
+        GMM_TEXTURE_CALC *pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
+        uint32_t          BlockWidth, BlockHeight, BlockDepth;
+        uint64_t          Width, Height;
+
+        pTextureCalc->GetCompressionBlockDimensions(Surf.Format, &BlockWidth, &BlockHeight, &BlockDepth);
+
+        Width = pBlt->Blt.Width ?
+                pBlt->Blt.Width :
+                (GetMipWidth(pBlt->Gpu.MipLevel) - pBlt->Gpu.OffsetX);
+        Height = pBlt->Blt.Height ?
+                 pBlt->Blt.Height :
+                 (GetMipHeight(pBlt->Gpu.MipLevel) - pBlt->Gpu.OffsetY);
+
+        TransferBytes = GFX_CEIL_DIV(Width, BlockWidth) * GFX_CEIL_DIV(Height, BlockHeight) *
+                        (Surf.BitsPerPixel / CHAR_BIT) *
+                        GFX_MAX(pBlt->Blt.Slices, 1u) * GFX_MAX(pBlt->Blt.MsaaSamples, 1u);
+    }
+
+    CachePolicy = GetCpuBltCachePolicy(CachePolicy, TransferBytes);
+
+    pBlt->Blt.CachePolicyUsed = CachePolicy;
+
+    return CachePolicy;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Resolves a CpuBlt cache policy hint for a transfer of the given size--see
+/// GetCpuBltCachePolicy(GMM_RES_COPY_BLT *).
+///
+/// @param[in]  CachePolicy: Caller's GMM_CPU_BLT_CACHE_POLICY hint
+/// @param[in]  TransferBytes: GPU-side bytes of the whole transfer (used for GMM_CPU_BLT_CACHE_AUTO)
+/// @return     GMM_CPU_BLT_CACHE_STREAMING or GMM_CPU_BLT_CACHE_TEMPORAL
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GmmLib::GmmResourceInfoCommon::GetCpuBltCachePolicy(uint8_t CachePolicy, uint64_t TransferBytes)
+{
+    if(Surf.Flags.Info.Linear)
+    {
+        CachePolicy = GMM_CPU_BLT_CACHE_TEMPORAL;
+    }
+    else if(CachePolicy == GMM_CPU_BLT_CACHE_AUTO)
+    {
+        GMM_CACHE_SIZES CacheSizes = {0};
+
+        GmmGetCacheSizes(GetGmmLibContext(), &CacheSizes);
+
+        CachePolicy = (TransferBytes <= CacheSizes.TotalLLCCache / GMM_CPU_BLT_TEMPORAL_LLC_DIVISOR) ?
+                      GMM_CPU_BLT_CACHE_TEMPORAL :
+                      GMM_CPU_BLT_CACHE_STREAMING;
+    }
+
+    __GMM_ASSERT((CachePolicy == GMM_CPU_BLT_CACHE_STREAMING) || (CachePolicy == GMM_CPU_BLT_CACHE_TEMPORAL));
+
+    return CachePolicy;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Performs a CPU BLT between a specified GPU resource and a system memory surface,
+/// as defined by the GMM_RES_COPY_BLT descriptor.
+///
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuBlt(GMM_RES_COPY_BLT *pBlt)
+{
+    return CpuBltInternal(pBlt, NULL, NULL, 0, NULL, 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Converts a CpuBltRects rectangle (pixels, relative to the BLT rectangle) to
+/// the compression-block column/row and byte/row extent CpuBltInternal copies.
+///
+/// @param[in]  pRect: Rectangle
+/// @param[in]  BlockWidth, BlockHeight: Compression block dimensions
+/// @param[in]  LinearPixelPitch: Bytes per Sys pixel (CpuSwizzleBlt's CopyWidthBytes convention)
+/// @param[out] pColumn, pRow: Block column and row of rectangle's top-left
+/// @param[out] pWidthBytes, pHeight: Copy width in bytes and height in block rows
+/////////////////////////////////////////////////////////////////////////////////////
+static void GmmCpuBltRectExtent(const GMM_RES_COPY_BLT_RECT *pRect, uint32_t BlockWidth, uint32_t BlockHeight, uint32_t LinearPixelPitch,
+                                uint32_t *pColumn, uint32_t *pRow, uint32_t *pWidthBytes, uint32_t *pHeight)
+{
+    __GMM_ASSERT(((pRect->OffsetX % BlockWidth) == 0) && ((pRect->OffsetY % BlockHeight) == 0));
+
+    *pColumn     = pRect->OffsetX / BlockWidth;
+    *pRow        = pRect->OffsetY / BlockHeight;
+    *pWidthBytes = GFX_CEIL_DIV(pRect->Width, BlockWidth) * LinearPixelPitch;
+    *pHeight     = GFX_CEIL_DIV(pRect->Height, BlockHeight);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Body of CpuBlt(), CpuFill(), CpuBltSubresources() and CpuBltRects(). With
+/// pFill, the BLT is an upload whose source is the repeating pattern pFill
+/// (see CpuSwizzleFill) rather than Sys. With pRects, only those parts of the
+/// BLT rectangle are copied, sharing the BLT's offset and swizzle setup.
+///
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT for more info.
+/// @param[in]  pOffset: GetCpuBltOffset() of pBlt's subresource if already known, else NULL.
+///                      Only for single-slice BLT's of non-planar resources.
+/// @param[in]  pFill: Fill pattern, or NULL for an ordinary BLT.
+/// @param[in]  FillPeriodBytes: Horizontal period of pFill rows, in bytes.
+/// @param[in]  pRects: Block-aligned rectangles within the BLT rectangle, or NULL for all of it.
+///                     Not with pFill or planar resources.
+/// @param[in]  NumRects: Entries at pRects.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GmmLib::GmmResourceInfoCommon::CpuBltInternal(GMM_RES_COPY_BLT *pBlt, const GMM_REQ_OFFSET_INFO *pOffset, CPU_SWIZZLE_BLT_SURFACE *pFill, int FillPeriodBytes, const GMM_RES_COPY_BLT_RECT *pRects, uint32_t NumRects)
+{
+#define REQUIRE(e)       \
+    if(!(e))             \
+    {                    \
+        __GMM_ASSERT(0); \
+        Success = 0;     \
+        goto EXIT;       \
+    }
+
+    const GMM_PLATFORM_INFO *pPlatform;
+    uint8_t                  Success = 1;
+    GMM_TEXTURE_INFO *       pTexInfo;
+    GMM_TEXTURE_CALC *       pTextureCalc;
+    GMM_TEXTURE_INFO         RedescribedPlaneInfo;
+
+    __GMM_ASSERTPTR(pBlt, 0);
+
+    pPlatform    = GMM_OVERRIDE_PLATFORM_INFO(&Surf, GetGmmLibContext());
+    pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
+
+    __GMM_ASSERT(
+    Surf.Type == RESOURCE_1D ||
+    Surf.Type == RESOURCE_2D ||
+    Surf.Type == RESOURCE_PRIMARY ||
+    Surf.Type == RESOURCE_CUBE ||
+    Surf.Type == RESOURCE_3D);
+    __GMM_ASSERT(pBlt->Gpu.MipLevel <= Surf.MaxLod);
+    __GMM_ASSERT((pBlt->Gpu.MsaaSample + GFX_MAX(pBlt->Blt.MsaaSamples, 1)) <= GFX_MAX(Surf.MSAA.NumSamples, 1));
+    __GMM_ASSERT(!Surf.Flags.Gpu.Depth || Surf.MSAA.NumSamples <= 1); // MSAA depth currently ends up with a few exchange swizzles--CpuSwizzleBlt could support with expanded XOR'ing, but probably no use case.
+    __GMM_ASSERT(!Surf.Flags.Gpu.SeparateStencil || Surf.MSAA.NumSamples <= 1); // Likewise for MSAA stencil (interleaved samples).
+    __GMM_ASSERT(!(
+    pBlt->Blt.Upload &&
+    Surf.Flags.Gpu.Depth &&
+    (Surf.BitsPerPixel == 32) &&
+    (pBlt->Sys.PixelPitch == 4) &&
+    (pBlt->Blt.BytesPerPixel == 3))); // When uploading D24 data from D24S8 to D24X8, no harm in copying S8 to X8 and upload will then be faster.
+
+    __GMM_ASSERT(!(pRects && pFill));
+
+    pTexInfo = &(Surf);
+
+    GetCpuBltCachePolicy(pBlt);
+
+    // YUV Planar surface
+    if(pTextureCalc->IsTileAlignedPlanes(pTexInfo) && GmmIsPlanar(Surf.Format))
+    {
+        uint32_t PlaneId = GMM_NO_PLANE;
+	
+	pTextureCalc->GetPlaneIdForCpuBlt(pTexInfo, pBlt, &PlaneId);
+        
+	if(PlaneId == GMM_MAX_PLANE)
+        {
+            uint8_t CachePolicy = pBlt->Blt.CachePolicy;
+
+            __GMM_ASSERT(!pRects); // Rects are relative to a single plane's BLT rectangle.
+
+            // TODO BLT rect should not overlap between planes.
+            {
+                // __GMM_ASSERT(0); // decide later, for now blt it
+                //return 0;
+            }
+
+            // BLT monolithic surface per plane and remove padding due to tiling.
+            pBlt->Blt.CachePolicy = pBlt->Blt.CachePolicyUsed; // Planes keep whole-surface policy.
+            for(PlaneId = GMM_PLANE_Y; PlaneId <= pTextureCalc->GetNumberOfPlanes(pTexInfo); PlaneId++)
+            {
+                pTextureCalc->GetBltInfoPerPlane(pTexInfo, pBlt, PlaneId);
+                Success &= CpuBltInternal(pBlt, NULL, pFill, FillPeriodBytes, NULL, 0);
+            }
+            pBlt->Blt.CachePolicy = CachePolicy;
+        }
+        // else  continue below
+    }
+
+    // UV packed planar surfaces will have different tiling geometries for the
+    // Y and UV planes. Blts cannot span across the tiling boundaries and we
+    // must select the proper mode for each plane. Non-UV packed formats will
+    // have a constant tiling mode, and so do not have the same limits
+    if(Surf.Flags.Info.RedecribedPlanes &&
+       GmmIsUVPacked(Surf.Format))
+    {
+        if(!((pBlt->Gpu.OffsetY >= pTexInfo->OffsetInfo.Plane.Y[GMM_PLANE_U]) ||
+             ((pBlt->Gpu.OffsetY + pBlt->Blt.Height) <= pTexInfo->OffsetInfo.Plane.Y[GMM_PLANE_U])))
+        {
+            __GMM_ASSERT(0);
+            return false;
+        }
+
+        if(pBlt->Gpu.OffsetY < pTexInfo->OffsetInfo.Plane.Y[GMM_PLANE_U])
+        {
+	    pTextureCalc->GetRedescribedPlaneParams(pTexInfo, GMM_PLANE_Y, &RedescribedPlaneInfo);
+            // Y Plane
+            pTexInfo = &RedescribedPlaneInfo;
+        }
+        else
+        {
+            // UV Plane
+	    pTextureCalc->GetRedescribedPlaneParams(pTexInfo, GMM_PLANE_U, &RedescribedPlaneInfo);
+            pTexInfo = &RedescribedPlaneInfo;
+        }
+    }
+
+    if(pBlt->Blt.Slices > 1)
+    {
+        GMM_RES_COPY_BLT SliceBlt = *pBlt;
+        uint32_t         Slice;
+
+        SliceBlt.Blt.Slices      = 1;
+        SliceBlt.Blt.CachePolicy = pBlt->Blt.CachePolicyUsed;
+        for(Slice = pBlt->Gpu.Slice;
+            Slice < (pBlt->Gpu.Slice + pBlt->Blt.Slices);
+            Slice++)
+        {
+            SliceBlt.Gpu.Slice      = Slice;
+            SliceBlt.Sys.pData      = (void *)((char *)pBlt->Sys.pData + (Slice - pBlt->Gpu.Slice) * pBlt->Sys.SlicePitch);
+            SliceBlt.Sys.BufferSize = pBlt->Sys.BufferSize - GFX_ULONG_CAST((char *)SliceBlt.Sys.pData - (char *)pBlt->Sys.pData);
+            Success &= CpuBltInternal(&SliceBlt, NULL, pFill, FillPeriodBytes, pRects, NumRects);
+        }
+    }
+    else if(pBlt->Blt.MsaaSamples > 1)
+    {
+        GMM_RES_COPY_BLT SampleBlt = *pBlt;
+        uint32_t         Sample;
+
+        SampleBlt.Blt.MsaaSamples = 1;
+        SampleBlt.Blt.CachePolicy = pBlt->Blt.CachePolicyUsed;
+        for(Sample = 0; Sample < pBlt->Blt.MsaaSamples; Sample++)
+        {
+            SampleBlt.Gpu.MsaaSample = pBlt->Gpu.MsaaSample + Sample;
+            SampleBlt.Sys.pData      = (void *)((char *)pBlt->Sys.pData + Sample * pBlt->Sys.MsaaSamplePitch);
+            SampleBlt.Sys.BufferSize = pBlt->Sys.BufferSize - Sample * pBlt->Sys.MsaaSamplePitch;
+            Success &= CpuBltInternal(&SampleBlt, pOffset, pFill, FillPeriodBytes, pRects, NumRects);
+        }
+    }
+    else // Single Subresource...
+    {
+        uint32_t            ResPixelPitch = pTexInfo->BitsPerPixel / CHAR_BIT;
+        uint32_t            BlockWidth, BlockHeight, BlockDepth;
+        uint32_t            __CopyWidthBytes, __CopyHeight, __OffsetXBytes, __OffsetY;
+        uint32_t            SampleRows = 0, SampleZ = 0;
+        GMM_REQ_OFFSET_INFO GetOffset = {0};
+
+        pTextureCalc->GetCompressionBlockDimensions(pTexInfo->Format, &BlockWidth, &BlockHeight, &BlockDepth);
+
+#if(LHDM)
+        if(pTexInfo->MsFormat == D3DDDIFMT_G8R8_G8B8 ||
+           pTexInfo->MsFormat == D3DDDIFMT_R8G8_B8G8)
+        {
+            BlockWidth    = 2;
+            ResPixelPitch = 4;
+        }
+#endif
+
+        { // __CopyWidthBytes...
+            uint32_t Width;
+
+            if(!pBlt->Blt.Width) // i.e. "Full Width"
+            {
+                __GMM_ASSERT(!GmmIsPlanar(pTexInfo->Format)); // Caller must set Blt.Width--GMM "auto-size on zero" not supported with planars since multiple interpretations would confuse more than help.
+
+                Width = GFX_ULONG_CAST(pTextureCalc->GmmTexGetMipWidth(pTexInfo, pBlt->Gpu.MipLevel));
+
+                __GMM_ASSERT(Width >= pBlt->Gpu.OffsetX);
+                Width -= pBlt->Gpu.OffsetX;
+                __GMM_ASSERT(Width);
+            }
+            else
+            {
+                Width = pBlt->Blt.Width;
+            }
+
+            if(((pBlt->Sys.PixelPitch == 0) ||
+                (pBlt->Sys.PixelPitch == ResPixelPitch)) &&
+               ((pBlt->Blt.BytesPerPixel == 0) ||
+                (pBlt->Blt.BytesPerPixel == ResPixelPitch)))
+            {
+                // Full-Pixel BLT...
+                __CopyWidthBytes =
+                GFX_CEIL_DIV(Width, BlockWidth) * ResPixelPitch;
+            }
+            else // Partial-Pixel BLT...
+            {
+                __GMM_ASSERT(BlockWidth == 1); // No partial-pixel support for block-compressed formats.
+
+                // When copying between surfaces with different pixel pitches,
+                // specify CopyWidthBytes in terms of unswizzled surface
+                // (convenient convention used by CpuSwizzleBlt).
+                __CopyWidthBytes =
+                Width *
+                (pBlt->Sys.PixelPitch ?
+                 pBlt->Sys.PixelPitch :
+                 ResPixelPitch);
+            }
+        }
+
+        {                         // __CopyHeight...
+            if(!pBlt->Blt.Height) // i.e. "Full Height"
+            {
+                __GMM_ASSERT(!GmmIsPlanar(pTexInfo->Format)); // Caller must set Blt.Height--GMM "auto-size on zero" not supported with planars since multiple interpretations would confuse more than help.
+
+                __CopyHeight = pTextureCalc->GmmTexGetMipHeight(pTexInfo, pBlt->Gpu.MipLevel);
+                __GMM_ASSERT(__CopyHeight >= pBlt->Gpu.OffsetY);
+                __CopyHeight -= pBlt->Gpu.OffsetY;
+                __GMM_ASSERT(__CopyHeight);
+            }
+            else
+            {
+                __CopyHeight = pBlt->Blt.Height;
+            }
+
+            __CopyHeight = GFX_CEIL_DIV(__CopyHeight, BlockHeight);
+        }
+
+        __GMM_ASSERT((pBlt->Gpu.OffsetX % BlockWidth) == 0);
+        __OffsetXBytes = (pBlt->Gpu.OffsetX / BlockWidth) * ResPixelPitch + pBlt->Gpu.OffsetSubpixel;
+
+        __GMM_ASSERT((pBlt->Gpu.OffsetY % BlockHeight) == 0);
+        __OffsetY = (pBlt->Gpu.OffsetY / BlockHeight);
+
+        if(pTexInfo->MSAA.NumSamples > 1) // MSAA Sample...
+        {
+            // Samples either occupy their own QPitch-spaced planes (legacy
+            // MSS layout, and Tile64 MSAA x8/x16's planes of 4 samples), or
+            // are swizzled within the tile, where they are the swizzle's
+            // Z/"S" bits--see GetMipMapByteAddress and the MSAA descriptors.
+            uint32_t SamplePlane = 0;
+
+            if(!(GMM_IS_64KB_TILE(pTexInfo->Flags) || pTexInfo->Flags.Info.TiledYf))
+            {
+                SamplePlane = pBlt->Gpu.MsaaSample;
+            }
+            else if(GMM_IS_64KB_TILE(pTexInfo->Flags) &&
+                    !GetGmmLibContext()->GetSkuTable().FtrTileY &&
+                    !GetGmmLibContext()->GetSkuTable().FtrXe2PlusTiling &&
+                    (pTexInfo->MSAA.NumSamples > 4))
+            {
+                SamplePlane = pBlt->Gpu.MsaaSample / 4;
+                SampleZ     = pBlt->Gpu.MsaaSample % 4;
+            }
+            else
+            {
+                SampleZ = pBlt->Gpu.MsaaSample;
+            }
+
+            SampleRows = SamplePlane * (pTexInfo->Alignment.QPitch / BlockHeight);
+        }
+
+        // Get pResData Offsets to this subresource...
+        if(pOffset)
+        {
+            __GMM_ASSERT(pTexInfo == &Surf);
+            GetOffset = *pOffset;
+        }
+        else
+        {
+            REQUIRE(GetCpuBltOffset(pTexInfo, pBlt, GetOffset) == GMM_SUCCESS);
+        }
+
+        if(pTexInfo->Flags.Info.Linear && pFill)
+        {
+            uint32_t DestPitch = GFX_ULONG_CAST(pTexInfo->Pitch);
+            char *   pDest     = (char *)pBlt->Gpu.pData + GetOffset.Lock.Offset + ((SampleRows + __OffsetY) * DestPitch + __OffsetXBytes);
+
+            __GMM_ASSERT(GetOffset.Lock.Offset < pTexInfo->Size);
+
+            for(uint32_t y = 0; y < __CopyHeight; y++)
+            {
+                const char *pPatternRow = (const char *)pFill->pBase + (y % pFill->Height) * pFill->Pitch;
+
+                for(uint32_t x = 0; x < __CopyWidthBytes; x += FillPeriodBytes)
+                {
+                    memcpy(pDest + x, pPatternRow, GFX_MIN((uint32_t)FillPeriodBytes, __CopyWidthBytes - x));
+                }
+                pDest += DestPitch;
+            }
+        }
+        else if(pTexInfo->Flags.Info.Linear)
+        {
+            char *   pDest, *pSrc;
+            uint32_t DestPitch, SrcPitch;
+            uint32_t y;
+
+            __GMM_ASSERT( // Linear-to-linear subpixel BLT unexpected--Not implemented.
+            (!pBlt->Sys.PixelPitch || (pBlt->Sys.PixelPitch == ResPixelPitch)) &&
+            (!pBlt->Blt.BytesPerPixel || (pBlt->Blt.BytesPerPixel == ResPixelPitch)));
+
+            __GMM_ASSERT(GetOffset.Lock.Offset < pTexInfo->Size);
+
+            for(uint32_t Rect = 0; Rect < (pRects ? NumRects : 1); Rect++)
+            {
+                uint32_t Column = 0, Row = 0, CopyWidthBytes = __CopyWidthBytes, CopyHeight = __CopyHeight;
+
+                if(pRects)
+                {
+                    GmmCpuBltRectExtent(&pRects[Rect], BlockWidth, BlockHeight, ResPixelPitch, &Column, &Row, &CopyWidthBytes, &CopyHeight);
+                }
+
+                if(pBlt->Blt.Upload)
+                {
+                    pDest     = (char *)pBlt->Gpu.pData;
+                    DestPitch = GFX_ULONG_CAST(pTexInfo->Pitch);
+                    pDest += GetOffset.Lock.Offset + ((SampleRows + __OffsetY + Row) * DestPitch + __OffsetXBytes + Column * ResPixelPitch);
+
+                    pSrc     = (char *)pBlt->Sys.pData + Row * pBlt->Sys.RowPitch + Column * ResPixelPitch;
+                    SrcPitch = pBlt->Sys.RowPitch;
+                }
+                else
+                {
+                    pDest     = (char *)pBlt->Sys.pData + Row * pBlt->Sys.RowPitch + Column * ResPixelPitch;
+                    DestPitch = pBlt->Sys.RowPitch;
+
+                    pSrc     = (char *)pBlt->Gpu.pData;
+                    SrcPitch = GFX_ULONG_CAST(pTexInfo->Pitch);
+                    pSrc += GetOffset.Lock.Offset + ((SampleRows + __OffsetY + Row) * SrcPitch + __OffsetXBytes + Column * ResPixelPitch);
+                }
+
+                for(y = 0; y < CopyHeight; y++)
+                {
+// Memcpy per row isn't optimal, but doubt this linear-to-linear path matters.
+
+#if _WIN32
+#ifdef __GMM_KMD__
+                    GFX_MEMCPY_S
+#else
+                    memcpy_s
+#endif
+                    (pDest, CopyWidthBytes, pSrc, CopyWidthBytes);
+#else
+                    memcpy(pDest, pSrc, CopyWidthBytes);
+#endif
+                    pDest += DestPitch;
+                    pSrc += SrcPitch;
+                }
+            }
+        }
+        else // Swizzled BLT...
+        {
+            CPU_SWIZZLE_BLT_SURFACE LinearSurface = {0}, SwizzledSurface;
+            uint32_t                ZOffset       = 0;
+
+            __GMM_ASSERT(GetOffset.Render.Offset64 < pTexInfo->Size);
+
+            ZOffset = (pTexInfo->Type == RESOURCE_3D &&
+                       (GMM_IS_64KB_TILE(pTexInfo->Flags) || pTexInfo->Flags.Info.TiledYf)) ?
+                      (pBlt->Gpu.Slice % pPlatform->TileInfo[pTexInfo->TileMode].LogicalTileDepth) :
+                      0;
+
+            if(pTexInfo->Flags.Info.StdSwizzle == 1)
+            {
+                SwizzledSurface.pBase   = (char *)pBlt->Gpu.pData + GFX_ULONG_CAST(GetOffset.StdLayout.Offset);
+                SwizzledSurface.OffsetX = __OffsetXBytes;
+                SwizzledSurface.OffsetY = SampleRows + __OffsetY;
+                SwizzledSurface.OffsetZ = ZOffset + SampleZ;
+
+                uint32_t MipWidth  = GFX_ULONG_CAST(pTextureCalc->GmmTexGetMipWidth(pTexInfo, pBlt->Gpu.MipLevel));
+                uint32_t MipHeight = pTextureCalc->GmmTexGetMipHeight(pTexInfo, pBlt->Gpu.MipLevel);
+
+                pTextureCalc->AlignTexHeightWidth(pTexInfo, &MipHeight, &MipWidth);
+                SwizzledSurface.Height = MipHeight;
+                SwizzledSurface.Pitch  = MipWidth * ResPixelPitch;
+            }
+            else
+            {
+                SwizzledSurface.pBase   = (char *)pBlt->Gpu.pData + GFX_ULONG_CAST(GetOffset.Render.Offset64);
+                SwizzledSurface.Pitch   = GFX_ULONG_CAST(pTexInfo->Pitch);
+                SwizzledSurface.OffsetX = GetOffset.Render.XOffset + __OffsetXBytes;
+                SwizzledSurface.OffsetY = GetOffset.Render.YOffset + SampleRows + __OffsetY;
+                SwizzledSurface.OffsetZ = GetOffset.Render.ZOffset + ZOffset + SampleZ;
+                SwizzledSurface.Height  = GFX_ULONG_CAST(pTexInfo->Size / pTexInfo->Pitch);
+            }
+
+            SwizzledSurface.Element.Pitch = ResPixelPitch;
+            SwizzledSurface.Temporal      = (pBlt->Blt.CachePolicyUsed == GMM_CPU_BLT_CACHE_TEMPORAL);
+
+            LinearSurface.pBase = pBlt->Sys.pData;
+            LinearSurface.Pitch = pBlt->Sys.RowPitch;
+            LinearSurface.Height =
+            pBlt->Sys.RowPitch ?
+            (pBlt->Sys.BufferSize / pBlt->Sys.RowPitch) :
+            (pBlt->Sys.BufferSize ? 1 : 0); // (No Sys surface when filling.)
+            LinearSurface.Element.Pitch =
+            pBlt->Sys.PixelPitch ?
+            pBlt->Sys.PixelPitch :
+            ResPixelPitch;
+            LinearSurface.Element.Size =
+            SwizzledSurface.Element.Size =
+            pBlt->Blt.BytesPerPixel ?
+            pBlt->Blt.BytesPerPixel :
+            ResPixelPitch;
+
+            SwizzledSurface.pSwizzle = NULL;
+
+            if(pTexInfo->Flags.Info.TiledW)
+            {
+                SwizzledSurface.pSwizzle = &INTEL_TILE_W;
+
+                // Correct for GMM's 2x Pitch handling of stencil...
+                // (Unlike the HW, CpuSwizzleBlt handles TileW as a natural,
+                // 64x64=4KB tile, so the pre-Gen10 "double-pitch/half-height"
+                // kludging to TileY shape must be reversed.)
+                __GMM_ASSERT((SwizzledSurface.Pitch % 2) == 0);
+                SwizzledSurface.Pitch /= 2;
+                SwizzledSurface.Height *= 2;
+            }
+            else if(GMM_IS_4KB_TILE(pTexInfo->Flags) &&
+                    !(pTexInfo->Flags.Info.TiledYf ||
+                      GMM_IS_64KB_TILE(pTexInfo->Flags)))
+            {
+                if(GetGmmLibContext()->GetSkuTable().FtrTileY)
+                 {
+                    SwizzledSurface.pSwizzle = &INTEL_TILE_Y;
+                }
+                else
+                {
+                    SwizzledSurface.pSwizzle = &INTEL_TILE_4;
+                }
+            }
+            else if(pTexInfo->Flags.Info.TiledX)
+            {
+                SwizzledSurface.pSwizzle = &INTEL_TILE_X;
+            }
+            else // Yf/s...
+            {
+// clang-format off
+                #define NA
+
+                #define CASE(Layout, Tile, msaa, xD, bpe)                               \
+                    case bpe:                                                           \
+                        SwizzledSurface.pSwizzle = &Layout##_##Tile##_##msaa##xD##bpe;  \
+                        break
+
+                #define SWITCH_BPP(Layout, Tile, msaa, xD)    \
+                    switch(pTexInfo->BitsPerPixel)            \
+                    {                                         \
+                        CASE(Layout, Tile, msaa, xD, 8);      \
+                        CASE(Layout, Tile, msaa, xD, 16);     \
+                        CASE(Layout, Tile, msaa, xD, 32);     \
+                        CASE(Layout, Tile, msaa, xD, 64);     \
+                        CASE(Layout, Tile, msaa, xD, 128);    \
+                    }
+
+                #define SWITCH_MSAA_TILE64(Layout, Tile, xD)     \
+                {\
+                    switch(pTexInfo->MSAA.NumSamples)           \
+                    {                                           \
+                        case 0:                                 \
+                            SWITCH_BPP(Layout, TILE_64, , xD);    \
+                            break;                              \
+                        case 1:                                 \
+                            SWITCH_BPP(Layout, TILE_64, , xD);    \
+                            break;                              \
+                        case 2:                                 \
+                            if(GetGmmLibContext()->GetSkuTable().FtrXe2PlusTiling)\
+                            { \
+                                SWITCH_BPP(Layout, TILE_64_V2, MSAA2_, xD); \
+                            }\
+                            else\
+                            { \
+                                SWITCH_BPP(Layout, TILE_64, MSAA2_, xD); \
+                            } \
+                            break;                              \
+                        case 4:                                 \
+                            if(GetGmmLibContext()->GetSkuTable().FtrXe2PlusTiling)\
+                            { \
+                                SWITCH_BPP(Layout, TILE_64_V2, MSAA4_, xD); \
+                            }\
+                            else\
+                            { \
+                                SWITCH_BPP(Layout, TILE_64, MSAA_, xD); \
+                            } \
+                            break; \
+                        case 8:                                 \
+                            if(GetGmmLibContext()->GetSkuTable().FtrXe2PlusTiling)\
+                            { \
+                                SWITCH_BPP(Layout, TILE_64_V2, MSAA8_, xD); \
+                            }\
+                            else\
+                            { \
+                                SWITCH_BPP(Layout, TILE_64, MSAA_, xD); \
+                            } \
+                            break; \
+                        case 16:                                \
+                            if(GetGmmLibContext()->GetSkuTable().FtrXe2PlusTiling)\
+                            { \
+                                SWITCH_BPP(Layout, TILE_64_V2, MSAA16_, xD); \
+                            }\
+                            else\
+                            { \
+                                SWITCH_BPP(Layout, TILE_64, MSAA_, xD); \
+                            } \
+                            break; \
+                    }                                           \
+                } \
+
+                #define SWITCH_MSAA(Layout, Tile, xD)           \
+                {\
+                    switch(pTexInfo->MSAA.NumSamples)           \
+                    {                                           \
+                        case 0:                                 \
+                            SWITCH_BPP(Layout, Tile, , xD);     \
+                            break;                              \
+                        case 1:                                 \
+                            SWITCH_BPP(Layout, Tile, , xD);     \
+                            break;                              \
+                        case 2:                                 \
+                            SWITCH_BPP(Layout, Tile, MSAA2_, xD);  \
+                            break;                              \
+                        case 4:                                 \
+                            SWITCH_BPP(Layout, Tile, MSAA4_, xD);  \
+                            break;                              \
+                        case 8:                                 \
+                            SWITCH_BPP(Layout, Tile, MSAA8_, xD);     \
+                            break;                              \
+                        case 16:                                \
+                            SWITCH_BPP(Layout, Tile, MSAA16_, xD);    \
+                            break;                              \
+                    }\
+                }
+                // clang-format on
+
+                if(pTexInfo->Type == RESOURCE_3D)
+                {
+                    if(pTexInfo->Flags.Info.TiledYf)
+                    {
+                        SWITCH_BPP(INTEL, TILE_YF, , 3D_);
+                    }
+                    else if(GMM_IS_64KB_TILE(pTexInfo->Flags))
+                    {
+                        if(GetGmmLibContext()->GetSkuTable().FtrTileY)
+                        {
+                            SWITCH_BPP(INTEL, TILE_YS, , 3D_);
+                        }
+                        else
+                        {
+                            if (GetGmmLibContext()->GetSkuTable().FtrXe2PlusTiling)
+                            {
+                                SWITCH_BPP(INTEL, TILE_64_V2, , 3D_);
+                            }
+                            else
+                            {
+                                SWITCH_BPP(INTEL, TILE_64, , 3D_);
+                            }
+                        }
+                    }
+                }
+                else // 2D/Cube...
+                {
+                    if(pTexInfo->Flags.Info.TiledYf)
+                    {
+                        SWITCH_MSAA(INTEL, TILE_YF, );
+                    }
+                    else if(GMM_IS_64KB_TILE(pTexInfo->Flags))
+                    {
+                        if(GetGmmLibContext()->GetSkuTable().FtrTileY)
+                        {
+                            SWITCH_MSAA(INTEL, TILE_YS, );
+                        }
+                        else
+                        {
+                            SWITCH_MSAA_TILE64(INTEL, TILE_64, );
+                        }
+                    }
+                }
+            }
+            __GMM_ASSERT(SwizzledSurface.pSwizzle);
+
+            CPU_SWIZZLE_BLT_KERNEL pfnCpuSwizzleBlt = CpuSwizzleBltKernel(SwizzledSurface.pSwizzle, pBlt->Blt.Upload);
+
+            if(pFill)
+            {
+                CpuSwizzleFill(&SwizzledSurface, pFill, FillPeriodBytes, __CopyWidthBytes, __CopyHeight);
+            }
+            else
+            {
+                uint32_t SwizzledOffsetX = SwizzledSurface.OffsetX, SwizzledOffsetY = SwizzledSurface.OffsetY;
+
+                for(uint32_t Rect = 0; Rect < (pRects ? NumRects : 1); Rect++)
+                {
+                    uint32_t Column = 0, Row = 0, CopyWidthBytes = __CopyWidthBytes, CopyHeight = __CopyHeight;
+
+                    if(pRects)
+                    {
+                        GmmCpuBltRectExtent(&pRects[Rect], BlockWidth, BlockHeight, LinearSurface.Element.Pitch, &Column, &Row, &CopyWidthBytes, &CopyHeight);
+                    }
+
+                    SwizzledSurface.OffsetX = SwizzledOffsetX + Column * ResPixelPitch;
+                    SwizzledSurface.OffsetY = SwizzledOffsetY + Row;
+                    LinearSurface.OffsetX   = Column * LinearSurface.Element.Pitch;
+                    LinearSurface.OffsetY   = Row;
+
+                    if(pBlt->Blt.Upload)
+                    {
+                        pfnCpuSwizzleBlt(&SwizzledSurface, &LinearSurface, CopyWidthBytes, CopyHeight);
+                    }
+                    else
+                    {
+                        pfnCpuSwizzleBlt(&LinearSurface, &SwizzledSurface, CopyWidthBytes, CopyHeight);
+                    }
+                }
+            }
+        }
+    }
+
+EXIT:
+
+    return Success;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Per-call state shared by the tasks of a CpuBltParallel.
+/////////////////////////////////////////////////////////////////////////////////////
+typedef struct GMM_CPU_BLT_PARALLEL_TASKS_REC
+{
+    GmmLib::GmmResourceInfoCommon *pResInfo;
+    const GMM_RES_COPY_BLT        *pBlt;        // Single-slice BLT being split.
+    uint32_t                       BlockHeight; // Pixel rows per surface row.
+    uint32_t                       Height;      // Resolved BLT height, in pixel rows.
+    uint32_t                       FirstRows;   // Surface rows in first band (up to first tile-row boundary).
+    uint32_t                       BandRows;    // Surface rows in each subsequent band.
+#ifndef __GMM_KMD__
+    std::atomic<uint8_t>           Success;
+#else
+    volatile LONG                  Success;     // Interlocked--no <atomic> in KMD.
+#endif
+} GMM_CPU_BLT_PARALLEL_TASKS;
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Performs one band of a CpuBltParallel. Bands are whole tile rows of the
+/// swizzled surface (except the first, which runs to the first tile-row
+/// boundary), so concurrent bands never share a swizzled cache line.
+///
+/// @param[in]  pTaskContext: ::GMM_CPU_BLT_PARALLEL_TASKS
+/// @param[in]  TaskIndex: Index of the band to BLT
+/////////////////////////////////////////////////////////////////////////////////////
+static void GMM_STDCALL GmmCpuBltParallelTask(void *pTaskContext, uint32_t TaskIndex)
+{
+    GMM_CPU_BLT_PARALLEL_TASKS *pTasks = (GMM_CPU_BLT_PARALLEL_TASKS *)pTaskContext;
+    GMM_RES_COPY_BLT            BandBlt = *pTasks->pBlt;
+    uint32_t                    StartRow, EndRow, StartY, EndY;
+
+    StartRow = TaskIndex ? (pTasks->FirstRows + (TaskIndex - 1) * pTasks->BandRows) : 0;
+    EndRow   = TaskIndex ? (StartRow + pTasks->BandRows) : pTasks->FirstRows;
+    StartY   = StartRow * pTasks->BlockHeight;
+    EndY     = GFX_MIN(EndRow * pTasks->BlockHeight, pTasks->Height);
+
+    if(StartY < EndY)
+    {
+        BandBlt.Gpu.OffsetY += StartY;
+        BandBlt.Blt.Height = EndY - StartY;
+        BandBlt.Sys.pData  = (char *)BandBlt.Sys.pData + (size_t)StartRow * BandBlt.Sys.RowPitch;
+        BandBlt.Sys.BufferSize -= StartRow * BandBlt.Sys.RowPitch;
+
+        if(!pTasks->pResInfo->CpuBlt(&BandBlt))
+        {
+#ifndef __GMM_KMD__
+            pTasks->Success.store(0, std::memory_order_relaxed);
+#else
+            InterlockedExchange(&pTasks->Success, 0);
+#endif
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Performs the same BLT as CpuBlt(), but spread across multiple threads.
+///
+/// Each slice is split into bands of whole tile rows of the swizzled surface
+/// and bands are run concurrently--either on the caller's pool (see
+/// ::GMM_TASK_PARALLEL) or on GmmLib-internal worker threads which
+/// pull bands from a shared counter. Slices are processed one after another.
+/// Each band is an ordinary CpuBlt, so result is bit-exact with CpuBlt().
+///
+/// Planar, TileW, StdSwizzle and MSAA resources, and BLT's too small to split,
+/// simply run serially.
+///
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT for more info.
+/// @param[in]  pParallel: Threading controls; NULL = GmmLib defaults.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuBltParallel(GMM_RES_COPY_BLT *pBlt, const GMM_TASK_PARALLEL *pParallel)
+{
+    const GMM_PLATFORM_INFO *  pPlatform;
+    GMM_TEXTURE_CALC *         pTextureCalc;
+    GMM_TASK_PARALLEL  Parallel = {0};
+    uint32_t                   BlockWidth, BlockHeight, BlockDepth;
+    uint32_t                   TileHeight, MaxThreads;
+    uint8_t                    CachePolicy, Success = 1;
+
+    __GMM_ASSERTPTR(pBlt, 0);
+
+    pPlatform    = GMM_OVERRIDE_PLATFORM_INFO(&Surf, GetGmmLibContext());
+    pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
+
+    if(pParallel)
+    {
+        Parallel = *pParallel;
+    }
+
+    MaxThreads = GmmTaskMaxThreads(&Parallel);
+
+    if((MaxThreads <= 1) ||
+       GmmIsPlanar(Surf.Format) ||
+       Surf.Flags.Info.RedecribedPlanes ||
+       Surf.Flags.Info.TiledW ||
+       Surf.Flags.Info.StdSwizzle ||
+       (Surf.MSAA.NumSamples > 1))
+    {
+        return CpuBlt(pBlt);
+    }
+
+    CachePolicy = GetCpuBltCachePolicy(pBlt);
+
+    pTextureCalc->GetCompressionBlockDimensions(Surf.Format, &BlockWidth, &BlockHeight, &BlockDepth);
+    TileHeight = Surf.Flags.Info.Linear ? 1 : pPlatform->TileInfo[Surf.TileMode].LogicalTileHeight;
+    __GMM_ASSERT(TileHeight);
+
+    for(uint32_t Slice = 0; Slice < GFX_MAX(pBlt->Blt.Slices, 1u); Slice++)
+    {
+        GMM_RES_COPY_BLT           SliceBlt = *pBlt;
+        GMM_REQ_OFFSET_INFO        ReqInfo  = {0};
+        GMM_CPU_BLT_PARALLEL_TASKS Tasks;
+        uint32_t                   Rows, Y0, TileRows, TileRowsPerTask, NumTasks;
+
+        SliceBlt.Gpu.Slice       = pBlt->Gpu.Slice + Slice;
+        SliceBlt.Blt.Slices      = 1;
+        SliceBlt.Blt.CachePolicy = CachePolicy; // Whole-BLT policy, not per band.
+        SliceBlt.Sys.pData       = (char *)pBlt->Sys.pData + (size_t)Slice * pBlt->Sys.SlicePitch;
+        if(Slice)
+        {
+            SliceBlt.Sys.BufferSize = pBlt->Sys.BufferSize - Slice * pBlt->Sys.SlicePitch;
+        }
+
+        if(GetCpuBltOffset(&Surf, &SliceBlt, ReqInfo) != GMM_SUCCESS)
+        {
+            __GMM_ASSERT(0);
+            Success = 0;
+            continue;
+        }
+
+        Tasks.pResInfo    = this;
+        Tasks.pBlt        = &SliceBlt;
+        Tasks.BlockHeight = BlockHeight;
+        Tasks.Success     = 1;
+        Tasks.Height      = SliceBlt.Blt.Height ?
+                            SliceBlt.Blt.Height :
+                            (pTextureCalc->GmmTexGetMipHeight(&Surf, SliceBlt.Gpu.MipLevel) - SliceBlt.Gpu.OffsetY);
+
+        // Surface rows, and BLT's starting row within its tile row...
+        Rows = GFX_CEIL_DIV(Tasks.Height, BlockHeight);
+        Y0   = (Surf.Flags.Info.Linear ? 0 : ReqInfo.Render.YOffset) + SliceBlt.Gpu.OffsetY / BlockHeight;
+
+        Tasks.FirstRows = TileHeight - (Y0 % TileHeight);
+        TileRows        = (Rows > Tasks.FirstRows) ? GFX_CEIL_DIV(Rows - Tasks.FirstRows, TileHeight) : 0;
+
+        // Several bands per thread, for balance--but each worth the task overhead...
+        TileRowsPerTask = GFX_MAX(TileRows / (MaxThreads * 4), 1u);
+        if(Parallel.MinTileRowsPerTask)
+        {
+            TileRowsPerTask = GFX_MAX(TileRowsPerTask, Parallel.MinTileRowsPerTask);
+        }
+        else if(Surf.Flags.Info.Linear)
+        {
+            TileRowsPerTask = GFX_MAX(TileRowsPerTask, 16u);
+        }
+
+        Tasks.BandRows = TileRowsPerTask * TileHeight;
+        NumTasks       = 1 + GFX_CEIL_DIV(TileRows, TileRowsPerTask);
+
+        if(NumTasks <= 1)
+        {
+            Success &= CpuBlt(&SliceBlt);
+        }
+        else
+        {
+            GmmRunTasks(&Parallel, MaxThreads, NumTasks, GmmCpuBltParallelTask, &Tasks);
+            Success &= !!Tasks.Success;
+        }
+    }
+
+    return Success;
+}
+
+// Target size of CpuBltResource's staging tile--small enough to stay cache
+// resident between the swizzled read and the swizzled write.
+#define GMM_CPU_BLT_STAGING_SIZE (32 * 1024)
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Performs a CPU BLT from another mapped GPU resource into this one, converting
+/// between the two resources' tile layouts (e.g. TileY to Tile4, Tile64 to Tile4).
+///
+/// Rather than detiling the whole source to a linear surface and then tiling
+/// that into the destination, the copy walks the BLT rectangle in staging
+/// tiles--whole tile rows of both layouts tall, some multiple of both tile
+/// widths wide, and aligned to the destination's tiles. Each is read out of the
+/// source into a small cache-resident staging buffer and immediately written
+/// into the destination, so surface memory is only read once and written once.
+///
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT_RESOURCE for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuBltResource(GMM_RES_COPY_BLT_RESOURCE *pBlt)
+{
+    GmmResourceInfoCommon *  pSrcRes;
+    const GMM_PLATFORM_INFO *pPlatform, *pSrcPlatform;
+    GMM_TEXTURE_CALC *       pTextureCalc;
+    uint32_t                 BlockWidth, BlockHeight, BlockDepth;
+    uint32_t                 SrcBlockWidth, SrcBlockHeight, SrcBlockDepth;
+    uint32_t                 PixelPitch, Width, Height, StagingRows, TileWidthBytes, ColumnBytes, ColumnBlocks;
+    void *                   pStagingAlloc;
+    char *                   pStaging;
+    uint8_t                  Success = 1;
+
+    __GMM_ASSERTPTR(pBlt, 0);
+    __GMM_ASSERTPTR(pBlt->Src.pResInfo, 0);
+    __GMM_ASSERTPTR(pBlt->Src.pData && pBlt->Dst.pData, 0);
+
+    pSrcRes      = pBlt->Src.pResInfo;
+    pPlatform    = GMM_OVERRIDE_PLATFORM_INFO(&Surf, GetGmmLibContext());
+    pSrcPlatform = GMM_OVERRIDE_PLATFORM_INFO(&pSrcRes->Surf, pSrcRes->GetGmmLibContext());
+    pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
+
+    pTextureCalc->GetCompressionBlockDimensions(Surf.Format, &BlockWidth, &BlockHeight, &BlockDepth);
+    pTextureCalc->GetCompressionBlockDimensions(pSrcRes->Surf.Format, &SrcBlockWidth, &SrcBlockHeight, &SrcBlockDepth);
+
+    if((pSrcRes->Surf.BitsPerPixel != Surf.BitsPerPixel) ||
+       (SrcBlockWidth != BlockWidth) ||
+       (SrcBlockHeight != BlockHeight) ||
+       GmmIsPlanar(Surf.Format) || GmmIsPlanar(pSrcRes->Surf.Format) ||
+       Surf.Flags.Info.RedecribedPlanes || pSrcRes->Surf.Flags.Info.RedecribedPlanes ||
+       (Surf.MSAA.NumSamples > 1) || (pSrcRes->Surf.MSAA.NumSamples > 1))
+    {
+        __GMM_ASSERT(0); // Resources must share pixel layout--only their tiling may differ.
+        return 0;
+    }
+
+    __GMM_ASSERT(pSrcRes != this || pBlt->Src.pData != pBlt->Dst.pData); // In-place transcode not supported.
+
+    PixelPitch = Surf.BitsPerPixel / CHAR_BIT;
+
+    Width = pBlt->Blt.Width ?
+            pBlt->Blt.Width :
+            (GFX_ULONG_CAST(pSrcRes->GetMipWidth(pBlt->Src.MipLevel)) - pBlt->Src.OffsetX);
+    Height = pBlt->Blt.Height ?
+             pBlt->Blt.Height :
+             (pSrcRes->GetMipHeight(pBlt->Src.MipLevel) - pBlt->Src.OffsetY);
+
+    // Staging tile: whole tile rows of both layouts (tile dimensions are
+    // powers of two, so the larger is a multiple of the smaller) by a multiple
+    // of both tile widths, filling up to GMM_CPU_BLT_STAGING_SIZE...
+    StagingRows    = GFX_MAX(Surf.Flags.Info.Linear ? 1 : pPlatform->TileInfo[Surf.TileMode].LogicalTileHeight,
+                             pSrcRes->Surf.Flags.Info.Linear ? 1 : pSrcPlatform->TileInfo[pSrcRes->Surf.TileMode].LogicalTileHeight);
+    TileWidthBytes = GFX_MAX(GFX_MAX(Surf.Flags.Info.Linear ? 0 : pPlatform->TileInfo[Surf.TileMode].LogicalTileWidth,
+                                     pSrcRes->Surf.Flags.Info.Linear ? 0 : pSrcPlatform->TileInfo[pSrcRes->Surf.TileMode].LogicalTileWidth),
+                             64u); // At least a cache line, so staging rows stay line aligned.
+    StagingRows    = GFX_MAX(StagingRows, 1u);
+    ColumnBytes    = GFX_MAX(GFX_ALIGN_FLOOR(GMM_CPU_BLT_STAGING_SIZE / StagingRows, TileWidthBytes), TileWidthBytes);
+    ColumnBytes    = GFX_MIN(ColumnBytes, GFX_ALIGN(GFX_CEIL_DIV(Width, BlockWidth) * PixelPitch, TileWidthBytes));
+    ColumnBlocks   = ColumnBytes / PixelPitch;
+    __GMM_ASSERT(ColumnBlocks);
+
+    { // Cache policy, from the whole copy's size rather than each staging tile's...
+        GMM_RES_COPY_BLT PolicyBlt = {0};
+
+        PolicyBlt.Gpu.MipLevel    = pBlt->Dst.MipLevel;
+        PolicyBlt.Blt.Width       = Width;
+        PolicyBlt.Blt.Height      = Height;
+        PolicyBlt.Blt.Slices      = pBlt->Blt.Slices;
+        PolicyBlt.Blt.CachePolicy = pBlt->Blt.CachePolicy;
+        pBlt->Blt.CachePolicyUsed = GetCpuBltCachePolicy(&PolicyBlt);
+    }
+
+    pStagingAlloc = GMM_MALLOC(ColumnBytes * StagingRows + 63);
+    __GMM_ASSERTPTR(pStagingAlloc, 0);
+    pStaging = (char *)GFX_ALIGN((uintptr_t)pStagingAlloc, 64); // Cache-line aligned, so CpuSwizzleBlt can use its streaming paths.
+
+    for(uint32_t Slice = 0; Slice < GFX_MAX(pBlt->Blt.Slices, 1u); Slice++)
+    {
+        GMM_RES_COPY_BLT    DstBlt  = {0};
+        GMM_REQ_OFFSET_INFO ReqInfo = {0};
+        uint32_t            X0, Y0, FirstColumnBlocks, FirstRows;
+
+        DstBlt.Gpu.Slice    = pBlt->Dst.Slice + Slice;
+        DstBlt.Gpu.MipLevel = pBlt->Dst.MipLevel;
+
+        if(GetCpuBltOffset(&Surf, &DstBlt, ReqInfo) != GMM_SUCCESS)
+        {
+            __GMM_ASSERT(0);
+            Success = 0;
+            continue;
+        }
+
+        // Align staging tiles to destination tiles (writes are the expensive side)...
+        X0 = (Surf.Flags.Info.Linear ? 0 : ReqInfo.Render.XOffset / PixelPitch) + pBlt->Dst.OffsetX / BlockWidth;
+        Y0 = (Surf.Flags.Info.Linear ? 0 : ReqInfo.Render.YOffset) + pBlt->Dst.OffsetY / BlockHeight;
+
+        FirstColumnBlocks = ColumnBlocks - (X0 % ColumnBlocks);
+        FirstRows         = StagingRows - (Y0 % StagingRows);
+
+        for(uint32_t y = 0; y < Height;)
+        {
+            uint32_t Rows = GFX_MIN((y ? StagingRows : FirstRows) * BlockHeight, Height - y);
+
+            for(uint32_t x = 0; x < Width;)
+            {
+                uint32_t         Columns = GFX_MIN((x ? ColumnBlocks : FirstColumnBlocks) * BlockWidth, Width - x);
+                GMM_RES_COPY_BLT Blt     = {0};
+
+                Blt.Sys.pData       = pStaging;
+                Blt.Sys.RowPitch    = ColumnBytes;
+                Blt.Sys.BufferSize  = ColumnBytes * StagingRows;
+                Blt.Blt.Width       = Columns;
+                Blt.Blt.Height      = Rows;
+                Blt.Blt.Slices      = 1;
+                Blt.Blt.CachePolicy = pBlt->Blt.CachePolicyUsed;
+
+                // Source --> Staging...
+                Blt.Gpu.pData    = pBlt->Src.pData;
+                Blt.Gpu.Slice    = pBlt->Src.Slice + Slice;
+                Blt.Gpu.MipLevel = pBlt->Src.MipLevel;
+                Blt.Gpu.OffsetX  = pBlt->Src.OffsetX + x;
+                Blt.Gpu.OffsetY  = pBlt->Src.OffsetY + y;
+                Blt.Blt.Upload   = 0;
+                Success &= pSrcRes->CpuBlt(&Blt);
+
+                // Staging --> Destination...
+                Blt.Gpu.pData    = pBlt->Dst.pData;
+                Blt.Gpu.Slice    = pBlt->Dst.Slice + Slice;
+                Blt.Gpu.MipLevel = pBlt->Dst.MipLevel;
+                Blt.Gpu.OffsetX  = pBlt->Dst.OffsetX + x;
+                Blt.Gpu.OffsetY  = pBlt->Dst.OffsetY + y;
+                Blt.Blt.Upload   = 1;
+                Success &= CpuBlt(&Blt);
+
+                x += Columns;
+            }
+
+            y += Rows;
+        }
+    }
+
+    GMM_FREE(pStagingAlloc);
+
+    return Success;
+}
+
+// Target size of a CpuBltStream band (of system memory data) when caller
+// doesn't specify BandTileRows--large enough to amortize per-band handoff,
+// small enough to still be cache resident when swizzled after callback.
+#define GMM_CPU_BLT_STREAM_BAND_SIZE (256 * 1024)
+
+#ifndef __GMM_KMD__
+/////////////////////////////////////////////////////////////////////////////////////
+/// Helper thread for CpuBltStream, running one band's CpuBlt at a time while
+/// the calling thread runs the band callback.
+/////////////////////////////////////////////////////////////////////////////////////
+class GmmCpuBltStreamWorker
+{
+public:
+    GmmCpuBltStreamWorker(GmmLib::GmmResourceInfoCommon *pResInfo)
+        : pResInfo(pResInfo), pPending(NULL), Quit(false), Success(1)
+    {
+        Thread = std::thread(&GmmCpuBltStreamWorker::Run, this);
+    }
+
+    ~GmmCpuBltStreamWorker()
+    {
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Quit = true;
+        }
+        Cv.notify_all();
+        Thread.join();
+    }
+
+    void Submit(GMM_RES_COPY_BLT *pBlt)
+    {
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            pPending = pBlt;
+        }
+        Cv.notify_all();
+    }
+
+    uint8_t Wait()
+    {
+        std::unique_lock<std::mutex> Lock(Mutex);
+        Cv.wait(Lock, [this] { return pPending == NULL; });
+        return Success;
+    }
+
+private:
+    void Run()
+    {
+        std::unique_lock<std::mutex> Lock(Mutex);
+        for(;;)
+        {
+            Cv.wait(Lock, [this] { return pPending || Quit; });
+            if(!pPending)
             {
-                __GMM_ASSERT(!GmmIsPlanar(pTexInfo->Format)); // Caller must set Blt.Height--GMM "auto-size on zero" not supported with planars since multiple interpretations would confuse more than help.
+                break;
+            }
 
-                __CopyHeight = pTextureCalc->GmmTexGetMipHeight(pTexInfo, pBlt->Gpu.MipLevel);
-                __GMM_ASSERT(__CopyHeight >= pBlt->Gpu.OffsetY);
-                __CopyHeight -= pBlt->Gpu.OffsetY;
-                __GMM_ASSERT(__CopyHeight);
+            GMM_RES_COPY_BLT *pBlt = pPending;
+            Lock.unlock();
+            uint8_t Result = pResInfo->CpuBlt(pBlt);
+            Lock.lock();
+
+            Success &= Result;
+            pPending = NULL;
+            Cv.notify_all();
+        }
+    }
+
+    GmmLib::GmmResourceInfoCommon *pResInfo;
+    GMM_RES_COPY_BLT *             pPending; // Band being BLT'ed; NULL when idle.
+    bool                           Quit;
+    uint8_t                        Success;
+    std::mutex                     Mutex;
+    std::condition_variable        Cv;
+    std::thread                    Thread;
+};
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Performs the BLT described by pBlt as a streaming session, passing the
+/// system memory side through the caller's callback in bands of whole tile rows
+/// instead of requiring the whole linear image in Sys.pData.
+///
+/// Two band buffers are used: with ::GMM_RES_COPY_BLT_STREAM::Overlap, band N
+/// is swizzled on a helper thread while the callback produces band N+1 (upload)
+/// or consumes band N-1 (download). Each band is an ordinary CpuBlt, so the
+/// result is bit-exact with CpuBlt() of the whole image.
+///
+/// pBlt->Sys.pData and Sys.BufferSize are ignored; Sys.RowPitch is the band row
+/// pitch (0 = packed, cache-line aligned). Planar surfaces and multi-sample
+/// BLTs aren't supported--stream those one plane or sample at a time.
+///
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT for more info.
+/// @param[in]  pStream: Band callback and controls. See ::GMM_RES_COPY_BLT_STREAM for more info.
+/// @return     1 if succeeded, 0 otherwise (including callback abort)
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuBltStream(GMM_RES_COPY_BLT *pBlt, const GMM_RES_COPY_BLT_STREAM *pStream)
+{
+    const GMM_PLATFORM_INFO *pPlatform;
+    GMM_TEXTURE_CALC *       pTextureCalc;
+    uint32_t                 BlockWidth, BlockHeight, BlockDepth;
+    uint32_t                 Width, RowPitch, TileHeight, BandRows, BandSize;
+    void *                   pBandAlloc;
+    char *                   pBands[2];
+    GMM_RES_COPY_BLT         BandBlt[2];
+    uint8_t                  CachePolicy, Success = 1, Continue = 1;
+#ifndef __GMM_KMD__
+    GmmCpuBltStreamWorker *pWorker = NULL;
+#endif
+
+    __GMM_ASSERTPTR(pBlt, 0);
+    __GMM_ASSERTPTR(pStream && pStream->pfnBand, 0);
+
+    if(GmmIsPlanar(Surf.Format) ||
+       Surf.Flags.Info.RedecribedPlanes ||
+       (pBlt->Blt.MsaaSamples > 1))
+    {
+        __GMM_ASSERT(0);
+        return 0;
+    }
+
+    pPlatform    = GMM_OVERRIDE_PLATFORM_INFO(&Surf, GetGmmLibContext());
+    pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
+
+    pTextureCalc->GetCompressionBlockDimensions(Surf.Format, &BlockWidth, &BlockHeight, &BlockDepth);
+
+    CachePolicy = GetCpuBltCachePolicy(pBlt);
+
+    Width = pBlt->Blt.Width ?
+            pBlt->Blt.Width :
+            (GFX_ULONG_CAST(GetMipWidth(pBlt->Gpu.MipLevel)) - pBlt->Gpu.OffsetX);
+
+    RowPitch = pBlt->Sys.RowPitch ?
+               pBlt->Sys.RowPitch :
+               GFX_ALIGN(GFX_CEIL_DIV(Width, BlockWidth) * (pBlt->Sys.PixelPitch ? pBlt->Sys.PixelPitch : (Surf.BitsPerPixel / CHAR_BIT)), 64);
+
+    TileHeight = Surf.Flags.Info.Linear ? 1 : pPlatform->TileInfo[Surf.TileMode].LogicalTileHeight;
+    __GMM_ASSERT(TileHeight);
+
+    BandRows = (pStream->BandTileRows ?
+                pStream->BandTileRows :
+                GFX_MAX(GMM_CPU_BLT_STREAM_BAND_SIZE / (RowPitch * TileHeight), 1u)) *
+               TileHeight;
+    BandSize = RowPitch * BandRows;
+
+    pBandAlloc = GMM_MALLOC(2 * BandSize + 63);
+    __GMM_ASSERTPTR(pBandAlloc, 0);
+    pBands[0] = (char *)GFX_ALIGN((uintptr_t)pBandAlloc, 64); // Cache-line aligned, so CpuSwizzleBlt can use its streaming paths.
+    pBands[1] = pBands[0] + BandSize;
+
+#ifndef __GMM_KMD__
+    if(pStream->Overlap)
+    {
+        try
+        {
+            pWorker = new GmmCpuBltStreamWorker(this);
+        }
+        catch(...)
+        {
+            pWorker = NULL; // Thread creation failure just means no overlap.
+        }
+    }
+#endif
+
+    // Start swizzle of band in BandBlt[i], and wait for it to finish...
+    auto Swizzle = [&](uint32_t i) {
+#ifndef __GMM_KMD__
+        if(pWorker)
+        {
+            pWorker->Submit(&BandBlt[i]);
+            return;
+        }
+#endif
+        Success &= CpuBlt(&BandBlt[i]);
+    };
+    auto Finish = [&]() {
+#ifndef __GMM_KMD__
+        if(pWorker)
+        {
+            Success &= pWorker->Wait();
+        }
+#endif
+    };
+
+    for(uint32_t Slice = 0; Continue && (Slice < GFX_MAX(pBlt->Blt.Slices, 1u)); Slice++)
+    {
+        GMM_RES_COPY_BLT    SliceBlt = *pBlt;
+        GMM_REQ_OFFSET_INFO ReqInfo  = {0};
+        uint32_t            Height, Rows, Y0, FirstRows, NumBands;
+
+        SliceBlt.Gpu.Slice       = pBlt->Gpu.Slice + Slice;
+        SliceBlt.Blt.Slices      = 1;
+        SliceBlt.Blt.CachePolicy = CachePolicy; // Whole-BLT policy, not per band.
+
+        if(GetCpuBltOffset(&Surf, &SliceBlt, ReqInfo) != GMM_SUCCESS)
+        {
+            __GMM_ASSERT(0);
+            Success = 0;
+            break;
+        }
+
+        Height = SliceBlt.Blt.Height ?
+                 SliceBlt.Blt.Height :
+                 (GetMipHeight(SliceBlt.Gpu.MipLevel) - SliceBlt.Gpu.OffsetY);
+
+        // Surface rows, and BLT's starting row within its tile row...
+        Rows = GFX_CEIL_DIV(Height, BlockHeight);
+        Y0   = (Surf.Flags.Info.Linear ? 0 : ReqInfo.Render.YOffset) + SliceBlt.Gpu.OffsetY / BlockHeight;
+
+        FirstRows = BandRows - (Y0 % TileHeight);
+        NumBands  = 1 + ((Rows > FirstRows) ? GFX_CEIL_DIV(Rows - FirstRows, BandRows) : 0);
+
+        auto SetupBand = [&](uint32_t Band) {
+            GMM_RES_COPY_BLT *pBandBlt = &BandBlt[Band % 2];
+            uint32_t          StartRow = Band ? (FirstRows + (Band - 1) * BandRows) : 0;
+            uint32_t          EndRow   = Band ? (StartRow + BandRows) : FirstRows;
+            uint32_t          StartY   = StartRow * BlockHeight;
+
+            *pBandBlt                = SliceBlt;
+            pBandBlt->Sys.pData      = pBands[Band % 2];
+            pBandBlt->Sys.RowPitch   = RowPitch;
+            pBandBlt->Sys.BufferSize = BandSize;
+            pBandBlt->Gpu.OffsetY += StartY;
+            pBandBlt->Blt.Width  = Width;
+            pBandBlt->Blt.Height = GFX_MIN(EndRow * BlockHeight, Height) - StartY;
+        };
+        auto Callback = [&](uint32_t Band) -> uint8_t {
+            GMM_RES_COPY_BLT *pBandBlt = &BandBlt[Band % 2];
+
+            return pStream->pfnBand(pStream->pStreamContext, Slice,
+                                    pBandBlt->Gpu.OffsetY - SliceBlt.Gpu.OffsetY, pBandBlt->Blt.Height,
+                                    pBandBlt->Sys.pData, RowPitch);
+        };
+
+        if(pBlt->Blt.Upload)
+        {
+            SetupBand(0);
+            Continue = Callback(0);
+            for(uint32_t Band = 0; Continue && (Band < NumBands); Band++)
+            {
+                Swizzle(Band % 2);
+                if(Band + 1 < NumBands)
+                {
+                    SetupBand(Band + 1);
+                    Continue = Callback(Band + 1);
+                }
+                Finish();
             }
-            else
+        }
+        else
+        {
+            SetupBand(0);
+            Swizzle(0);
+            Finish();
+            for(uint32_t Band = 0; Continue && (Band < NumBands); Band++)
             {
-                __CopyHeight = pBlt->Blt.Height;
+                if(Band + 1 < NumBands)
+                {
+                    SetupBand(Band + 1);
+                    Swizzle((Band + 1) % 2);
+                }
+                Continue = Callback(Band);
+                Finish();
             }
+        }
+    }
+
+#ifndef __GMM_KMD__
+    delete pWorker;
+#endif
+    GMM_FREE(pBandAlloc);
+
+    return Continue ? Success : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// CpuBltConvert row converters. Each converts Pixels pixels between a row of
+/// resource-format pixels (pRes) and a row of system-format pixels (pSys, plus
+/// pSys2 for two-plane system formats), in the direction given by Upload.
+/// System rows carry no alignment guarantee, so they're accessed via memcpy.
+/////////////////////////////////////////////////////////////////////////////////////
+typedef void (*GMM_CPU_BLT_CONVERT_ROW)(void *pRes, void *pSys, void *pSys2, uint32_t Pixels, uint8_t Upload);
+
+static void GmmCpuBltConvertSwapRB(void *pRes, void *pSys, void *pSys2, uint32_t Pixels, uint8_t Upload)
+{
+    const char *pSrc = (const char *)(Upload ? pSys : pRes);
+    char *      pDst = (char *)(Upload ? pRes : pSys);
+
+    GMM_UNREFERENCED_PARAMETER(pSys2);
+
+    for(uint32_t i = 0; i < Pixels; i++)
+    {
+        uint32_t Pixel;
+        memcpy(&Pixel, pSrc + i * 4, 4);
+        Pixel = (Pixel & 0xff00ff00) | ((Pixel >> 16) & 0xff) | ((Pixel & 0xff) << 16);
+        memcpy(pDst + i * 4, &Pixel, 4);
+    }
+}
+
+static void GmmCpuBltConvertRGB8ToRGBX8(void *pRes, void *pSys, void *pSys2, uint32_t Pixels, uint8_t Upload)
+{
+    uint8_t *pRGBX = (uint8_t *)pRes;
+    uint8_t *pRGB  = (uint8_t *)pSys;
+
+    GMM_UNREFERENCED_PARAMETER(pSys2);
+
+    if(Upload)
+    {
+        for(uint32_t i = 0; i < Pixels; i++)
+        {
+            pRGBX[i * 4 + 0] = pRGB[i * 3 + 0];
+            pRGBX[i * 4 + 1] = pRGB[i * 3 + 1];
+            pRGBX[i * 4 + 2] = pRGB[i * 3 + 2];
+            pRGBX[i * 4 + 3] = 0xff;
+        }
+    }
+    else
+    {
+        for(uint32_t i = 0; i < Pixels; i++)
+        {
+            pRGB[i * 3 + 0] = pRGBX[i * 4 + 0];
+            pRGB[i * 3 + 1] = pRGBX[i * 4 + 1];
+            pRGB[i * 3 + 2] = pRGBX[i * 4 + 2];
+        }
+    }
+}
+
+static void GmmCpuBltConvertSplitD24S8(void *pRes, void *pSys, void *pSys2, uint32_t Pixels, uint8_t Upload)
+{
+    char *   pD24S8 = (char *)pRes;
+    char *   pD24X8 = (char *)pSys;
+    uint8_t *pS8    = (uint8_t *)pSys2;
+
+    for(uint32_t i = 0; i < Pixels; i++)
+    {
+        uint32_t Pixel;
+
+        if(Upload)
+        {
+            memcpy(&Pixel, pD24X8 + i * 4, 4);
+            Pixel = (Pixel & 0x00ffffff) | ((uint32_t)pS8[i] << 24);
+            memcpy(pD24S8 + i * 4, &Pixel, 4);
+        }
+        else
+        {
+            memcpy(&Pixel, pD24S8 + i * 4, 4);
+            pS8[i] = (uint8_t)(Pixel >> 24);
+            Pixel &= 0x00ffffff;
+            memcpy(pD24X8 + i * 4, &Pixel, 4);
+        }
+    }
+}
+
+static const struct
+{
+    GMM_RESOURCE_FORMAT     SysFormat, ResFormat;
+    uint32_t                SysPixelPitch, Sys2PixelPitch;
+    GMM_CPU_BLT_CONVERT_ROW pfnConvert;
+} GmmCpuBltConverters[] =
+{
+    {GMM_FORMAT_B8G8R8A8_UNORM,      GMM_FORMAT_R8G8B8A8_UNORM,      4, 0, GmmCpuBltConvertSwapRB},
+    {GMM_FORMAT_R8G8B8A8_UNORM,      GMM_FORMAT_B8G8R8A8_UNORM,      4, 0, GmmCpuBltConvertSwapRB},
+    {GMM_FORMAT_B8G8R8A8_UNORM_SRGB, GMM_FORMAT_R8G8B8A8_UNORM_SRGB, 4, 0, GmmCpuBltConvertSwapRB},
+    {GMM_FORMAT_R8G8B8A8_UNORM_SRGB, GMM_FORMAT_B8G8R8A8_UNORM_SRGB, 4, 0, GmmCpuBltConvertSwapRB},
+    {GMM_FORMAT_B8G8R8X8_UNORM,      GMM_FORMAT_R8G8B8X8_UNORM,      4, 0, GmmCpuBltConvertSwapRB},
+    {GMM_FORMAT_R8G8B8X8_UNORM,      GMM_FORMAT_B8G8R8X8_UNORM,      4, 0, GmmCpuBltConvertSwapRB},
+    {GMM_FORMAT_R8G8B8_UNORM,        GMM_FORMAT_R8G8B8X8_UNORM,      3, 0, GmmCpuBltConvertRGB8ToRGBX8},
+    {GMM_FORMAT_R8G8B8_UNORM,        GMM_FORMAT_R8G8B8A8_UNORM,      3, 0, GmmCpuBltConvertRGB8ToRGBX8},
+    {GMM_FORMAT_D24_UNORM_X8_UINT,   GMM_FORMAT_R24G8_TYPELESS,      4, 1, GmmCpuBltConvertSplitD24S8},
+};
+
+/// Per-call state of a CpuBltConvert, passed to its CpuBltStream band callback.
+typedef struct GMM_CPU_BLT_CONVERT_CONTEXT_REC
+{
+    const GMM_RES_COPY_BLT *        pBlt;
+    const GMM_RES_COPY_BLT_CONVERT *pConvert;
+    uint32_t                        Width;
+    uint32_t                        SysPixelPitch, Sys2PixelPitch;
+    GMM_CPU_BLT_CONVERT_ROW         pfnConvert;
+} GMM_CPU_BLT_CONVERT_CONTEXT;
+
+static uint8_t GMM_STDCALL GmmCpuBltConvertBand(void *pStreamContext, uint32_t Slice, uint32_t FirstRow, uint32_t NumRows, void *pBand, uint32_t RowPitch)
+{
+    GMM_CPU_BLT_CONVERT_CONTEXT *   pContext = (GMM_CPU_BLT_CONVERT_CONTEXT *)pStreamContext;
+    const GMM_RES_COPY_BLT *        pBlt     = pContext->pBlt;
+    const GMM_RES_COPY_BLT_CONVERT *pConvert = pContext->pConvert;
+
+    for(uint32_t y = FirstRow; y < FirstRow + NumRows; y++)
+    {
+        char *pSysRow  = (char *)pBlt->Sys.pData + (size_t)Slice * pBlt->Sys.SlicePitch + (size_t)y * pBlt->Sys.RowPitch;
+        char *pSys2Row = pConvert->pData2 ?
+                         ((char *)pConvert->pData2 + (size_t)Slice * pConvert->SlicePitch2 + (size_t)y * pConvert->RowPitch2) :
+                         NULL;
+
+        __GMM_ASSERT((size_t)(pSysRow - (char *)pBlt->Sys.pData) + pContext->Width * pContext->SysPixelPitch <= pBlt->Sys.BufferSize);
+
+        pContext->pfnConvert((char *)pBand + (size_t)(y - FirstRow) * RowPitch, pSysRow, pSys2Row, pContext->Width, pBlt->Blt.Upload);
+    }
+
+    return 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Performs the same BLT as CpuBlt(), converting pixels between the system
+/// memory format (pConvert->SysFormat) and the resource's format along the way
+/// --e.g. BGRA to RGBA, RGB8 to RGBX8, or D24S8 to separate depth and stencil
+/// planes. See ::GMM_RES_COPY_BLT_CONVERT for supported pairs.
+///
+/// Conversion is fused with the swizzle at band granularity: the BLT runs as a
+/// CpuBltStream whose band callback converts between the caller's surface and
+/// the cache-resident band, so surface memory is still only traversed once.
+///
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT for more info.
+///                   Sys.PixelPitch and Blt.BytesPerPixel must be zero (implied by formats).
+/// @param[in]  pConvert: System memory format. See ::GMM_RES_COPY_BLT_CONVERT for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuBltConvert(GMM_RES_COPY_BLT *pBlt, const GMM_RES_COPY_BLT_CONVERT *pConvert)
+{
+    GMM_CPU_BLT_CONVERT_CONTEXT Context = {0};
+    GMM_RES_COPY_BLT_STREAM     Stream  = {0};
+    GMM_RES_COPY_BLT            StreamBlt;
+    uint8_t                     Success;
+
+    __GMM_ASSERTPTR(pBlt, 0);
+    __GMM_ASSERTPTR(pConvert, 0);
+    __GMM_ASSERT(!pBlt->Sys.PixelPitch && !pBlt->Blt.BytesPerPixel && !pBlt->Gpu.OffsetSubpixel); // Whole-pixel conversions only.
+
+    for(uint32_t i = 0; i < sizeof(GmmCpuBltConverters) / sizeof(GmmCpuBltConverters[0]); i++)
+    {
+        if((GmmCpuBltConverters[i].SysFormat == pConvert->SysFormat) &&
+           (GmmCpuBltConverters[i].ResFormat == Surf.Format))
+        {
+            Context.SysPixelPitch  = GmmCpuBltConverters[i].SysPixelPitch;
+            Context.Sys2PixelPitch = GmmCpuBltConverters[i].Sys2PixelPitch;
+            Context.pfnConvert     = GmmCpuBltConverters[i].pfnConvert;
+            break;
+        }
+    }
+
+    if(!Context.pfnConvert ||
+       (Context.Sys2PixelPitch && !pConvert->pData2))
+    {
+        __GMM_ASSERT(0); // Unsupported conversion, or missing second plane.
+        return 0;
+    }
+
+    Context.pBlt     = pBlt;
+    Context.pConvert = pConvert;
+    Context.Width    = pBlt->Blt.Width ?
+                       pBlt->Blt.Width :
+                       (GFX_ULONG_CAST(GetMipWidth(pBlt->Gpu.MipLevel)) - pBlt->Gpu.OffsetX);
+
+    Stream.pfnBand        = GmmCpuBltConvertBand;
+    Stream.pStreamContext = &Context;
+
+    // Bands hold resource-format pixels...
+    StreamBlt              = *pBlt;
+    StreamBlt.Sys.pData    = NULL;
+    StreamBlt.Sys.RowPitch = 0;
+    StreamBlt.Blt.Width    = Context.Width;
+
+    Success = CpuBltStream(&StreamBlt, &Stream);
+
+    pBlt->Blt.CachePolicyUsed = StreamBlt.Blt.CachePolicyUsed;
+
+    return Success;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Fills a rectangle of the resource with a pixel value or repeating pattern
+/// tile, as described by pFill.
+///
+/// The pattern is replicated into a few cache-resident rows, one per pattern
+/// row, each a whole number of 16-byte chunks wide, which CpuSwizzleFill then
+/// writes straight into the swizzled layout--no full-size linear source is
+/// built or read, as a CpuBlt of a filled buffer would.
+///
+/// @param[in]  pFill: Describes the fill operation. See ::GMM_RES_CPU_FILL for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuFill(GMM_RES_CPU_FILL *pFill)
+{
+    CPU_SWIZZLE_BLT_SURFACE PatternSurface = {0};
+    GMM_RES_COPY_BLT        Blt            = {0};
+    uint32_t                PixelBytes, PatternWidth, PatternHeight, PatternBytes, PatternPitch;
+    uint32_t                PeriodBytes, RowBytes;
+    void *                  pPatternAlloc;
+    char *                  pPattern;
+    uint8_t                 Success;
+
+    __GMM_ASSERTPTR(pFill, 0);
+    __GMM_ASSERTPTR(pFill->Gpu.pData && pFill->Pattern.pData, 0);
+
+    if(GmmIsPlanar(Surf.Format) ||
+       Surf.Flags.Info.RedecribedPlanes)
+    {
+        __GMM_ASSERT(0); // Planes have different pixel sizes--fill each as its own (e.g. R8/R8G8) resource.
+        return 0;
+    }
+
+    PixelBytes    = Surf.BitsPerPixel / CHAR_BIT;
+    PatternWidth  = GFX_MAX(pFill->Pattern.Width, 1u);
+    PatternHeight = GFX_MAX(pFill->Pattern.Height, 1u);
+    PatternBytes  = PatternWidth * PixelBytes;
+    PatternPitch  = pFill->Pattern.RowPitch ? pFill->Pattern.RowPitch : PatternBytes;
+    __GMM_ASSERT(PixelBytes && (PixelBytes <= 16));
+    __GMM_ASSERT(PatternPitch >= PatternBytes);
+
+    // Replicated rows: period is least common multiple of pattern and chunk
+    // widths, plus a chunk of slack so any chunk loads from within the row...
+    for(PeriodBytes = PatternBytes; PeriodBytes % 16; PeriodBytes += PatternBytes)
+        ;
+    RowBytes = PeriodBytes + 16;
+
+    pPatternAlloc = GMM_MALLOC(RowBytes * PatternHeight + 63);
+    __GMM_ASSERTPTR(pPatternAlloc, 0);
+    pPattern = (char *)GFX_ALIGN((uintptr_t)pPatternAlloc, 64);
+
+    for(uint32_t y = 0; y < PatternHeight; y++)
+    {
+        const char *pSrcRow = (const char *)pFill->Pattern.pData + y * PatternPitch;
+        char *      pRow    = pPattern + y * RowBytes;
+
+        for(uint32_t x = 0; x < RowBytes; x += PatternBytes)
+        {
+            memcpy(pRow + x, pSrcRow, GFX_MIN(PatternBytes, RowBytes - x));
+        }
+    }
+
+    PatternSurface.pBase  = pPattern;
+    PatternSurface.Pitch  = RowBytes;
+    PatternSurface.Height = PatternHeight;
+
+    Blt.Gpu.pData       = pFill->Gpu.pData;
+    Blt.Gpu.Slice       = pFill->Gpu.Slice;
+    Blt.Gpu.MipLevel    = pFill->Gpu.MipLevel;
+    Blt.Gpu.OffsetX     = pFill->Gpu.OffsetX;
+    Blt.Gpu.OffsetY     = pFill->Gpu.OffsetY;
+    Blt.Blt.Width       = pFill->Fill.Width;
+    Blt.Blt.Height      = pFill->Fill.Height;
+    Blt.Blt.Slices      = pFill->Fill.Slices;
+    Blt.Blt.MsaaSamples = GFX_MAX(Surf.MSAA.NumSamples, 1u);
+    Blt.Blt.Upload      = 1;
+    Blt.Blt.CachePolicy = pFill->Fill.CachePolicy;
+
+    Success = CpuBltInternal(&Blt, NULL, &PatternSurface, PeriodBytes, NULL, 0);
+
+    pFill->Fill.CachePolicyUsed = Blt.Blt.CachePolicyUsed;
+
+    GMM_FREE(pPatternAlloc);
+
+    return Success;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the number of CpuBlt slices (Gpu.Slice values) of a MIP--array
+/// slices, cube faces of all cubes, or volume slices of the MIP.
+///
+/// @param[in]  pTextureCalc: Texture calculator of the resource
+/// @param[in]  pTexInfo: Resource's surface
+/// @param[in]  MipLevel: MIP
+/// @return     Number of slices
+/////////////////////////////////////////////////////////////////////////////////////
+static uint32_t GmmCpuBltMipSlices(GMM_TEXTURE_CALC *pTextureCalc, GMM_TEXTURE_INFO *pTexInfo, uint32_t MipLevel)
+{
+    switch(pTexInfo->Type)
+    {
+        case RESOURCE_3D:
+            return pTextureCalc->GmmTexGetMipDepth(pTexInfo, MipLevel);
+        case RESOURCE_CUBE:
+            return GFX_MAX(pTexInfo->ArraySize, 1u) * 6;
+        default:
+            return GFX_MAX(pTexInfo->ArraySize, 1u);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Describes the packed system memory image of the whole resource, as
+/// CpuBltSubresources() uses without a subresource table: MIP-major (KTX
+/// order)--one entry per MIP, holding all its slices back to back--with
+/// unpadded rows (compression-block rows for compressed formats) and slices.
+///
+/// @param[out] pSubresources: Receives *pNumSubresources entries; NULL to just size.
+/// @param[out] pNumSubresources: Receives number of entries (MIP levels); may be NULL.
+/// @return     Size in bytes of the packed image, or 0 if not supported (planar).
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_GFX_SIZE_T GMM_STDCALL GmmLib::GmmResourceInfoCommon::GetCpuBltSubresourceLayout(GMM_RES_COPY_BLT_SUBRESOURCE *pSubresources, uint32_t *pNumSubresources)
+{
+    GMM_TEXTURE_CALC *pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
+    uint32_t          BlockWidth, BlockHeight, BlockDepth;
+    GMM_GFX_SIZE_T    Offset = 0;
+
+    if(GmmIsPlanar(Surf.Format) ||
+       Surf.Flags.Info.RedecribedPlanes)
+    {
+        __GMM_ASSERT(0); // CpuBlt full-size subresources not defined for planars.
+        return 0;
+    }
+
+    pTextureCalc->GetCompressionBlockDimensions(Surf.Format, &BlockWidth, &BlockHeight, &BlockDepth);
+
+    for(uint32_t MipLevel = 0; MipLevel <= Surf.MaxLod; MipLevel++)
+    {
+        uint32_t       RowPitch   = GFX_ULONG_CAST(GFX_CEIL_DIV(GetMipWidth(MipLevel), BlockWidth)) * (Surf.BitsPerPixel / CHAR_BIT);
+        uint32_t       Slices     = GmmCpuBltMipSlices(pTextureCalc, &Surf, MipLevel);
+        GMM_GFX_SIZE_T SlicePitch = (GMM_GFX_SIZE_T)RowPitch * GFX_CEIL_DIV(GetMipHeight(MipLevel), BlockHeight) * GFX_MAX(Surf.MSAA.NumSamples, 1u);
+
+        if(pSubresources)
+        {
+            pSubresources[MipLevel].MipLevel   = MipLevel;
+            pSubresources[MipLevel].Slice      = 0;
+            pSubresources[MipLevel].Slices     = Slices;
+            pSubresources[MipLevel].RowPitch   = RowPitch;
+            pSubresources[MipLevel].SlicePitch = SlicePitch;
+            pSubresources[MipLevel].Offset     = Offset;
+        }
+
+        Offset += SlicePitch * Slices;
+    }
+
+    if(pNumSubresources)
+    {
+        *pNumSubresources = Surf.MaxLod + 1;
+    }
+
+    return Offset;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Per-call state shared by the tasks of a CpuBltSubresources or CpuBltPlanar.
+/////////////////////////////////////////////////////////////////////////////////////
+typedef struct GMM_CPU_BLT_SUBRESOURCE_TASKS_REC
+{
+    GmmLib::GmmResourceInfoCommon *pResInfo;
+    GMM_RES_COPY_BLT *             pBlts;    // Single-slice BLT per task.
+    GMM_REQ_OFFSET_INFO *          pOffsets; // Their precomputed offsets, or NULL.
+#ifndef __GMM_KMD__
+    std::atomic<uint8_t>           Success;
+#else
+    volatile LONG                  Success;  // Interlocked--no <atomic> in KMD.
+#endif
+} GMM_CPU_BLT_SUBRESOURCE_TASKS;
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Performs one subresource (or plane band) BLT of a CpuBltSubresources (or
+/// CpuBltPlanar).
+///
+/// @param[in]  pTaskContext: ::GMM_CPU_BLT_SUBRESOURCE_TASKS
+/// @param[in]  TaskIndex: Index of the BLT
+/////////////////////////////////////////////////////////////////////////////////////
+void GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuBltSubresourcesTask(void *pTaskContext, uint32_t TaskIndex)
+{
+    GMM_CPU_BLT_SUBRESOURCE_TASKS *pTasks = (GMM_CPU_BLT_SUBRESOURCE_TASKS *)pTaskContext;
+
+    if(!pTasks->pResInfo->CpuBltInternal(&pTasks->pBlts[TaskIndex],
+                                         pTasks->pOffsets ? &pTasks->pOffsets[TaskIndex] : NULL,
+                                         NULL, 0, NULL, 0))
+    {
+#ifndef __GMM_KMD__
+        pTasks->Success.store(0, std::memory_order_relaxed);
+#else
+        InterlockedExchange(&pTasks->Success, 0);
+#endif
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Performs CPU BLT's of a set of whole subresources (e.g. every MIP of every
+/// array slice, for texture streaming) between the resource and one packed
+/// system memory image, described by a subresource table (e.g. a KTX/DDS
+/// file's) or, without one, by GetCpuBltSubresourceLayout().
+///
+/// The table is validated against the resource and image up front, so a bad
+/// table (e.g. from a file) fails without touching either. Every subresource's
+/// BLT and destination offset are then computed once, and the BLT's run back
+/// to back--or, with Blt.pParallel, concurrently: small subresources (e.g. MIP
+/// tails) as tasks of their own, and any subresource too large to balance that
+/// way banded by CpuBltParallel(). Subresources are disjoint bytes of the
+/// resource, so the result is bit-exact with the serial BLT's.
+///
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT_SUBRESOURCES for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuBltSubresources(GMM_RES_COPY_BLT_SUBRESOURCES *pBlt)
+{
+    GMM_TEXTURE_CALC *                  pTextureCalc;
+    GMM_RES_COPY_BLT_SUBRESOURCE *      pPacked = NULL;
+    const GMM_RES_COPY_BLT_SUBRESOURCE *pTable;
+    GMM_CPU_BLT_SUBRESOURCE_TASKS       Tasks   = {0};
+    uint32_t                            BlockWidth, BlockHeight, BlockDepth;
+    uint32_t                            PixelBytes, NumSamples, NumEntries, NumBlts, NumSmall, NumLarge;
+    uint32_t                            MaxThreads = 1;
+    uint64_t                            TransferBytes = 0;
+    uint8_t                             CachePolicy, Success = 1;
+
+    __GMM_ASSERTPTR(pBlt, 0);
+    __GMM_ASSERTPTR(pBlt->Gpu.pData && pBlt->Sys.pData, 0);
+
+    if(GmmIsPlanar(Surf.Format) ||
+       Surf.Flags.Info.RedecribedPlanes)
+    {
+        __GMM_ASSERT(0); // Planes aren't whole-subresource BLT's--use CpuBlt per plane.
+        return 0;
+    }
+
+    pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
+    pTextureCalc->GetCompressionBlockDimensions(Surf.Format, &BlockWidth, &BlockHeight, &BlockDepth);
+    PixelBytes = Surf.BitsPerPixel / CHAR_BIT;
+    NumSamples = GFX_MAX(Surf.MSAA.NumSamples, 1u);
+
+    pTable     = pBlt->Blt.pSubresources;
+    NumEntries = pBlt->Blt.NumSubresources;
+    if(!pTable)
+    {
+        GetCpuBltSubresourceLayout(NULL, &NumEntries);
+        pPacked = (GMM_RES_COPY_BLT_SUBRESOURCE *)GMM_MALLOC(NumEntries * sizeof(*pPacked));
+        __GMM_ASSERTPTR(pPacked, 0);
+        GetCpuBltSubresourceLayout(pPacked, &NumEntries);
+        pTable = pPacked;
+    }
 
-            __CopyHeight = GFX_CEIL_DIV(__CopyHeight, BlockHeight);
+    // Validate table and size BLT...
+    NumBlts = 0;
+    for(uint32_t i = 0; i < NumEntries; i++)
+    {
+        const GMM_RES_COPY_BLT_SUBRESOURCE *pEntry = &pTable[i];
+        uint32_t                            Slices, RowBytes, Rows;
+        uint64_t                            RowPitch, SamplePitch, SlicePitch, Extent;
+
+        if(pEntry->MipLevel > Surf.MaxLod)
+        {
+            __GMM_ASSERT(0);
+            Success = 0;
+            break;
         }
 
-        __GMM_ASSERT((pBlt->Gpu.OffsetX % BlockWidth) == 0);
-        __OffsetXBytes = (pBlt->Gpu.OffsetX / BlockWidth) * ResPixelPitch + pBlt->Gpu.OffsetSubpixel;
+        Slices      = GFX_MAX(pEntry->Slices, 1u);
+        RowBytes    = GFX_ULONG_CAST(GFX_CEIL_DIV(GetMipWidth(pEntry->MipLevel), BlockWidth)) * PixelBytes;
+        Rows        = GFX_CEIL_DIV(GetMipHeight(pEntry->MipLevel), BlockHeight);
+        RowPitch    = pEntry->RowPitch ? pEntry->RowPitch : RowBytes;
+        SamplePitch = RowPitch * Rows;
+        SlicePitch  = pEntry->SlicePitch ? pEntry->SlicePitch : (SamplePitch * NumSamples);
+        Extent      = pEntry->Offset + (Slices - 1) * SlicePitch + (NumSamples - 1) * SamplePitch + (Rows - 1) * RowPitch + RowBytes;
+
+        if(((uint64_t)pEntry->Slice + Slices > GmmCpuBltMipSlices(pTextureCalc, &Surf, pEntry->MipLevel)) ||
+           (RowPitch < RowBytes) ||
+           ((Slices > 1) && (SlicePitch < SamplePitch * NumSamples)) ||
+           (SamplePitch > UINT32_MAX) || // Sys.MsaaSamplePitch
+           (Extent > pBlt->Sys.BufferSize))
+        {
+            __GMM_ASSERT(0);
+            Success = 0;
+            break;
+        }
 
-        __GMM_ASSERT((pBlt->Gpu.OffsetY % BlockHeight) == 0);
-        __OffsetY = (pBlt->Gpu.OffsetY / BlockHeight);
+        NumBlts += Slices;
+        TransferBytes += (uint64_t)RowBytes * Rows * NumSamples * Slices;
+    }
+
+    if(!Success || !NumBlts)
+    {
+        GMM_FREE(pPacked);
+        return Success;
+    }
+
+    // Whole-BLT cache policy, not per subresource...
+    CachePolicy                = GetCpuBltCachePolicy(pBlt->Blt.CachePolicy, TransferBytes);
+    pBlt->Blt.CachePolicyUsed = CachePolicy;
+
+    if(pBlt->Blt.pParallel)
+    {
+        MaxThreads = GmmTaskMaxThreads(pBlt->Blt.pParallel);
+    }
+
+    Tasks.pResInfo = this;
+    Tasks.pBlts    = (GMM_RES_COPY_BLT *)GMM_MALLOC(NumBlts * sizeof(*Tasks.pBlts));
+    Tasks.pOffsets = (GMM_REQ_OFFSET_INFO *)GMM_MALLOC(NumBlts * sizeof(*Tasks.pOffsets));
+    Tasks.Success  = 1;
+    if(!Tasks.pBlts || !Tasks.pOffsets)
+    {
+        __GMM_ASSERT(0);
+        GMM_FREE(Tasks.pBlts);
+        GMM_FREE(Tasks.pOffsets);
+        GMM_FREE(pPacked);
+        return 0;
+    }
+    memset(Tasks.pBlts, 0, NumBlts * sizeof(*Tasks.pBlts));
+    memset(Tasks.pOffsets, 0, NumBlts * sizeof(*Tasks.pOffsets));
 
-        { // Get pResData Offsets to this subresource...
-            GetOffset.ReqLock      = pTexInfo->Flags.Info.Linear;
-            GetOffset.ReqStdLayout = !GetOffset.ReqLock && pTexInfo->Flags.Info.StdSwizzle;
-            GetOffset.ReqRender    = !GetOffset.ReqLock && !GetOffset.ReqStdLayout;
-            GetOffset.MipLevel     = pBlt->Gpu.MipLevel;
-            switch(pTexInfo->Type)
+    // Build each slice's BLT and offsets once. When parallel, slices too large
+    // to balance as single tasks go at the end, to be banded instead...
+    NumSmall = NumLarge = 0;
+    for(uint32_t i = 0; i < NumEntries; i++)
+    {
+        const GMM_RES_COPY_BLT_SUBRESOURCE *pEntry = &pTable[i];
+        uint32_t                            RowBytes, Rows;
+        uint64_t                            RowPitch, SamplePitch, SlicePitch, SliceBytes;
+
+        RowBytes    = GFX_ULONG_CAST(GFX_CEIL_DIV(GetMipWidth(pEntry->MipLevel), BlockWidth)) * PixelBytes;
+        Rows        = GFX_CEIL_DIV(GetMipHeight(pEntry->MipLevel), BlockHeight);
+        RowPitch    = pEntry->RowPitch ? pEntry->RowPitch : RowBytes;
+        SamplePitch = RowPitch * Rows;
+        SlicePitch  = pEntry->SlicePitch ? pEntry->SlicePitch : (SamplePitch * NumSamples);
+        SliceBytes  = (uint64_t)RowBytes * Rows * NumSamples;
+
+        for(uint32_t Slice = 0; Slice < GFX_MAX(pEntry->Slices, 1u); Slice++)
+        {
+            uint64_t          SysOffset = pEntry->Offset + Slice * SlicePitch;
+            uint32_t          Index     = ((MaxThreads > 1) && (SliceBytes * MaxThreads > TransferBytes)) ?
+                                          (NumBlts - ++NumLarge) :
+                                          NumSmall++;
+            GMM_RES_COPY_BLT *pSliceBlt = &Tasks.pBlts[Index];
+
+            pSliceBlt->Gpu.pData           = pBlt->Gpu.pData;
+            pSliceBlt->Gpu.MipLevel        = pEntry->MipLevel;
+            pSliceBlt->Gpu.Slice           = pEntry->Slice + Slice;
+            pSliceBlt->Sys.pData           = (char *)pBlt->Sys.pData + SysOffset;
+            pSliceBlt->Sys.RowPitch        = GFX_ULONG_CAST(RowPitch);
+            pSliceBlt->Sys.MsaaSamplePitch = GFX_ULONG_CAST(SamplePitch);
+            pSliceBlt->Sys.BufferSize      = GFX_ULONG_CAST(GFX_MIN(pBlt->Sys.BufferSize - SysOffset, (uint64_t)UINT32_MAX));
+            pSliceBlt->Blt.MsaaSamples     = NumSamples;
+            pSliceBlt->Blt.Upload          = pBlt->Blt.Upload;
+            pSliceBlt->Blt.CachePolicy     = CachePolicy;
+
+            if(GetCpuBltOffset(&Surf, pSliceBlt, Tasks.pOffsets[Index]) != GMM_SUCCESS)
             {
-                case RESOURCE_1D:
-                case RESOURCE_2D:
-                case RESOURCE_PRIMARY:
-                {
-                    GetOffset.ArrayIndex = pBlt->Gpu.Slice;
-                    break;
-                }
-                case RESOURCE_CUBE:
-                {
-                    GetOffset.ArrayIndex = pBlt->Gpu.Slice / 6;
-                    GetOffset.CubeFace   = (GMM_CUBE_FACE_ENUM)(pBlt->Gpu.Slice % 6);
-                    break;
-                }
-                case RESOURCE_3D:
-                {
-                    GetOffset.Slice = (GMM_IS_64KB_TILE(pTexInfo->Flags) || pTexInfo->Flags.Info.TiledYf) ?
-                                      (pBlt->Gpu.Slice / pPlatform->TileInfo[pTexInfo->TileMode].LogicalTileDepth) :
-                                      pBlt->Gpu.Slice;
-                    break;
-                }
-                default:
-                    __GMM_ASSERT(0);
+                __GMM_ASSERT(0);
+                Success = 0;
             }
+        }
+    }
 
-            REQUIRE(this->GetOffset(GetOffset) == GMM_SUCCESS);
+    if(Success)
+    {
+        if(NumSmall > 1)
+        {
+            GmmRunTasks(pBlt->Blt.pParallel, MaxThreads, NumSmall, CpuBltSubresourcesTask, &Tasks);
+        }
+        else if(NumSmall)
+        {
+            CpuBltSubresourcesTask(&Tasks, 0);
         }
+        Success = !!Tasks.Success;
 
-        if(pTexInfo->Flags.Info.Linear)
+        for(uint32_t i = NumSmall; i < NumBlts; i++)
         {
-            char *   pDest, *pSrc;
-            uint32_t DestPitch, SrcPitch;
-            uint32_t y;
+            Success &= CpuBltParallel(&Tasks.pBlts[i], pBlt->Blt.pParallel);
+        }
+    }
 
-            __GMM_ASSERT( // Linear-to-linear subpixel BLT unexpected--Not implemented.
-            (!pBlt->Sys.PixelPitch || (pBlt->Sys.PixelPitch == ResPixelPitch)) &&
-            (!pBlt->Blt.BytesPerPixel || (pBlt->Blt.BytesPerPixel == ResPixelPitch)));
+    GMM_FREE(Tasks.pBlts);
+    GMM_FREE(Tasks.pOffsets);
+    GMM_FREE(pPacked);
 
-            if(pBlt->Blt.Upload)
-            {
-                pDest     = (char *)pBlt->Gpu.pData;
-                DestPitch = GFX_ULONG_CAST(pTexInfo->Pitch);
+    return Success;
+}
 
-                pSrc     = (char *)pBlt->Sys.pData;
-                SrcPitch = pBlt->Sys.RowPitch;
-            }
-            else
-            {
-                pDest     = (char *)pBlt->Sys.pData;
-                DestPitch = pBlt->Sys.RowPitch;
+// Most tasks a CpuBltPlanar splits a frame into.
+#define GMM_CPU_BLT_PLANAR_MAX_TASKS 8
 
-                pSrc     = (char *)pBlt->Gpu.pData;
-                SrcPitch = GFX_ULONG_CAST(pTexInfo->Pitch);
-            }
+/////////////////////////////////////////////////////////////////////////////////////
+/// Performs a CPU BLT of a whole frame of a two-plane, UV-packed YUV resource
+/// (NV12, P010, P016, etc.) to/from separate system memory Y and UV planes.
+///
+/// Unlike a monolithic CpuBlt of the frame, which recurses per plane through
+/// GetBltInfoPerPlane and recomputes the subresource offset for each, plane
+/// geometry and offset are derived once per call and each plane BLT runs
+/// directly. With Blt.pParallel, the planes are split into bands of whole tile
+/// rows about the size of the UV plane, and the Y and UV bands run
+/// concurrently--the planes start on tile-row boundaries, so no two bands
+/// share a swizzled cache line.
+///
+/// Resources with redescribed planes (TileYf/64KB-tiled planars), whose UV
+/// plane has its own tile layout, are not supported--use CpuBlt per plane.
+///
+/// @param[in]  pBlt: Describes the blit operation. See ::GMM_RES_COPY_BLT_PLANAR for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuBltPlanar(GMM_RES_COPY_BLT_PLANAR *pBlt)
+{
+    const GMM_PLATFORM_INFO *     pPlatform;
+    GMM_TEXTURE_CALC *            pTextureCalc;
+    GMM_RES_COPY_BLT              PlaneBlt[2] = {};
+    GMM_RES_COPY_BLT              TaskBlt[GMM_CPU_BLT_PLANAR_MAX_TASKS];
+    GMM_REQ_OFFSET_INFO           Offset = {0}, TaskOffset[GMM_CPU_BLT_PLANAR_MAX_TASKS];
+    GMM_CPU_BLT_SUBRESOURCE_TASKS Tasks = {0};
+    uint32_t                      PixelBytes, TileHeight, BandRows, NumTasks, MaxThreads = 1;
+    uint64_t                      TransferBytes = 0;
+    uint8_t                       CachePolicy;
 
-            __GMM_ASSERT(GetOffset.Lock.Offset < pTexInfo->Size);
-            pDest += GetOffset.Lock.Offset + (__OffsetY * DestPitch + __OffsetXBytes);
+    __GMM_ASSERTPTR(pBlt, 0);
+    __GMM_ASSERTPTR(pBlt->Gpu.pData && pBlt->Sys.pY && pBlt->Sys.pUV, 0);
 
-            for(y = 0; y < __CopyHeight; y++)
-            {
-// Memcpy per row isn't optimal, but doubt this linear-to-linear path matters.
+    pPlatform    = GMM_OVERRIDE_PLATFORM_INFO(&Surf, GetGmmLibContext());
+    pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
 
-#if _WIN32
-#ifdef __GMM_KMD__
-                GFX_MEMCPY_S
-#else
-                memcpy_s
-#endif
-                (pDest, __CopyWidthBytes, pSrc, __CopyWidthBytes);
-#else
-                memcpy(pDest, pSrc, __CopyWidthBytes);
-#endif
-                pDest += DestPitch;
-                pSrc += SrcPitch;
-            }
-        }
-        else // Swizzled BLT...
+    if(!GmmIsPlanar(Surf.Format) ||
+       !GmmIsUVPacked(Surf.Format) ||
+       (pTextureCalc->GetNumberOfPlanes(&Surf) != 2) ||
+       Surf.Flags.Info.RedecribedPlanes)
+    {
+        __GMM_ASSERT(0);
+        return 0;
+    }
+
+    // Plane geometry...
+    PixelBytes = Surf.BitsPerPixel / CHAR_BIT;
+    for(uint32_t i = 0; i < 2; i++)
+    {
+        GMM_RES_COPY_BLT *pPlaneBlt = &PlaneBlt[i];
+
+        pTextureCalc->GetBltInfoPerPlane(&Surf, pPlaneBlt, i ? GMM_PLANE_U : GMM_PLANE_Y);
+
+        pPlaneBlt->Gpu.pData      = pBlt->Gpu.pData;
+        pPlaneBlt->Gpu.Slice      = pBlt->Gpu.Slice;
+        pPlaneBlt->Blt.Width      = GFX_ULONG_CAST(i ? GFX_ALIGN(Surf.BaseWidth, 2) : Surf.BaseWidth); // Chroma in whole pairs.
+        pPlaneBlt->Sys.pData      = i ? pBlt->Sys.pUV : pBlt->Sys.pY;
+        pPlaneBlt->Sys.RowPitch   = i ? pBlt->Sys.UVRowPitch : pBlt->Sys.YRowPitch;
+        pPlaneBlt->Sys.RowPitch   = pPlaneBlt->Sys.RowPitch ? pPlaneBlt->Sys.RowPitch : (pPlaneBlt->Blt.Width * PixelBytes);
+        pPlaneBlt->Sys.BufferSize = pPlaneBlt->Sys.RowPitch * pPlaneBlt->Blt.Height;
+        pPlaneBlt->Blt.Upload     = pBlt->Blt.Upload;
+
+        TransferBytes += (uint64_t)pPlaneBlt->Blt.Width * PixelBytes * pPlaneBlt->Blt.Height;
+    }
+
+    // Whole-frame cache policy and subresource offset...
+    CachePolicy                = GetCpuBltCachePolicy(pBlt->Blt.CachePolicy, TransferBytes);
+    pBlt->Blt.CachePolicyUsed = CachePolicy;
+
+    if(GetCpuBltOffset(&Surf, &PlaneBlt[0], Offset) != GMM_SUCCESS)
+    {
+        __GMM_ASSERT(0);
+        return 0;
+    }
+
+    // Bands: whole planes, or in parallel, tile rows about the UV plane's
+    // size--Y and UV bands then balance...
+    TileHeight = Surf.Flags.Info.Linear ? 1 : pPlatform->TileInfo[Surf.TileMode].LogicalTileHeight;
+    BandRows   = UINT32_MAX;
+    if(pBlt->Blt.pParallel)
+    {
+        MaxThreads = GmmTaskMaxThreads(pBlt->Blt.pParallel);
+    }
+    if((MaxThreads > 1) &&
+       TileHeight &&
+       !(PlaneBlt[0].Gpu.OffsetY % TileHeight) &&
+       !(PlaneBlt[1].Gpu.OffsetY % TileHeight)) // Planes don't share tile rows.
+    {
+        BandRows = GFX_MAX(PlaneBlt[1].Blt.Height, GFX_CEIL_DIV(PlaneBlt[0].Blt.Height, GMM_CPU_BLT_PLANAR_MAX_TASKS - 2));
+        BandRows = GFX_ALIGN(BandRows, TileHeight);
+    }
+
+    NumTasks = 0;
+    for(uint32_t i = 0; i < 2; i++)
+    {
+        uint32_t Rows;
+
+        for(uint32_t Row = 0; Row < PlaneBlt[i].Blt.Height; Row += Rows)
         {
-            CPU_SWIZZLE_BLT_SURFACE LinearSurface = {0}, SwizzledSurface;
-            uint32_t                ZOffset       = 0;
+            GMM_RES_COPY_BLT *pTaskBlt = &TaskBlt[NumTasks];
 
-            __GMM_ASSERT(GetOffset.Render.Offset64 < pTexInfo->Size);
+            __GMM_ASSERT(NumTasks < GMM_CPU_BLT_PLANAR_MAX_TASKS);
 
-            ZOffset = (pTexInfo->Type == RESOURCE_3D &&
-                       (GMM_IS_64KB_TILE(pTexInfo->Flags) || pTexInfo->Flags.Info.TiledYf)) ?
-                      (pBlt->Gpu.Slice % pPlatform->TileInfo[pTexInfo->TileMode].LogicalTileDepth) :
-                      0;
+            Rows      = GFX_MIN(BandRows, PlaneBlt[i].Blt.Height - Row);
+            *pTaskBlt = PlaneBlt[i];
+            pTaskBlt->Gpu.OffsetY += Row;
+            pTaskBlt->Blt.Height = Rows;
+            pTaskBlt->Sys.pData  = (char *)pTaskBlt->Sys.pData + (size_t)Row * pTaskBlt->Sys.RowPitch;
+            pTaskBlt->Sys.BufferSize -= Row * pTaskBlt->Sys.RowPitch;
+            pTaskBlt->Blt.CachePolicy = CachePolicy;
 
-            if(pTexInfo->Flags.Info.StdSwizzle == 1)
-            {
-                SwizzledSurface.pBase   = (char *)pBlt->Gpu.pData + GFX_ULONG_CAST(GetOffset.StdLayout.Offset);
-                SwizzledSurface.OffsetX = __OffsetXBytes;
-                SwizzledSurface.OffsetY = __OffsetY;
-                SwizzledSurface.OffsetZ = ZOffset;
+            TaskOffset[NumTasks++] = Offset;
+        }
+    }
 
-                uint32_t MipWidth  = GFX_ULONG_CAST(pTextureCalc->GmmTexGetMipWidth(pTexInfo, pBlt->Gpu.MipLevel));
-                uint32_t MipHeight = pTextureCalc->GmmTexGetMipHeight(pTexInfo, pBlt->Gpu.MipLevel);
+    Tasks.pResInfo = this;
+    Tasks.pBlts    = TaskBlt;
+    Tasks.pOffsets = TaskOffset;
+    Tasks.Success  = 1;
 
-                pTextureCalc->AlignTexHeightWidth(pTexInfo, &MipHeight, &MipWidth);
-                SwizzledSurface.Height = MipHeight;
-                SwizzledSurface.Pitch  = MipWidth * ResPixelPitch;
-            }
-            else
-            {
-                SwizzledSurface.pBase   = (char *)pBlt->Gpu.pData + GFX_ULONG_CAST(GetOffset.Render.Offset64);
-                SwizzledSurface.Pitch   = GFX_ULONG_CAST(pTexInfo->Pitch);
-                SwizzledSurface.OffsetX = GetOffset.Render.XOffset + __OffsetXBytes;
-                SwizzledSurface.OffsetY = GetOffset.Render.YOffset + __OffsetY;
-                SwizzledSurface.OffsetZ = GetOffset.Render.ZOffset + ZOffset;
-                SwizzledSurface.Height  = GFX_ULONG_CAST(pTexInfo->Size / pTexInfo->Pitch);
-            }
+    if((MaxThreads > 1) && (NumTasks > 1))
+    {
+        GmmRunTasks(pBlt->Blt.pParallel, MaxThreads, NumTasks, CpuBltSubresourcesTask, &Tasks);
+    }
+    else
+    {
+        for(uint32_t i = 0; i < NumTasks; i++)
+        {
+            CpuBltSubresourcesTask(&Tasks, i);
+        }
+    }
 
-            SwizzledSurface.Element.Pitch = ResPixelPitch;
+    return !!Tasks.Success;
+}
 
-            LinearSurface.pBase = pBlt->Sys.pData;
-            LinearSurface.Pitch = pBlt->Sys.RowPitch;
-            LinearSurface.Height =
-            pBlt->Sys.BufferSize /
-            (pBlt->Sys.RowPitch ?
-             pBlt->Sys.RowPitch :
-             pBlt->Sys.BufferSize);
-            LinearSurface.Element.Pitch =
-            pBlt->Sys.PixelPitch ?
-            pBlt->Sys.PixelPitch :
-            ResPixelPitch;
-            LinearSurface.Element.Size =
-            SwizzledSurface.Element.Size =
-            pBlt->Blt.BytesPerPixel ?
-            pBlt->Blt.BytesPerPixel :
-            ResPixelPitch;
+// CpuSwizzleBlt's widest swizzled transfer chunk--16 bytes x 4 rows, a whole
+// cache line of TileY/Tile4/Tile64--to which MayOvercopy rects are widened, so
+// their edges take no crust transfers.
+#define GMM_CPU_BLT_RECTS_SNAP_BYTES 16
+#define GMM_CPU_BLT_RECTS_SNAP_ROWS 4
 
-            SwizzledSurface.pSwizzle = NULL;
+// Overcopy a MayOvercopy merge may add, in bytes--about what the setup and
+// crust of a separate rect cost.
+#define GMM_CPU_BLT_RECTS_MERGE_SLACK_BYTES 512
 
-            if(pTexInfo->Flags.Info.TiledW)
-            {
-                SwizzledSurface.pSwizzle = &INTEL_TILE_W;
+// Rects merged without a heap allocation.
+#define GMM_CPU_BLT_RECTS_LOCAL 32
 
-                // Correct for GMM's 2x Pitch handling of stencil...
-                // (Unlike the HW, CpuSwizzleBlt handles TileW as a natural,
-                // 64x64=4KB tile, so the pre-Gen10 "double-pitch/half-height"
-                // kludging to TileY shape must be reversed.)
-                __GMM_ASSERT((SwizzledSurface.Pitch % 2) == 0);
-                SwizzledSurface.Pitch /= 2;
-                SwizzledSurface.Height *= 2;
-            }
-            else if(GMM_IS_4KB_TILE(pTexInfo->Flags) &&
-                    !(pTexInfo->Flags.Info.TiledYf ||
-                      GMM_IS_64KB_TILE(pTexInfo->Flags)))
-            {
-                if(GetGmmLibContext()->GetSkuTable().FtrTileY)
-                 {
-                    SwizzledSurface.pSwizzle = &INTEL_TILE_Y;
-                }
-                else
-                {
-                    SwizzledSurface.pSwizzle = &INTEL_TILE_4;
-                }
-            }
-            else if(pTexInfo->Flags.Info.TiledX)
-            {
-                SwizzledSurface.pSwizzle = &INTEL_TILE_X;
-            }
-            else // Yf/s...
-            {
-// clang-format off
-                #define NA
+/////////////////////////////////////////////////////////////////////////////////////
+/// Performs a CPU BLT of a set of damaged rectangles within a GMM_RES_COPY_BLT's
+/// rectangle (e.g. a compositor's per-frame damage), in a single call. Rects
+/// are clipped to the BLT rectangle and merged (see ::GMM_RES_COPY_BLT_RECTS),
+/// and then share one validation, offset computation, cache policy and swizzle
+/// setup, rather than paying for each in a CpuBlt per rect.
+///
+/// @param[in]  pBlt: Describes the blit operation and the rectangle pRects are
+///                   relative to. See ::GMM_RES_COPY_BLT for more info.
+/// @param[in]  pRects: Rectangles to BLT. See ::GMM_RES_COPY_BLT_RECTS for more info.
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuBltRects(GMM_RES_COPY_BLT *pBlt, GMM_RES_COPY_BLT_RECTS *pRects)
+{
+    GMM_TEXTURE_CALC *     pTextureCalc;
+    GMM_RES_COPY_BLT_RECT  LocalRects[GMM_CPU_BLT_RECTS_LOCAL];
+    GMM_RES_COPY_BLT_RECT *pMerged = LocalRects;
+    GMM_RES_COPY_BLT       RectsBlt;
+    uint32_t               BlockWidth, BlockHeight, BlockDepth;
+    uint32_t               PixelBytes, RegionWidth, RegionHeight, SnapWidth, SnapHeight;
+    uint32_t               NumMerged     = 0;
+    uint64_t               TransferBytes = 0;
+    uint8_t                Merged, Success = 1;
 
-                #define CASE(Layout, Tile, msaa, xD, bpe)                               \
-                    case bpe:                                                           \
-                        SwizzledSurface.pSwizzle = &Layout##_##Tile##_##msaa##xD##bpe;  \
-                        break
+    __GMM_ASSERTPTR(pBlt, 0);
+    __GMM_ASSERTPTR(pRects, 0);
+    __GMM_ASSERTPTR(pRects->pRects || !pRects->NumRects, 0);
 
-                #define SWITCH_BPP(Layout, Tile, msaa, xD)    \
-                    switch(pTexInfo->BitsPerPixel)            \
-                    {                                         \
-                        CASE(Layout, Tile, msaa, xD, 8);      \
-                        CASE(Layout, Tile, msaa, xD, 16);     \
-                        CASE(Layout, Tile, msaa, xD, 32);     \
-                        CASE(Layout, Tile, msaa, xD, 64);     \
-                        CASE(Layout, Tile, msaa, xD, 128);    \
-                    }
+    pRects->NumBlts = 0;
 
-                #define SWITCH_MSAA_TILE64(Layout, Tile, xD)     \
-                {\
-                    switch(pTexInfo->MSAA.NumSamples)           \
-                    {                                           \
-                        case 0:                                 \
-                            SWITCH_BPP(Layout, TILE_64, , xD);    \
-                            break;                              \
-                        case 1:                                 \
-                            SWITCH_BPP(Layout, TILE_64, , xD);    \
-                            break;                              \
-                        case 2:                                 \
-                            if(GetGmmLibContext()->GetSkuTable().FtrXe2PlusTiling)\
-                            { \
-                                SWITCH_BPP(Layout, TILE_64_V2, MSAA2_, xD); \
-                            }\
-                            else\
-                            { \
-                                SWITCH_BPP(Layout, TILE_64, MSAA2_, xD); \
-                            } \
-                            break;                              \
-                        case 4:                                 \
-                            if(GetGmmLibContext()->GetSkuTable().FtrXe2PlusTiling)\
-                            { \
-                                SWITCH_BPP(Layout, TILE_64_V2, MSAA4_, xD); \
-                            }\
-                            else\
-                            { \
-                                SWITCH_BPP(Layout, TILE_64, MSAA_, xD); \
-                            } \
-                            break; \
-                        case 8:                                 \
-                            if(GetGmmLibContext()->GetSkuTable().FtrXe2PlusTiling)\
-                            { \
-                                SWITCH_BPP(Layout, TILE_64_V2, MSAA8_, xD); \
-                            }\
-                            else\
-                            { \
-                                SWITCH_BPP(Layout, TILE_64, MSAA_, xD); \
-                            } \
-                            break; \
-                        case 16:                                \
-                            if(GetGmmLibContext()->GetSkuTable().FtrXe2PlusTiling)\
-                            { \
-                                SWITCH_BPP(Layout, TILE_64_V2, MSAA16_, xD); \
-                            }\
-                            else\
-                            { \
-                                SWITCH_BPP(Layout, TILE_64, MSAA_, xD); \
-                            } \
-                            break; \
-                    }                                           \
-                } \
+    if(GmmIsPlanar(Surf.Format))
+    {
+        __GMM_ASSERT(0); // Rects would span planes--use CpuBltPlanar.
+        return 0;
+    }
+
+    pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
+    pTextureCalc->GetCompressionBlockDimensions(Surf.Format, &BlockWidth, &BlockHeight, &BlockDepth);
+    PixelBytes = Surf.BitsPerPixel / CHAR_BIT;
+
+    RegionWidth = pBlt->Blt.Width ?
+                  pBlt->Blt.Width :
+                  GFX_ULONG_CAST(pTextureCalc->GmmTexGetMipWidth(&Surf, pBlt->Gpu.MipLevel)) - pBlt->Gpu.OffsetX;
+    RegionHeight = pBlt->Blt.Height ?
+                   pBlt->Blt.Height :
+                   pTextureCalc->GmmTexGetMipHeight(&Surf, pBlt->Gpu.MipLevel) - pBlt->Gpu.OffsetY;
+
+    // Rect edges must fall on compression blocks, and with MayOvercopy are
+    // widened to swizzle chunks (linear and partial-pixel BLT's have no crust)...
+    SnapWidth  = BlockWidth;
+    SnapHeight = BlockHeight;
+    if(pRects->MayOvercopy &&
+       !Surf.Flags.Info.Linear &&
+       ((GMM_CPU_BLT_RECTS_SNAP_BYTES % PixelBytes) == 0) &&
+       (!pBlt->Sys.PixelPitch || (pBlt->Sys.PixelPitch == PixelBytes)) &&
+       (!pBlt->Blt.BytesPerPixel || (pBlt->Blt.BytesPerPixel == PixelBytes)))
+    {
+        SnapWidth  = BlockWidth * (GMM_CPU_BLT_RECTS_SNAP_BYTES / PixelBytes);
+        SnapHeight = BlockHeight * GMM_CPU_BLT_RECTS_SNAP_ROWS;
+    }
 
-                #define SWITCH_MSAA(Layout, Tile, xD)           \
-                {\
-                    switch(pTexInfo->MSAA.NumSamples)           \
-                    {                                           \
-                        case 0:                                 \
-                            SWITCH_BPP(Layout, Tile, , xD);     \
-                            break;                              \
-                        case 1:                                 \
-                            SWITCH_BPP(Layout, Tile, , xD);     \
-                            break;                              \
-                        case 2:                                 \
-                            SWITCH_BPP(Layout, Tile, MSAA2_, xD);  \
-                            break;                              \
-                        case 4:                                 \
-                            SWITCH_BPP(Layout, Tile, MSAA4_, xD);  \
-                            break;                              \
-                        case 8:                                 \
-                            SWITCH_BPP(Layout, Tile, MSAA8_, xD);     \
-                            break;                              \
-                        case 16:                                \
-                            SWITCH_BPP(Layout, Tile, MSAA16_, xD);    \
-                            break;                              \
-                    }\
-                }
-                // clang-format on
+    if(pRects->NumRects > GMM_CPU_BLT_RECTS_LOCAL)
+    {
+        pMerged = (GMM_RES_COPY_BLT_RECT *)GMM_MALLOC(pRects->NumRects * sizeof(*pMerged));
+        __GMM_ASSERTPTR(pMerged, 0);
+    }
 
-                if(pTexInfo->Type == RESOURCE_3D)
-                {
-                    if(pTexInfo->Flags.Info.TiledYf)
-                    {
-                        SWITCH_BPP(INTEL, TILE_YF, , 3D_);
-                    }
-                    else if(GMM_IS_64KB_TILE(pTexInfo->Flags))
-                    {
-                        if(GetGmmLibContext()->GetSkuTable().FtrTileY)
-                        {
-                            SWITCH_BPP(INTEL, TILE_YS, , 3D_);
-                        }
-                        else
-                        {
-                            if (GetGmmLibContext()->GetSkuTable().FtrXe2PlusTiling)
-                            {
-                                SWITCH_BPP(INTEL, TILE_64_V2, , 3D_);
-                            }
-                            else
-                            {
-                                SWITCH_BPP(INTEL, TILE_64, , 3D_);
-                            }
-                        }
-                    }
-                }
-                else // 2D/Cube...
+    // Clip and snap (in subresource coordinates, since BLT rectangle needn't be aligned)...
+    for(uint32_t i = 0; i < pRects->NumRects; i++)
+    {
+        const GMM_RES_COPY_BLT_RECT *pRect = &pRects->pRects[i];
+        uint32_t                     X0, Y0, X1, Y1;
+
+        if(!pRect->Width || !pRect->Height ||
+           (pRect->OffsetX >= RegionWidth) ||
+           (pRect->OffsetY >= RegionHeight))
+        {
+            continue;
+        }
+
+        X0 = pBlt->Gpu.OffsetX + pRect->OffsetX;
+        Y0 = pBlt->Gpu.OffsetY + pRect->OffsetY;
+        X1 = X0 + GFX_MIN(pRect->Width, RegionWidth - pRect->OffsetX);
+        Y1 = Y0 + GFX_MIN(pRect->Height, RegionHeight - pRect->OffsetY);
+
+        X0 = GFX_MAX(GFX_ALIGN_FLOOR_NP2(X0, SnapWidth), pBlt->Gpu.OffsetX);
+        Y0 = GFX_MAX(GFX_ALIGN_FLOOR_NP2(Y0, SnapHeight), pBlt->Gpu.OffsetY);
+        X1 = GFX_MIN(GFX_ALIGN_NP2(X1, SnapWidth), pBlt->Gpu.OffsetX + RegionWidth);
+        Y1 = GFX_MIN(GFX_ALIGN_NP2(Y1, SnapHeight), pBlt->Gpu.OffsetY + RegionHeight);
+
+        pMerged[NumMerged].OffsetX = X0 - pBlt->Gpu.OffsetX;
+        pMerged[NumMerged].OffsetY = Y0 - pBlt->Gpu.OffsetY;
+        pMerged[NumMerged].Width   = X1 - X0;
+        pMerged[NumMerged].Height  = Y1 - Y0;
+        NumMerged++;
+    }
+
+    // Merge pairs whose bounding box is their union--or, with MayOvercopy,
+    // hardly more--until no pair merges...
+    do
+    {
+        Merged = 0;
+        for(uint32_t i = 0; i < NumMerged; i++)
+        {
+            for(uint32_t j = i + 1; j < NumMerged; j++)
+            {
+                const GMM_RES_COPY_BLT_RECT *pA = &pMerged[i], *pB = &pMerged[j];
+                uint32_t                     X0, Y0, X1, Y1, OverlapWidth, OverlapHeight;
+                uint64_t                     BoxArea, UnionArea, WasteBytes;
+
+                X0 = GFX_MIN(pA->OffsetX, pB->OffsetX);
+                Y0 = GFX_MIN(pA->OffsetY, pB->OffsetY);
+                X1 = GFX_MAX(pA->OffsetX + pA->Width, pB->OffsetX + pB->Width);
+                Y1 = GFX_MAX(pA->OffsetY + pA->Height, pB->OffsetY + pB->Height);
+
+                OverlapWidth  = (X1 - X0 < pA->Width + pB->Width) ? (pA->Width + pB->Width) - (X1 - X0) : 0;
+                OverlapHeight = (Y1 - Y0 < pA->Height + pB->Height) ? (pA->Height + pB->Height) - (Y1 - Y0) : 0;
+
+                BoxArea   = (uint64_t)(X1 - X0) * (Y1 - Y0);
+                UnionArea = (uint64_t)pA->Width * pA->Height +
+                            (uint64_t)pB->Width * pB->Height -
+                            (uint64_t)OverlapWidth * OverlapHeight;
+                WasteBytes = (BoxArea - UnionArea) * PixelBytes / (BlockWidth * BlockHeight);
+
+                if((BoxArea == UnionArea) ||
+                   (pRects->MayOvercopy && (WasteBytes <= GMM_CPU_BLT_RECTS_MERGE_SLACK_BYTES)))
                 {
-                    if(pTexInfo->Flags.Info.TiledYf)
-                    {
-                        SWITCH_MSAA(INTEL, TILE_YF, );
-                    }
-                    else if(GMM_IS_64KB_TILE(pTexInfo->Flags))
-                    {
-                        if(GetGmmLibContext()->GetSkuTable().FtrTileY)
-                        {
-                            SWITCH_MSAA(INTEL, TILE_YS, );
-                        }
-                        else
-                        {
-                            SWITCH_MSAA_TILE64(INTEL, TILE_64, );
-                        }
-                    }
+                    pMerged[i].OffsetX = X0;
+                    pMerged[i].OffsetY = Y0;
+                    pMerged[i].Width   = X1 - X0;
+                    pMerged[i].Height  = Y1 - Y0;
+                    pMerged[j]         = pMerged[--NumMerged];
+                    j                  = i; // Grown rect may now take ones it didn't before.
+                    Merged             = 1;
                 }
             }
-            __GMM_ASSERT(SwizzledSurface.pSwizzle);
+        }
+    } while(Merged);
 
-            if(pBlt->Blt.Upload)
-            {
-                CpuSwizzleBlt(&SwizzledSurface, &LinearSurface, __CopyWidthBytes, __CopyHeight);
-            }
-            else
+    for(uint32_t i = 0; i < NumMerged; i++)
+    {
+        TransferBytes += (uint64_t)GFX_CEIL_DIV(pMerged[i].Width, BlockWidth) *
+                         GFX_CEIL_DIV(pMerged[i].Height, BlockHeight) * PixelBytes;
+    }
+
+    RectsBlt                 = *pBlt;
+    RectsBlt.Blt.CachePolicy = GetCpuBltCachePolicy(pBlt->Blt.CachePolicy, TransferBytes * GFX_MAX(pBlt->Blt.Slices, 1u));
+
+    if(NumMerged)
+    {
+        Success = CpuBltInternal(&RectsBlt, NULL, NULL, 0, pMerged, NumMerged);
+    }
+
+    pBlt->Blt.CachePolicyUsed = RectsBlt.Blt.CachePolicy;
+    pRects->NumBlts           = NumMerged;
+
+    if(pMerged != LocalRects)
+    {
+        GMM_FREE(pMerged);
+    }
+
+    return Success;
+}
+
+// CRC32C (Castagnoli, reflected polynomial 0x82F63B78) of each byte value.
+static const uint32_t GmmCrc32cTable[256] = {
+    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+    0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B, 0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+    0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+    0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A, 0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+    0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+    0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A, 0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+    0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+    0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927, 0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+    0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+    0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859, 0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+    0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+    0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C, 0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+    0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+    0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C, 0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+    0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+    0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D, 0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+    0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+    0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF, 0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+    0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+    0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE, 0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+    0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+    0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E, 0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351,
+};
+
+#if defined(GMM_CRC32C_SSE42) || defined(GMM_CRC32C_ARMV8)
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns whether the CPU has CRC32C instructions (SSE4.2, or ARMv8 CRC).
+/////////////////////////////////////////////////////////////////////////////////////
+static uint8_t GmmCpuHasCrc32c()
+{
+#if defined(GMM_CRC32C_SSE42)
+#if defined(_MSC_VER)
+    int CpuInfo[4];
+    __cpuid(CpuInfo, 1);
+    return !!(CpuInfo[2] & (1 << 20)); // ECX[20] = SSE4.2
+#else
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1 << 20)); // ECX[20] = SSE4.2
+#endif
+#elif defined(__ARM_FEATURE_CRC32)
+    return 1;
+#else
+    return !!(getauxval(AT_HWCAP) & (1 << 7)); // HWCAP_CRC32
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// GmmCpuCrc32c using the CPU's CRC32C instructions--only call if
+/// GmmCpuHasCrc32c().
+/////////////////////////////////////////////////////////////////////////////////////
+#if defined(GMM_CRC32C_SSE42) && defined(__GNUC__)
+__attribute__((target("sse4.2")))
+#endif
+static uint32_t GmmCpuCrc32cHw(uint32_t Crc, const uint8_t *pBytes, size_t Size)
+{
+#if defined(GMM_CRC32C_SSE42) && (defined(_M_IX86) || defined(__i386__))
+    for(; Size >= sizeof(uint32_t); Size -= sizeof(uint32_t), pBytes += sizeof(uint32_t))
+    {
+        uint32_t Dword;
+        memcpy(&Dword, pBytes, sizeof(Dword));
+        Crc = _mm_crc32_u32(Crc, Dword);
+    }
+#else
+    for(; Size >= sizeof(uint64_t); Size -= sizeof(uint64_t), pBytes += sizeof(uint64_t))
+    {
+        uint64_t Qword;
+        memcpy(&Qword, pBytes, sizeof(Qword));
+#if defined(GMM_CRC32C_SSE42)
+        Crc = (uint32_t)_mm_crc32_u64(Crc, Qword);
+#elif defined(__ARM_FEATURE_CRC32)
+        Crc = __crc32cd(Crc, Qword);
+#else // Build doesn't target CRC, so can't use the intrinsics.
+        __asm__(".arch_extension crc\n\tcrc32cx %w0, %w0, %x1" : "+r"(Crc) : "r"(Qword));
+#endif
+    }
+#endif
+
+    for(; Size; Size--)
+    {
+#if defined(GMM_CRC32C_SSE42)
+        Crc = _mm_crc32_u8(Crc, *pBytes++);
+#elif defined(__ARM_FEATURE_CRC32)
+        Crc = __crc32cb(Crc, *pBytes++);
+#else
+        uint32_t Byte = *pBytes++;
+        __asm__(".arch_extension crc\n\tcrc32cb %w0, %w0, %w1" : "+r"(Crc) : "r"(Byte));
+#endif
+    }
+
+    return Crc;
+}
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Accumulates CRC32C (Castagnoli) of Size bytes at pData onto Crc, which is
+/// kept pre-inverted (i.e. start from ~0 and finish with ~Crc, as usual).
+/// Uses the CPU's CRC32C instructions when it has them (checked once per
+/// process, since the library is built for a baseline ISA), else a table.
+/////////////////////////////////////////////////////////////////////////////////////
+static uint32_t GmmCpuCrc32c(uint32_t Crc, const void *pData, size_t Size)
+{
+    const uint8_t *pBytes = (const uint8_t *)pData;
+
+#if defined(GMM_CRC32C_SSE42) || defined(GMM_CRC32C_ARMV8)
+    static const uint8_t HasCrc32c = GmmCpuHasCrc32c();
+
+    if(HasCrc32c)
+    {
+        return GmmCpuCrc32cHw(Crc, pBytes, Size);
+    }
+#endif
+
+    for(; Size; Size--)
+    {
+        Crc = (Crc >> 8) ^ GmmCrc32cTable[(Crc ^ *pBytes++) & 0xff];
+    }
+
+    return Crc;
+}
+
+/// Per-call state of a CpuHash/CpuCompare, passed to its CpuBltStream band callback.
+typedef struct GMM_CPU_BLT_CHECK_CONTEXT_REC
+{
+    const GMM_RES_COPY_BLT *pBlt;                   // Sys describes the reference image (compare only).
+    uint32_t                RowBytes;               // Bytes per (compression-block) row of BLT rectangle.
+    uint32_t                PixelBytes;             // Bytes per pixel (or compression block).
+    uint32_t                BlockWidth, BlockHeight;
+    uint32_t                Crc;                    // Running CRC32C (hash only).
+    GMM_RES_CPU_COMPARE *   pCompare;               // NULL when hashing.
+} GMM_CPU_BLT_CHECK_CONTEXT;
+
+static uint8_t GMM_STDCALL GmmCpuBltCheckBand(void *pStreamContext, uint32_t Slice, uint32_t FirstRow, uint32_t NumRows, void *pBand, uint32_t RowPitch)
+{
+    GMM_CPU_BLT_CHECK_CONTEXT *pContext     = (GMM_CPU_BLT_CHECK_CONTEXT *)pStreamContext;
+    const GMM_RES_COPY_BLT *   pBlt         = pContext->pBlt;
+    uint32_t                   FirstRowBlock = FirstRow / pContext->BlockHeight;
+    uint32_t                   NumRowBlocks  = GFX_CEIL_DIV(NumRows, pContext->BlockHeight);
+
+    for(uint32_t y = 0; y < NumRowBlocks; y++)
+    {
+        const char *pBandRow = (const char *)pBand + (size_t)y * RowPitch;
+        const char *pRefRow;
+
+        if(!pContext->pCompare)
+        {
+            pContext->Crc = GmmCpuCrc32c(pContext->Crc, pBandRow, pContext->RowBytes);
+            continue;
+        }
+
+        pRefRow = (const char *)pBlt->Sys.pData + (size_t)Slice * pBlt->Sys.SlicePitch + (size_t)(FirstRowBlock + y) * pBlt->Sys.RowPitch;
+
+        __GMM_ASSERT((size_t)(pRefRow - (const char *)pBlt->Sys.pData) + pContext->RowBytes <= pBlt->Sys.BufferSize);
+
+        if(memcmp(pBandRow, pRefRow, pContext->RowBytes))
+        {
+            uint32_t x = 0;
+
+            while(pBandRow[x] == pRefRow[x])
             {
-                CpuSwizzleBlt(&LinearSurface, &SwizzledSurface, __CopyWidthBytes, __CopyHeight);
+                x++;
             }
+
+            pContext->pCompare->Match = 0;
+            pContext->pCompare->Slice = Slice;
+            pContext->pCompare->X     = (x / pContext->PixelBytes) * pContext->BlockWidth;
+            pContext->pCompare->Y     = (FirstRowBlock + y) * pContext->BlockHeight;
+
+            return 0; // Found first difference--stop streaming.
         }
     }
 
-EXIT:
+    return 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Common implementation of CpuHash and CpuCompare: downloads the BLT rectangle
+/// as a CpuBltStream, hashing or comparing each cache-resident band as it's
+/// produced, so no linear copy of the whole rectangle is ever made.
+///
+/// @param[in]  pBlt: Rectangle to check (and, for compares, the reference image in Sys)
+/// @param[out] pHash: Receives hash, or NULL when comparing
+/// @param[out] pCompare: Receives compare result, or NULL when hashing
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GmmLib::GmmResourceInfoCommon::CpuBltCheck(GMM_RES_COPY_BLT *pBlt, uint32_t *pHash, GMM_RES_CPU_COMPARE *pCompare)
+{
+    GMM_TEXTURE_CALC *        pTextureCalc;
+    GMM_CPU_BLT_CHECK_CONTEXT Context = {0};
+    GMM_RES_COPY_BLT_STREAM   Stream  = {0};
+    GMM_RES_COPY_BLT          StreamBlt;
+    uint32_t                  BlockDepth, Width;
+    uint8_t                   Success;
+
+    __GMM_ASSERTPTR(pBlt, 0);
+    __GMM_ASSERT(!pBlt->Sys.PixelPitch && !pBlt->Blt.BytesPerPixel && !pBlt->Gpu.OffsetSubpixel); // Whole pixels only.
+
+    pTextureCalc = GMM_OVERRIDE_TEXTURE_CALC(&Surf, GetGmmLibContext());
+    pTextureCalc->GetCompressionBlockDimensions(Surf.Format, &Context.BlockWidth, &Context.BlockHeight, &BlockDepth);
+
+    Width = pBlt->Blt.Width ?
+            pBlt->Blt.Width :
+            (GFX_ULONG_CAST(GetMipWidth(pBlt->Gpu.MipLevel)) - pBlt->Gpu.OffsetX);
+
+    Context.pBlt       = pBlt;
+    Context.PixelBytes = Surf.BitsPerPixel / CHAR_BIT;
+    Context.RowBytes   = GFX_CEIL_DIV(Width, Context.BlockWidth) * Context.PixelBytes;
+    Context.Crc        = ~0u;
+    Context.pCompare   = pCompare;
+
+    if(pCompare)
+    {
+        pCompare->Match = 1;
+        pCompare->Slice = pCompare->X = pCompare->Y = 0;
+    }
+
+    Stream.pfnBand        = GmmCpuBltCheckBand;
+    Stream.pStreamContext = &Context;
+
+    StreamBlt              = *pBlt;
+    StreamBlt.Sys.pData    = NULL;
+    StreamBlt.Sys.RowPitch = 0;
+    StreamBlt.Blt.Width    = Width;
+    StreamBlt.Blt.Upload   = 0;
+
+    Success = CpuBltStream(&StreamBlt, &Stream);
+
+    if(pCompare && !pCompare->Match)
+    {
+        Success = 1; // Stream was stopped at the first difference--not a failure.
+    }
+
+    if(pHash)
+    {
+        *pHash = ~Context.Crc;
+    }
+
+    pBlt->Blt.CachePolicyUsed = StreamBlt.Blt.CachePolicyUsed;
 
     return Success;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////
+/// Computes a tiling-independent hash of a rectangle of the mapped resource--
+/// the CRC32C of its rows as a packed linear image (slice by slice, each row
+/// Width pixels), so it equals the CRC32C of the same pixels downloaded with
+/// CpuBlt and can be checked against goldens hashed from linear images.
+///
+/// Swizzled memory is walked in cache-resident bands (see CpuBltStream), so
+/// no full linear copy is made.
+///
+/// @param[in]  pBlt: Rectangle to hash, as for a download CpuBlt. Sys and
+///                   Blt.Upload are ignored; whole-pixel BLTs only.
+/// @param[out] pHash: Receives the CRC32C
+/// @return     1 if succeeded, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuHash(GMM_RES_COPY_BLT *pBlt, uint32_t *pHash)
+{
+    __GMM_ASSERTPTR(pHash, 0);
+
+    return CpuBltCheck(pBlt, pHash, NULL);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Compares a rectangle of the mapped resource against a linear reference image
+/// (pBlt->Sys, laid out as for a download CpuBlt), reporting the first
+/// differing pixel in row-major order. Swizzled memory is walked in
+/// cache-resident bands (see CpuBltStream), stopping at the first difference.
+///
+/// @param[in]  pBlt: Rectangle to compare, and reference image in Sys.
+///                   Blt.Upload is ignored; whole-pixel BLTs only.
+/// @param[out] pCompare: Receives result. See ::GMM_RES_CPU_COMPARE for more info.
+/// @return     1 if compare completed (whether or not images match), 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::CpuCompare(GMM_RES_COPY_BLT *pBlt, GMM_RES_CPU_COMPARE *pCompare)
+{
+    __GMM_ASSERTPTR(pBlt && pBlt->Sys.pData, 0);
+    __GMM_ASSERTPTR(pCompare, 0);
+
+    return CpuBltCheck(pBlt, NULL, pCompare);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////
 /// Helper function that helps UMDs map in the surface in a layout that
 /// our HW understands. Clients call this function in a loop until it
@@ -2310,6 +4892,138 @@ uint8_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::GetMappingSpanDesc(GMM_GET_MA
     return !WasFinalSpan;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////
+/// Appends a span to a GetMappingSpans list, coalescing it into the pending
+/// span when contiguous in both virtual and physical offset.
+///
+/// @param[in/out] Pending: Span not yet written out (Size 0 if none)
+/// @param[in]     Next: Span to append (dropped if empty)
+/// @param[out]    pSpans: Span list, or NULL to just count
+/// @param[in]     NumSpans: Entries at pSpans
+/// @param[in/out] Count: Number of spans written out so far
+/////////////////////////////////////////////////////////////////////////////////////
+static void GmmMappingSpanAppend(GMM_MAPPING_SPAN &Pending, const GMM_MAPPING_SPAN &Next, GMM_MAPPING_SPAN *pSpans, uint32_t NumSpans, uint32_t &Count)
+{
+    if(!Next.Size)
+    {
+        return;
+    }
+
+    if(Pending.Size &&
+       (Pending.VirtualOffset + Pending.Size == Next.VirtualOffset) &&
+       (Pending.PhysicalOffset + Pending.Size == Next.PhysicalOffset))
+    {
+        Pending.Size += Next.Size;
+        return;
+    }
+
+    if(Pending.Size)
+    {
+        if(pSpans && (Count < NumSpans))
+        {
+            pSpans[Count] = Pending;
+        }
+        Count++;
+    }
+
+    Pending = Next;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the complete span list of a mapping in one call, so e.g. sparse
+/// binding needn't iterate GetMappingSpanDesc per resource. Spans contiguous in
+/// both virtual and physical offset are coalesced, and empty spans dropped.
+/// YUV planar mappings cover all array slices, with each plane's offset
+/// queried once per slice (GetMappingSpanDesc queries it for both the plane
+/// and its predecessor's end).
+///
+/// @param[in]  Type: GMM_MAPPING_GEN9_YS_TO_STDSWIZZLE, or for planar formats
+///                   GMM_MAPPING_YUVPLANAR/GMM_MAPPING_YUVPLANAR_AUX
+/// @param[out] pSpans: Receives the spans, or NULL to just count
+/// @param[in]  NumSpans: Entries at pSpans--only the first NumSpans are written
+///                       if the mapping has more
+/// @return     Number of spans in the mapping, or 0 if Type is invalid
+/////////////////////////////////////////////////////////////////////////////////////
+uint32_t GMM_STDCALL GmmLib::GmmResourceInfoCommon::GetMappingSpans(GMM_GET_MAPPING_TYPE Type, GMM_MAPPING_SPAN *pSpans, uint32_t NumSpans)
+{
+    GMM_MAPPING_SPAN Span  = {0};
+    uint32_t         Count = 0;
+
+    if(!Surf.Flags.Info.StdSwizzle ||
+       !((Type == GMM_MAPPING_GEN9_YS_TO_STDSWIZZLE) ||
+         (((Type == GMM_MAPPING_YUVPLANAR) || (Type == GMM_MAPPING_YUVPLANAR_AUX)) && GmmIsPlanar(Surf.Format))))
+    {
+        GMM_ASSERTDPF(0, "Invalid parameter!");
+        return 0;
+    }
+
+    if(Type == GMM_MAPPING_YUVPLANAR)
+    {
+        uint32_t       NumSlices = GFX_MAX(Surf.ArraySize, 1);
+        GMM_YUV_PLANE  LastPlane = (GmmLib::Utility::GmmGetNumPlanes(Surf.Format) == GMM_PLANE_V) ? GMM_PLANE_V : GMM_PLANE_U;
+        GMM_GFX_SIZE_T SlicePhysicalSize = GetSizeMainSurfacePhysical() / NumSlices;
+        GMM_GFX_SIZE_T SliceVirtualSize  = GetSizeMainSurface() / NumSlices;
+
+        for(uint32_t Slice = 0; Slice < NumSlices; Slice++)
+        {
+            GMM_REQ_OFFSET_INFO PlaneOffset[GMM_MAX_PLANE + 1] = {};
+
+            for(uint32_t Plane = GMM_PLANE_Y; Plane <= LastPlane; Plane++)
+            {
+                PlaneOffset[Plane].ReqRender = PlaneOffset[Plane].ReqLock = 1;
+                PlaneOffset[Plane].Plane                                  = GMM_YUV_PLANE(Plane);
+                PlaneOffset[Plane].ArrayIndex                             = Slice;
+                this->GetOffset(PlaneOffset[Plane]);
+            }
+
+            // Last plane runs to the end of the slice.
+            PlaneOffset[LastPlane + 1].Lock.Offset64   = SlicePhysicalSize * (Slice + 1);
+            PlaneOffset[LastPlane + 1].Render.Offset64 = SliceVirtualSize * (Slice + 1);
+
+            for(uint32_t Plane = GMM_PLANE_Y; Plane <= LastPlane; Plane++)
+            {
+                GMM_MAPPING_SPAN Next;
+
+                Next.VirtualOffset  = PlaneOffset[Plane].Render.Offset64;
+                Next.PhysicalOffset = PlaneOffset[Plane].Lock.Offset64;
+                Next.Size           = PlaneOffset[Plane + 1].Lock.Offset64 - PlaneOffset[Plane].Lock.Offset64;
+                GmmMappingSpanAppend(Span, Next, pSpans, NumSpans, Count);
+            }
+        }
+    }
+    else
+    {
+        GMM_GET_MAPPING Mapping;
+        uint8_t         More;
+
+        memset(&Mapping, 0, sizeof(Mapping));
+        Mapping.Type = Type;
+
+        do
+        {
+            GMM_MAPPING_SPAN Next;
+
+            More = GetMappingSpanDesc(&Mapping);
+
+            Next.VirtualOffset  = Mapping.Span.VirtualOffset;
+            Next.PhysicalOffset = Mapping.Span.PhysicalOffset;
+            Next.Size           = Mapping.Span.Size;
+            GmmMappingSpanAppend(Span, Next, pSpans, NumSpans, Count);
+        } while(More);
+    }
+
+    if(Span.Size)
+    {
+        if(pSpans && (Count < NumSpans))
+        {
+            pSpans[Count] = Span;
+        }
+        Count++;
+    }
+
+    return Count;
+}
+
 //=============================================================================
 //
 // Function: GetTiledResourceMipPacking
@@ -0,0 +1,197 @@
+/*==============================================================================
+Copyright(c) 2017 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and / or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+============================================================================*/
+
+#include "Internal/Common/GmmLibInc.h"
+
+
+#if(!defined(__GMM_KMD__))
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Frees the table's bookkeeping. Objects still referenced are left to their
+/// owners (see ~GmmClientContext).
+/////////////////////////////////////////////////////////////////////////////////////
+GmmLib::GmmSharedResInfo::~GmmSharedResInfo()
+{
+    for(auto &Pair : ByRes)
+    {
+        delete Pair.second;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the entry for a key, or NULL. Caller holds Mutex.
+/////////////////////////////////////////////////////////////////////////////////////
+GmmLib::GmmSharedResInfo::ENTRY *GmmLib::GmmSharedResInfo::Find(const GmmLayoutCache::KEY &Key, uint64_t Hash)
+{
+    auto Range = ByKey.equal_range(Hash);
+
+    for(auto It = Range.first; It != Range.second; ++It)
+    {
+        if(!memcmp(&It->second->Key, &Key, sizeof(Key)))
+        {
+            return It->second;
+        }
+    }
+
+    return NULL;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Unlinks and frees an entry. Caller holds Mutex.
+/////////////////////////////////////////////////////////////////////////////////////
+void GmmLib::GmmSharedResInfo::Remove(ENTRY *pEntry)
+{
+    auto Range = ByKey.equal_range(pEntry->Hash);
+
+    for(auto It = Range.first; It != Range.second; ++It)
+    {
+        if(It->second == pEntry)
+        {
+            ByKey.erase(It);
+            break;
+        }
+    }
+
+    ByRes.erase(pEntry->pRes);
+    delete pEntry;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Takes a reference on the shared object for a key, if there is one.
+///
+/// @param[in]  Key: Key from GmmLayoutCache::MakeKey()
+/// @param[out] CreateParams: Receives the normalized params, as Create would
+/// @return     Shared object, or NULL if none (caller then creates and Publish()'es)
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_RESOURCE_INFO *GmmLib::GmmSharedResInfo::Acquire(const GmmLayoutCache::KEY &Key, GMM_RESCREATE_PARAMS &CreateParams)
+{
+    uint64_t Hash = GmmLayoutCache::HashKey(Key);
+
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    ENTRY *pEntry = Find(Key, Hash);
+
+    if(!pEntry)
+    {
+        return NULL;
+    }
+
+    pEntry->RefCount++;
+    CreateParams = pEntry->Params;
+
+    return pEntry->pRes;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Shares a freshly created object under its key, holding one reference. If a
+/// racing create published the key first, takes a reference on that object
+/// instead--the caller must then destroy its own.
+///
+/// @param[in]  Key: Key from GmmLayoutCache::MakeKey()
+/// @param[in]  CreateParams: Params as normalized by Create
+/// @param[in]  pRes: Object created for the key
+/// @return     The shared object for the key
+/////////////////////////////////////////////////////////////////////////////////////
+GMM_RESOURCE_INFO *GmmLib::GmmSharedResInfo::Publish(const GmmLayoutCache::KEY &Key, const GMM_RESCREATE_PARAMS &CreateParams, GMM_RESOURCE_INFO *pRes)
+{
+    uint64_t Hash = GmmLayoutCache::HashKey(Key);
+    ENTRY *  pEntry;
+
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    if((pEntry = Find(Key, Hash)) != NULL)
+    {
+        pEntry->RefCount++;
+        return pEntry->pRes;
+    }
+
+    if((pEntry = new ENTRY) == NULL)
+    {
+        return pRes; // Can't share--object stays private to the caller.
+    }
+
+    memcpy(&pEntry->Key, &Key, sizeof(Key));
+    pEntry->Hash     = Hash;
+    pEntry->Params   = CreateParams;
+    pEntry->pRes     = pRes;
+    pEntry->RefCount = 1;
+
+    ByKey.insert(std::make_pair(Hash, pEntry));
+    ByRes[pRes] = pEntry;
+
+    return pRes;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Drops a reference on an object, if shared. On the last reference the object
+/// is unshared, and the caller must destroy it.
+///
+/// @param[in]  pRes: Any ResInfo object
+/// @param[out] pLast: Set to 1 if that was the last reference
+/// @return     1 if pRes was shared, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GmmLib::GmmSharedResInfo::Release(const GMM_RESOURCE_INFO *pRes, uint8_t *pLast)
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    auto It = ByRes.find(pRes);
+
+    *pLast = 0;
+
+    if(It == ByRes.end())
+    {
+        return 0;
+    }
+
+    if(--It->second->RefCount == 0)
+    {
+        Remove(It->second);
+        *pLast = 1;
+    }
+
+    return 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns whether an object is shared.
+///
+/// @param[in]  pRes: Any ResInfo object
+/// @return     1 if pRes is shared, 0 otherwise
+/////////////////////////////////////////////////////////////////////////////////////
+uint8_t GmmLib::GmmSharedResInfo::Contains(const GMM_RESOURCE_INFO *pRes)
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    return ByRes.find(pRes) != ByRes.end();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the number of distinct shared objects.
+/////////////////////////////////////////////////////////////////////////////////////
+uint32_t GmmLib::GmmSharedResInfo::GetNumShared()
+{
+    std::lock_guard<std::mutex> Lock(Mutex);
+
+    return static_cast<uint32_t>(ByRes.size());
+}
+
+#endif // !__GMM_KMD__
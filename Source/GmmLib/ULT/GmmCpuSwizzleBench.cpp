@@ -0,0 +1,445 @@
+/*==============================================================================
+Copyright(c) 2017 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and / or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+============================================================================*/
+
+// GMMBENCH - CpuSwizzleBlt throughput benchmark.
+//
+// Measures upload (linear-to-swizzled) and download (swizzled-to-linear)
+// GB/s for every INTEL_TILE_* descriptor across bpp, BLT alignment, surface
+// size and available SIMD path, checks each optimized result against the
+// MINIMALIST build, and reports everything as JSON. Exits nonzero on any
+// mismatch.
+//
+// Usage: GMMBENCH [--quick] [--temporal] [--min-ms N] [--filter STR] [--out FILE]
+//   --quick     Smallest size only, one timed iteration (smoke test).
+//   --temporal  Access swizzled surfaces via cache, rather than streaming.
+//   --min-ms N  Minimum timed duration per measurement (default 50).
+//   --filter S  Only descriptors whose name contains S.
+//   --out FILE  Write JSON to FILE rather than stdout.
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#define BENCH_ALIGNED_MALLOC(Size, alignBytes) _aligned_malloc(Size, alignBytes)
+#define BENCH_ALIGNED_FREE(ptr) _aligned_free(ptr)
+#else
+#include <malloc.h>
+#define BENCH_ALIGNED_MALLOC(Size, alignBytes) memalign(alignBytes, Size)
+#define BENCH_ALIGNED_FREE(ptr) free(ptr)
+#endif
+
+#define INCLUDE_CpuSwizzleBlt_c_AS_HEADER
+#include "../Utility/CpuSwizzleBlt/CpuSwizzleBlt.c"
+
+extern "C" {
+    // GmmCpuSwizzleBenchMinimalist.c
+    void CpuSwizzleBlt_Minimalist(CPU_SWIZZLE_BLT_SURFACE *pDest, CPU_SWIZZLE_BLT_SURFACE *pSrc, int CopyWidthBytes, int CopyHeight);
+
+    // GmmCpuSwizzleBenchOptimized.c
+    const char *GmmBenchSelectSimdPath(int Path);
+}
+
+#define BENCH_MAX_SURFACE_BYTES (256 * 1024 * 1024)
+#define BENCH_MAX_VERIFY_BYTES  (1024 * 1024)  // MINIMALIST is byte-by-byte, so only verify up to this.
+#define BENCH_MAX_SIMD_PATHS    8
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Swizzle descriptors under test. Bpp of zero marks bpp-agnostic descriptors,
+/// which are run at every bpp.
+/////////////////////////////////////////////////////////////////////////////////////
+typedef struct BENCH_SWIZZLE_REC
+{
+    const SWIZZLE_DESCRIPTOR *pSwizzle;
+    const char *              pName;
+    int                       Bpp; // Bytes per pixel, or 0 if agnostic.
+} BENCH_SWIZZLE;
+
+#define BENCH_SWIZZLE_ENTRY(Name, Bpp) {&Name, #Name, Bpp}
+#define BENCH_SWIZZLE_ENTRIES(Prefix)                 \
+    BENCH_SWIZZLE_ENTRY(Prefix##_128, 16),            \
+    BENCH_SWIZZLE_ENTRY(Prefix##_64, 8),              \
+    BENCH_SWIZZLE_ENTRY(Prefix##_32, 4),              \
+    BENCH_SWIZZLE_ENTRY(Prefix##_16, 2),              \
+    BENCH_SWIZZLE_ENTRY(Prefix##_8, 1)
+
+static const BENCH_SWIZZLE BenchSwizzles[] =
+{
+    BENCH_SWIZZLE_ENTRY(INTEL_TILE_X, 0),
+    BENCH_SWIZZLE_ENTRY(INTEL_TILE_Y, 0),
+    BENCH_SWIZZLE_ENTRY(INTEL_TILE_W, 1),
+    BENCH_SWIZZLE_ENTRY(INTEL_TILE_4, 0),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YF),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YS),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YF_MSAA2),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YS_MSAA2),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YF_MSAA4),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YS_MSAA4),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YF_MSAA8),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YS_MSAA8),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YF_MSAA16),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YS_MSAA16),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YF_3D),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_YS_3D),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_64),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_64_MSAA2),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_64_MSAA),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_64_3D),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_64_V2_MSAA2),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_64_V2_MSAA4),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_64_V2_MSAA8),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_64_V2_MSAA16),
+    BENCH_SWIZZLE_ENTRIES(INTEL_TILE_64_V2_3D),
+};
+
+static const int BenchAgnosticBpp[] = {1, 2, 4, 8, 16};
+static const int BenchSizes[]       = {64 * 1024, 1024 * 1024, 16 * 1024 * 1024}; // Bytes per 2D surface.
+
+typedef struct BENCH_OPTIONS_REC
+{
+    int         Quick;
+    int         Temporal;
+    int         MinMs;
+    const char *pFilter;
+    const char *pOutFile;
+} BENCH_OPTIONS;
+
+static int BenchPopCount(int Mask)
+{
+    int Count = 0;
+
+    for(; Mask; Mask &= Mask - 1)
+    {
+        Count++;
+    }
+
+    return Count;
+}
+
+static void BenchFillPattern(uint8_t *pBuf, size_t Size, uint32_t Seed)
+{
+    for(size_t i = 0; i < Size; i++)
+    {
+        Seed    = Seed * 1103515245 + 12345;
+        pBuf[i] = (uint8_t)(Seed >> 16);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Times given BLT, repeating until at least MinMs elapsed (after one untimed
+/// warm-up), and returns throughput in GB/s.
+/////////////////////////////////////////////////////////////////////////////////////
+static double BenchTimeBlt(CPU_SWIZZLE_BLT_SURFACE *pDest, CPU_SWIZZLE_BLT_SURFACE *pSrc, int WidthBytes, int Height, int MinMs)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    double   Seconds    = 0;
+    uint64_t Iterations = 0;
+
+    CpuSwizzleBlt(pDest, pSrc, WidthBytes, Height);
+
+    Clock::time_point Start = Clock::now();
+    do
+    {
+        CpuSwizzleBlt(pDest, pSrc, WidthBytes, Height);
+        Iterations++;
+        Seconds = std::chrono::duration<double>(Clock::now() - Start).count();
+    } while(Seconds * 1000 < MinMs);
+
+    return (Seconds > 0) ? ((double)WidthBytes * Height * Iterations / Seconds / 1e9) : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Runs one benchmark case, appending its JSON record to pOut.
+///
+/// @param[in]  pSwizzle: Swizzle under test
+/// @param[in]  Bpp: Bytes per pixel
+/// @param[in]  Aligned: Nonzero for whole-surface BLT, else BLT inset off tile/cache-line boundaries
+/// @param[in]  SizeBytes: Approximate 2D surface size
+/// @param[in]  pSimd: Name of selected SIMD path
+/// @return     1 if case ran and matched (or wasn't verified), 0 on mismatch
+/////////////////////////////////////////////////////////////////////////////////////
+static int BenchRunCase(FILE *pOut, int *pFirst, const BENCH_OPTIONS *pOptions, const BENCH_SWIZZLE *pSwizzle,
+                        int Bpp, int Aligned, int SizeBytes, const char *pSimd)
+{
+    int TileWidthBits  = BenchPopCount(pSwizzle->pSwizzle->Mask.x);
+    int TileHeightBits = BenchPopCount(pSwizzle->pSwizzle->Mask.y);
+    int TileDepthBits  = BenchPopCount(pSwizzle->pSwizzle->Mask.z);
+
+    // Square-ish surface, padded to whole tiles...
+    int RowBytes = 1 << TileWidthBits;
+    while((RowBytes * RowBytes) < SizeBytes)
+    {
+        RowBytes <<= 1;
+    }
+    int Height        = SizeBytes / RowBytes;
+    int AlignedHeight = (Height + (1 << TileHeightBits) - 1) & ~((1 << TileHeightBits) - 1);
+    size_t SurfSize   = ((size_t)RowBytes * AlignedHeight) << TileDepthBits;
+    size_t LinearSize = (size_t)RowBytes * Height;
+
+    if((SurfSize > BENCH_MAX_SURFACE_BYTES) || (Height < 4))
+    {
+        return 1;
+    }
+
+    int x0         = Aligned ? 0 : 3 * Bpp;
+    int y0         = Aligned ? 0 : 1;
+    int WidthBytes = Aligned ? RowBytes : (RowBytes - 2 * x0);
+    int BltHeight  = Aligned ? Height : (Height - 2);
+
+    if(WidthBytes <= 0)
+    {
+        return 1;
+    }
+
+    uint8_t *pSurf    = (uint8_t *)BENCH_ALIGNED_MALLOC(SurfSize, 64);
+    uint8_t *pLinear  = (uint8_t *)BENCH_ALIGNED_MALLOC(LinearSize, 64);
+    uint8_t *pSurfRef = NULL;
+    uint8_t *pLinRef  = NULL;
+    uint8_t *pLinOut  = NULL;
+
+    if(!pSurf || !pLinear)
+    {
+        BENCH_ALIGNED_FREE(pSurf);
+        BENCH_ALIGNED_FREE(pLinear);
+        return 1;
+    }
+
+    CPU_SWIZZLE_BLT_SURFACE Swizzled = {}, Linear = {};
+
+    Swizzled.pBase    = pSurf;
+    Swizzled.pSwizzle = pSwizzle->pSwizzle;
+    Swizzled.Pitch    = RowBytes;
+    Swizzled.Height   = AlignedHeight;
+    Swizzled.OffsetX  = x0;
+    Swizzled.OffsetY  = y0;
+    Swizzled.Temporal = pOptions->Temporal;
+
+    Linear.pBase   = pLinear;
+    Linear.Pitch   = RowBytes;
+    Linear.Height  = Height;
+    Linear.OffsetX = x0;
+    Linear.OffsetY = y0;
+
+    BenchFillPattern(pLinear, LinearSize, (uint32_t)(SizeBytes ^ Bpp));
+
+    // Verify against MINIMALIST...
+    int Verified = pOptions->Quick || ((size_t)WidthBytes * BltHeight <= BENCH_MAX_VERIFY_BYTES);
+    int Match    = 1;
+
+    if(Verified)
+    {
+        pSurfRef = (uint8_t *)BENCH_ALIGNED_MALLOC(SurfSize, 64);
+        pLinRef  = (uint8_t *)BENCH_ALIGNED_MALLOC(LinearSize, 64);
+        pLinOut  = (uint8_t *)BENCH_ALIGNED_MALLOC(LinearSize, 64);
+
+        if(pSurfRef && pLinRef && pLinOut)
+        {
+            CPU_SWIZZLE_BLT_SURFACE SwizzledRef = Swizzled, LinearOut = Linear, LinearRef = Linear;
+
+            SwizzledRef.pBase = pSurfRef;
+            LinearOut.pBase   = pLinOut;
+            LinearRef.pBase   = pLinRef;
+
+            // Upload...
+            memset(pSurf, 0xCD, SurfSize);
+            memset(pSurfRef, 0xCD, SurfSize);
+            CpuSwizzleBlt(&Swizzled, &Linear, WidthBytes, BltHeight);
+            CpuSwizzleBlt_Minimalist(&SwizzledRef, &Linear, WidthBytes, BltHeight);
+            Match &= (memcmp(pSurf, pSurfRef, SurfSize) == 0);
+
+            // Download (and round trip)...
+            memset(pLinOut, 0xCD, LinearSize);
+            memset(pLinRef, 0xCD, LinearSize);
+            CpuSwizzleBlt(&LinearOut, &Swizzled, WidthBytes, BltHeight);
+            CpuSwizzleBlt_Minimalist(&LinearRef, &Swizzled, WidthBytes, BltHeight);
+            Match &= (memcmp(pLinOut, pLinRef, LinearSize) == 0);
+
+            for(int y = y0; y < y0 + BltHeight; y++)
+            {
+                size_t Offset = (size_t)y * RowBytes + x0;
+                Match &= (memcmp(pLinOut + Offset, pLinear + Offset, WidthBytes) == 0);
+            }
+        }
+        else
+        {
+            Verified = 0;
+        }
+
+        BENCH_ALIGNED_FREE(pSurfRef);
+        BENCH_ALIGNED_FREE(pLinRef);
+        BENCH_ALIGNED_FREE(pLinOut);
+    }
+
+    double UploadGbps   = BenchTimeBlt(&Swizzled, &Linear, WidthBytes, BltHeight, pOptions->MinMs);
+    double DownloadGbps = BenchTimeBlt(&Linear, &Swizzled, WidthBytes, BltHeight, pOptions->MinMs);
+
+    fprintf(pOut, "%s\n    {\"swizzle\": \"%s\", \"simd\": \"%s\", \"bpp\": %d, \"aligned\": %s, "
+                  "\"width\": %d, \"height\": %d, \"bytes\": %lld, "
+                  "\"upload_gbps\": %.3f, \"download_gbps\": %.3f, \"verified\": %s, \"match\": %s}",
+            *pFirst ? "" : ",", pSwizzle->pName, pSimd, Bpp, Aligned ? "true" : "false",
+            WidthBytes / Bpp, BltHeight, (long long)WidthBytes * BltHeight,
+            UploadGbps, DownloadGbps, Verified ? "true" : "false", Match ? "true" : "false");
+    *pFirst = 0;
+
+    BENCH_ALIGNED_FREE(pSurf);
+    BENCH_ALIGNED_FREE(pLinear);
+
+    return Match;
+}
+
+static int BenchParseOptions(int argc, char *argv[], BENCH_OPTIONS *pOptions)
+{
+    pOptions->Quick    = 0;
+    pOptions->Temporal = 0;
+    pOptions->MinMs    = 50;
+    pOptions->pFilter  = NULL;
+    pOptions->pOutFile = NULL;
+
+    for(int i = 1; i < argc; i++)
+    {
+        if(!strcmp(argv[i], "--quick"))
+        {
+            pOptions->Quick = 1;
+            pOptions->MinMs = 0;
+        }
+        else if(!strcmp(argv[i], "--temporal"))
+        {
+            pOptions->Temporal = 1;
+        }
+        else if(!strcmp(argv[i], "--min-ms") && (i + 1 < argc))
+        {
+            pOptions->MinMs = atoi(argv[++i]);
+        }
+        else if(!strcmp(argv[i], "--filter") && (i + 1 < argc))
+        {
+            pOptions->pFilter = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--out") && (i + 1 < argc))
+        {
+            pOptions->pOutFile = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--quick] [--temporal] [--min-ms N] [--filter STR] [--out FILE]\n", argv[0]);
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static void BenchPrintCpu(FILE *pOut)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    fprintf(pOut, "  \"cpu\": {\"sse41\": %s, \"avx2\": %s, \"avx512f\": %s, \"bmi2\": %s},\n",
+            __builtin_cpu_supports("sse4.1") ? "true" : "false",
+            __builtin_cpu_supports("avx2") ? "true" : "false",
+            __builtin_cpu_supports("avx512f") ? "true" : "false",
+            __builtin_cpu_supports("bmi2") ? "true" : "false");
+#else
+    fprintf(pOut, "  \"cpu\": {},\n");
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    BENCH_OPTIONS Options;
+    FILE *        pOut       = stdout;
+    int           First      = 1;
+    int           Mismatches = 0;
+    int           SimdPaths[BENCH_MAX_SIMD_PATHS];
+    int           NumSimdPaths = 0;
+
+    if(!BenchParseOptions(argc, argv, &Options))
+    {
+        return 2;
+    }
+
+    if(Options.pOutFile && !(pOut = fopen(Options.pOutFile, "w")))
+    {
+        fprintf(stderr, "Cannot open %s\n", Options.pOutFile);
+        return 2;
+    }
+
+    for(int Path = 0; Path < BENCH_MAX_SIMD_PATHS; Path++)
+    {
+        if(GmmBenchSelectSimdPath(Path))
+        {
+            SimdPaths[NumSimdPaths++] = Path;
+        }
+    }
+
+    fprintf(pOut, "{\n");
+    BenchPrintCpu(pOut);
+    fprintf(pOut, "  \"temporal\": %s,\n  \"min_ms\": %d,\n  \"results\": [",
+            Options.Temporal ? "true" : "false", Options.MinMs);
+
+    for(int s = 0; s < (int)(sizeof(BenchSwizzles) / sizeof(BenchSwizzles[0])); s++)
+    {
+        const BENCH_SWIZZLE *pSwizzle = &BenchSwizzles[s];
+
+        if(Options.pFilter && !strstr(pSwizzle->pName, Options.pFilter))
+        {
+            continue;
+        }
+
+        int NumBpp = pSwizzle->Bpp ? 1 : (int)(sizeof(BenchAgnosticBpp) / sizeof(BenchAgnosticBpp[0]));
+        int NumSizes = Options.Quick ? 1 : (int)(sizeof(BenchSizes) / sizeof(BenchSizes[0]));
+
+        for(int b = 0; b < NumBpp; b++)
+        {
+            int Bpp = pSwizzle->Bpp ? pSwizzle->Bpp : BenchAgnosticBpp[b];
+
+            for(int Size = 0; Size < NumSizes; Size++)
+            {
+                for(int Aligned = 1; Aligned >= 0; Aligned--)
+                {
+                    for(int p = 0; p < NumSimdPaths; p++)
+                    {
+                        const char *pSimd = GmmBenchSelectSimdPath(SimdPaths[p]);
+
+                        if(!BenchRunCase(pOut, &First, &Options, pSwizzle, Bpp, Aligned, BenchSizes[Size], pSimd))
+                        {
+                            fprintf(stderr, "MISMATCH: %s simd=%s bpp=%d aligned=%d size=%d\n",
+                                    pSwizzle->pName, pSimd, Bpp, Aligned, BenchSizes[Size]);
+                            Mismatches++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    fprintf(pOut, "\n  ],\n  \"mismatches\": %d\n}\n", Mismatches);
+
+    if(pOut != stdout)
+    {
+        fclose(pOut);
+    }
+
+    return Mismatches ? 1 : 0;
+}
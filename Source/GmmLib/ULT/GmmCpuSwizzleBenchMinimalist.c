@@ -0,0 +1,40 @@
+/*==============================================================================
+Copyright(c) 2017 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and / or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+============================================================================*/
+
+// GmmCpuSwizzleBenchMinimalist.c - MINIMALIST build of CpuSwizzleBlt.c, the
+// byte-by-byte reference GMMBENCH checks the optimized kernels against.
+
+// Entry points renamed, so both builds link into GMMBENCH...
+#define SwizzleOffset               SwizzleOffset_Minimalist
+#define SwizzleOffsetBatch          SwizzleOffsetBatch_Minimalist
+#define SwizzleOffsetInverseBatch   SwizzleOffsetInverseBatch_Minimalist
+#define CpuSwizzleBlt               CpuSwizzleBlt_Minimalist
+#define CpuSwizzleBltKernel         CpuSwizzleBltKernel_Minimalist
+#define CpuSwizzleFill              CpuSwizzleFill_Minimalist
+
+// ...and swizzle descriptors only declared here--defined by the optimized build.
+#define INCLUDE_CpuSwizzleBlt_c_AS_HEADER
+#include "../Utility/CpuSwizzleBlt/CpuSwizzleBlt.c"
+#undef INCLUDE_CpuSwizzleBlt_c_AS_HEADER
+
+#define MINIMALIST
+#include "../Utility/CpuSwizzleBlt/CpuSwizzleBlt.c"
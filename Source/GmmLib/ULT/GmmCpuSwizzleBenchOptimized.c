@@ -0,0 +1,79 @@
+/*==============================================================================
+Copyright(c) 2017 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and / or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+============================================================================*/
+
+// GmmCpuSwizzleBenchOptimized.c - Production build of CpuSwizzleBlt.c (same
+// source and flags as GmmLib's), with SIMD path selection for GMMBENCH.
+
+#define CPU_SWIZZLE_FEATURE_OVERRIDE
+int CpuSwizzleFeatureMask = ~0;
+
+#include "../Utility/CpuSwizzleBlt/CpuSwizzleBlt.c"
+
+/* SIMD paths GMMBENCH can restrict the cache-line kernels to, narrowest
+first. Paths missing from the CPU are skipped. */
+static const struct
+{
+    const char  *pName;
+    int         Required;   // CPU_SWIZZLE_FEATURE_* needed.
+    int         Mask;       // CPU_SWIZZLE_FEATURE_* allowed.
+} SimdPaths[] =
+{
+    #if(defined(__ARM_ARCH))
+        { "sse2neon",   0,                              ~CPU_SWIZZLE_FEATURE_NEON },
+        { "neon",       CPU_SWIZZLE_FEATURE_NEON,       ~0 },
+    #else
+        { "sse",        0,                              ~(CPU_SWIZZLE_FEATURE_AVX2 | CPU_SWIZZLE_FEATURE_AVX512F) },
+        { "avx2",       CPU_SWIZZLE_FEATURE_AVX2,       ~CPU_SWIZZLE_FEATURE_AVX512F },
+        { "avx512",     CPU_SWIZZLE_FEATURE_AVX512F,    ~0 },
+    #endif
+};
+
+
+const char *GmmBenchSelectSimdPath( // ########################################
+
+    /* Restricts CpuSwizzleBlt to given SIMD path, returning its name--or
+    returns NULL (and leaves selection unchanged) if path doesn't exist or
+    CPU lacks it. */
+
+    int Path)
+
+{ // ###########################################################################
+
+    int Features;
+
+    if((Path < 0) || (Path >= (int) (sizeof(SimdPaths) / sizeof(SimdPaths[0]))))
+    {
+        return(NULL);
+    }
+
+    CpuSwizzleFeatureMask = ~0;
+    Features = CpuSwizzleFeatures();
+
+    if((Features & SimdPaths[Path].Required) != SimdPaths[Path].Required)
+    {
+        return(NULL);
+    }
+
+    CpuSwizzleFeatureMask = SimdPaths[Path].Mask;
+
+    return(SimdPaths[Path].pName);
+}
@@ -4249,3 +4249,428 @@ TEST_F(CTestGen9Resource, TestStdSwizzle)
 {
     // TODO: Test RedescribedPlanes, along with other StdSwizzle mappings
 }
+
+/// @brief ULT for GetOffsetFromTable matching GetOffset
+TEST_F(CTestGen9Resource, TestOffsetTable)
+{
+    const struct
+    {
+        GMM_RESOURCE_TYPE   Type;
+        GMM_RESOURCE_FORMAT Format;
+        TEST_TILE_TYPE      Tiling;
+        uint32_t            Depth, ArraySize, MaxLod;
+    } Cases[] = {
+    {RESOURCE_2D, GMM_FORMAT_R8G8B8A8_UNORM, TEST_TILEYS, 1, 4, 6},
+    {RESOURCE_2D, GMM_FORMAT_R8G8B8A8_UNORM, TEST_LINEAR, 1, 3, 4},
+    {RESOURCE_CUBE, GMM_FORMAT_R8G8B8A8_UNORM, TEST_TILEY, 1, 2, 5},
+    {RESOURCE_3D, GMM_FORMAT_R8G8B8A8_UNORM, TEST_TILEYF, 16, 1, 4},
+    {RESOURCE_2D, GMM_FORMAT_NV12, TEST_TILEY, 1, 1, 0},
+    };
+
+    for(uint32_t c = 0; c < sizeof(Cases) / sizeof(Cases[0]); c++)
+    {
+        GMM_RESCREATE_PARAMS  gmmParams = {};
+        GMM_RESOURCE_INFO *   ResourceInfo;
+        GMM_RES_OFFSET_TABLE *pTable = NULL;
+
+        gmmParams.Type              = Cases[c].Type;
+        gmmParams.NoGfxMemory       = 1;
+        gmmParams.Flags.Gpu.Texture = 1;
+        gmmParams.Format            = Cases[c].Format;
+        gmmParams.BaseWidth64       = 256;
+        gmmParams.BaseHeight        = (Cases[c].Type == RESOURCE_CUBE) ? 256 : 200;
+        gmmParams.Depth             = Cases[c].Depth;
+        gmmParams.ArraySize         = Cases[c].ArraySize;
+        gmmParams.MaxLod            = Cases[c].MaxLod;
+        SetTileFlag(gmmParams, Cases[c].Tiling);
+
+        ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+        ASSERT_EQ(GMM_SUCCESS, ResourceInfo->CreateOffsetTable(&pTable));
+        ASSERT_TRUE(pTable != NULL);
+
+        uint8_t  StdLayout = (Cases[c].Tiling == TEST_TILEYS) || (Cases[c].Tiling == TEST_TILEYF);
+        uint32_t NumFaces  = (Cases[c].Type == RESOURCE_CUBE) ? 6 : 1;
+        uint32_t NumPlanes = (Cases[c].Format == GMM_FORMAT_NV12) ? 3 : 1;
+
+        for(uint32_t Mip = 0; Mip <= Cases[c].MaxLod; Mip++)
+        {
+            // Deliberately one past the last array and depth slices, which the
+            // table doesn't cover and must fall back on.
+            for(uint32_t Array = 0; Array <= Cases[c].ArraySize; Array++)
+            {
+                for(uint32_t Slice = 0; Slice <= (Cases[c].Depth >> Mip); Slice++)
+                {
+                    for(uint32_t Face = 0; Face < NumFaces; Face++)
+                    {
+                        for(uint32_t Plane = 0; Plane < NumPlanes; Plane++)
+                        {
+                            GMM_REQ_OFFSET_INFO Expected = {}, Actual;
+
+                            if(((Array == Cases[c].ArraySize) && (Cases[c].Type != RESOURCE_2D || Cases[c].Tiling != TEST_LINEAR)) ||
+                               ((Slice > 0) && (Cases[c].Type != RESOURCE_3D)))
+                            {
+                                continue; // Out of range for GetOffset too.
+                            }
+
+                            Expected.MipLevel     = Mip;
+                            Expected.ArrayIndex   = Array;
+                            Expected.Slice        = Slice;
+                            Expected.CubeFace     = (NumFaces > 1) ? (GMM_CUBE_FACE_ENUM)Face : __GMM_NO_CUBE_MAP;
+                            Expected.Plane        = (GMM_YUV_PLANE)Plane;
+                            Expected.ReqLock      = 1;
+                            Expected.ReqRender    = 1;
+                            Expected.ReqStdLayout = StdLayout;
+                            Actual                = Expected;
+
+                            EXPECT_EQ(GMM_SUCCESS, ResourceInfo->GetOffset(Expected));
+                            EXPECT_EQ(GMM_SUCCESS, ResourceInfo->GetOffsetFromTable(pTable, Actual));
+                            EXPECT_EQ(0, memcmp(&Expected, &Actual, sizeof(Actual))) << "Case " << c << " Mip " << Mip << " Array " << Array << " Slice " << Slice << " Face " << Face << " Plane " << Plane;
+                        }
+                    }
+                }
+            }
+        }
+
+        if(StdLayout)
+        {
+            // StdLayout size query isn't tabled, but must still work.
+            GMM_REQ_OFFSET_INFO Size = {};
+
+            Size.ReqStdLayout     = 1;
+            Size.StdLayout.Offset = -1;
+            EXPECT_EQ(GMM_SUCCESS, ResourceInfo->GetOffsetFromTable(pTable, Size));
+            EXPECT_EQ(ResourceInfo->GetStdLayoutSize(), Size.StdLayout.Offset);
+        }
+
+        ResourceInfo->DestroyOffsetTable(pTable);
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+}
+
+/// @brief ULT for GetAllSubresourceOffsets matching GetOffset
+TEST_F(CTestGen9Resource, TestAllSubresourceOffsets)
+{
+    const struct
+    {
+        GMM_RESOURCE_TYPE   Type;
+        GMM_RESOURCE_FORMAT Format;
+        TEST_TILE_TYPE      Tiling;
+        uint32_t            Height, Depth, ArraySize, MaxLod;
+    } Cases[] = {
+    {RESOURCE_2D, GMM_FORMAT_R8G8B8A8_UNORM, TEST_TILEY, 256, 1, 8, 4},  // Tile-row aligned QPitch
+    {RESOURCE_2D, GMM_FORMAT_R8G8B8A8_UNORM, TEST_TILEY, 200, 1, 8, 4},  // Unaligned QPitch
+    {RESOURCE_2D, GMM_FORMAT_R8G8B8A8_UNORM, TEST_TILEYS, 256, 1, 4, 8}, // Mip tail
+    {RESOURCE_2D, GMM_FORMAT_R8G8B8A8_UNORM, TEST_LINEAR, 100, 1, 5, 2},
+    {RESOURCE_CUBE, GMM_FORMAT_R8G8B8A8_UNORM, TEST_TILEY, 256, 1, 2, 5},
+    {RESOURCE_3D, GMM_FORMAT_R8G8B8A8_UNORM, TEST_TILEY, 64, 8, 1, 3},
+    {RESOURCE_2D, GMM_FORMAT_NV12, TEST_TILEY, 480, 1, 1, 0},
+    };
+
+    for(uint32_t c = 0; c < sizeof(Cases) / sizeof(Cases[0]); c++)
+    {
+        GMM_RESCREATE_PARAMS gmmParams = {};
+        GMM_RESOURCE_INFO *  ResourceInfo;
+
+        gmmParams.Type              = Cases[c].Type;
+        gmmParams.NoGfxMemory       = 1;
+        gmmParams.Flags.Gpu.Texture = 1;
+        gmmParams.Format            = Cases[c].Format;
+        gmmParams.BaseWidth64       = (Cases[c].Type == RESOURCE_CUBE) ? Cases[c].Height : 256;
+        gmmParams.BaseHeight        = Cases[c].Height;
+        gmmParams.Depth             = Cases[c].Depth;
+        gmmParams.ArraySize         = Cases[c].ArraySize;
+        gmmParams.MaxLod            = Cases[c].MaxLod;
+        SetTileFlag(gmmParams, Cases[c].Tiling);
+
+        ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        // Whole resource, then a sub-range.
+        for(uint32_t Partial = 0; Partial < 2; Partial++)
+        {
+            GMM_SUBRESOURCE_RANGE Range = {};
+
+            Range.FirstMip   = Partial ? Cases[c].MaxLod / 2 : 0;
+            Range.NumMips    = Cases[c].MaxLod + 1 - Range.FirstMip;
+            Range.FirstArray = Partial ? Cases[c].ArraySize / 2 : 0;
+            Range.NumArray   = Cases[c].ArraySize - Range.FirstArray;
+
+            uint32_t Count = ResourceInfo->GetAllSubresourceOffsets(&Range, NULL, 0);
+            ASSERT_LT(0u, Count);
+
+            // Too small a buffer is left untouched.
+            std::vector<GMM_SUBRESOURCE_OFFSET> Offsets(Count);
+            memset(&Offsets[0], 0xcd, Count * sizeof(Offsets[0]));
+            EXPECT_EQ(Count, ResourceInfo->GetAllSubresourceOffsets(&Range, &Offsets[0], Count - 1));
+            EXPECT_EQ(0xcdcdcdcd, Offsets[0].MipLevel);
+
+            ASSERT_EQ(Count, ResourceInfo->GetAllSubresourceOffsets(&Range, &Offsets[0], Count));
+
+            for(uint32_t i = 0; i < Count; i++)
+            {
+                GMM_REQ_OFFSET_INFO ReqInfo = {};
+
+                ReqInfo.MipLevel   = Offsets[i].MipLevel;
+                ReqInfo.ArrayIndex = Offsets[i].ArrayIndex;
+                ReqInfo.Slice      = Offsets[i].Slice;
+                ReqInfo.CubeFace   = Offsets[i].CubeFace;
+                ReqInfo.Plane      = Offsets[i].Plane;
+                ReqInfo.ReqLock    = 1;
+                ReqInfo.ReqRender  = 1;
+                ASSERT_EQ(GMM_SUCCESS, ResourceInfo->GetOffset(ReqInfo));
+
+                EXPECT_EQ(ReqInfo.Render.Offset64, Offsets[i].RenderOffset) << "Case " << c << " Entry " << i;
+                EXPECT_EQ(ReqInfo.Render.XOffset, Offsets[i].RenderXOffset) << "Case " << c << " Entry " << i;
+                EXPECT_EQ(ReqInfo.Render.YOffset, Offsets[i].RenderYOffset) << "Case " << c << " Entry " << i;
+                EXPECT_EQ(ReqInfo.Render.ZOffset, Offsets[i].RenderZOffset) << "Case " << c << " Entry " << i;
+                EXPECT_EQ(ReqInfo.Lock.Offset64, Offsets[i].LockOffset) << "Case " << c << " Entry " << i;
+                EXPECT_EQ(ReqInfo.Lock.Pitch, Offsets[i].LockPitch) << "Case " << c << " Entry " << i;
+            }
+        }
+
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+}
+
+/// @brief ULT for GetMappingSpans matching GetMappingSpanDesc
+TEST_F(CTestGen9Resource, TestMappingSpans)
+{
+    const struct
+    {
+        GMM_RESOURCE_FORMAT  Format;
+        GMM_GET_MAPPING_TYPE Type;
+        uint32_t             Width, Height, ArraySize, MaxLod;
+    } Cases[] = {
+    {GMM_FORMAT_R8G8B8A8_UNORM, GMM_MAPPING_GEN9_YS_TO_STDSWIZZLE, 512, 512, 1, 0},  // Pitch == tile-aligned width
+    {GMM_FORMAT_R8G8B8A8_UNORM, GMM_MAPPING_GEN9_YS_TO_STDSWIZZLE, 300, 600, 4, 3},
+    {GMM_FORMAT_NV12, GMM_MAPPING_YUVPLANAR, 256, 256, 2, 0},
+    };
+
+    for(uint32_t c = 0; c < sizeof(Cases) / sizeof(Cases[0]); c++)
+    {
+        GMM_RESCREATE_PARAMS          gmmParams = {};
+        GMM_RESOURCE_INFO *           ResourceInfo;
+        std::vector<GMM_MAPPING_SPAN> Raw;
+
+        gmmParams.Type                   = RESOURCE_2D;
+        gmmParams.NoGfxMemory            = 1;
+        gmmParams.Flags.Gpu.Texture      = 1;
+        gmmParams.Flags.Info.StdSwizzle  = 1;
+        gmmParams.Format                 = Cases[c].Format;
+        gmmParams.BaseWidth64            = Cases[c].Width;
+        gmmParams.BaseHeight             = Cases[c].Height;
+        gmmParams.Depth                  = 1;
+        gmmParams.ArraySize              = Cases[c].ArraySize;
+        gmmParams.MaxLod                 = Cases[c].MaxLod;
+        SetTileFlag(gmmParams, TEST_TILEYS);
+
+        ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        // Spans as iterated one per call.
+        for(uint32_t Slice = 0; Slice < ((Cases[c].Type == GMM_MAPPING_YUVPLANAR) ? Cases[c].ArraySize : 1); Slice++)
+        {
+            GMM_GET_MAPPING Mapping = {};
+            uint8_t         More;
+
+            Mapping.Type          = Cases[c].Type;
+            Mapping.Scratch.Slice = Slice;
+            do
+            {
+                More = ResourceInfo->GetMappingSpanDesc(&Mapping);
+                if(Mapping.Span.Size)
+                {
+                    GMM_MAPPING_SPAN Span = {Mapping.Span.VirtualOffset, Mapping.Span.PhysicalOffset, Mapping.Span.Size};
+                    Raw.push_back(Span);
+                }
+            } while(More);
+        }
+
+        uint32_t Count = ResourceInfo->GetMappingSpans(Cases[c].Type, NULL, 0);
+        ASSERT_LT(0u, Count);
+        EXPECT_GE(Raw.size(), Count);
+
+        std::vector<GMM_MAPPING_SPAN> Spans(Count + 1);
+        memset(&Spans[0], 0xcd, Spans.size() * sizeof(Spans[0]));
+        EXPECT_EQ(Count, ResourceInfo->GetMappingSpans(Cases[c].Type, &Spans[0], Count - 1));
+        EXPECT_EQ(0xcdcdcdcdcdcdcdcdull, Spans[Count - 1].Size); // Truncated.
+        ASSERT_EQ(Count, ResourceInfo->GetMappingSpans(Cases[c].Type, &Spans[0], Count + 1));
+        EXPECT_EQ(0xcdcdcdcdcdcdcdcdull, Spans[Count].Size);
+
+        // Same pages as iterated, mapped the same way, and fully coalesced.
+        GMM_GFX_SIZE_T RawSize = 0, Size = 0;
+        for(uint32_t i = 0; i < Raw.size(); i++)
+        {
+            uint32_t j;
+
+            RawSize += Raw[i].Size;
+            for(j = 0; j < Count; j++)
+            {
+                // Unsigned differences, as planar spans may start at a negative virtual offset.
+                if((Raw[i].VirtualOffset - Spans[j].VirtualOffset < Spans[j].Size) &&
+                   (Raw[i].VirtualOffset - Spans[j].VirtualOffset + Raw[i].Size <= Spans[j].Size) &&
+                   (Raw[i].PhysicalOffset - Raw[i].VirtualOffset == Spans[j].PhysicalOffset - Spans[j].VirtualOffset))
+                {
+                    break;
+                }
+            }
+            EXPECT_LT(j, Count) << "Case " << c << " Span " << i;
+        }
+
+        for(uint32_t j = 0; j < Count; j++)
+        {
+            Size += Spans[j].Size;
+            if(j)
+            {
+                EXPECT_FALSE((Spans[j - 1].VirtualOffset + Spans[j - 1].Size == Spans[j].VirtualOffset) &&
+                             (Spans[j - 1].PhysicalOffset + Spans[j - 1].Size == Spans[j].PhysicalOffset))
+                << "Case " << c << " Span " << j;
+            }
+        }
+        EXPECT_EQ(RawSize, Size);
+
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+}
+
+/// @brief ULT for GetTileModeAdvice matching explicitly tiled creates
+TEST_F(CTestGen9Resource, TestTileModeAdvice)
+{
+    const TEST_TILE_TYPE Tiles[] = {TEST_LINEAR, TEST_TILEX, TEST_TILEY, TEST_TILEYS};
+    GMM_RESCREATE_PARAMS   gmmParams = {};
+    GMM_TILE_ADVICE        Advice;
+    GMM_LAYOUT_CACHE_STATS Before, After;
+
+    gmmParams.Type              = RESOURCE_2D;
+    gmmParams.NoGfxMemory       = 1;
+    gmmParams.Flags.Gpu.Texture = 1;
+    gmmParams.Format            = GMM_FORMAT_R8G8B8A8_UNORM;
+    gmmParams.BaseWidth64       = 1000;
+    gmmParams.BaseHeight        = 700;
+    gmmParams.Depth             = 1;
+    gmmParams.ArraySize         = 3;
+    gmmParams.MaxLod            = 4;
+
+    pGmmULTClientContext->SetLayoutCacheEnable(true);
+    pGmmULTClientContext->GetLayoutCacheStats(&Before);
+    ASSERT_EQ(GMM_SUCCESS, pGmmULTClientContext->GetTileModeAdvice(&gmmParams, &Advice));
+    EXPECT_EQ(GMM_TILE_ADVICE_TILEY, Advice.Default);
+
+    // Candidate creates leave the layout cache alone, even when opted in.
+    pGmmULTClientContext->GetLayoutCacheStats(&After);
+    pGmmULTClientContext->SetLayoutCacheEnable(false);
+    EXPECT_EQ(Before.Entries, After.Entries);
+    EXPECT_EQ(Before.Hits, After.Hits);
+    EXPECT_EQ(Before.Misses, After.Misses);
+    EXPECT_EQ(Before.Evictions, After.Evictions);
+    EXPECT_EQ(0, Advice.Modes[GMM_TILE_ADVICE_TILE4].Valid);  // No Tile4/64 on Gen9.
+    EXPECT_EQ(0, Advice.Modes[GMM_TILE_ADVICE_TILE64].Valid);
+
+    // Same texel payload under every mode: 1000x700 RGBA, 5 MIPs, 3 slices.
+    GMM_GFX_SIZE_T Payload = 0;
+    for(uint32_t Lod = 0; Lod <= gmmParams.MaxLod; Lod++)
+    {
+        Payload += (GMM_GFX_SIZE_T)GFX_MAX(1000u >> Lod, 1u) * GFX_MAX(700u >> Lod, 1u) * 4 * 3;
+    }
+
+    for(uint32_t i = 0; i < sizeof(Tiles) / sizeof(Tiles[0]); i++)
+    {
+        const GMM_TILE_ADVICE_ENTRY &Entry  = Advice.Modes[GMM_TILE_ADVICE_LINEAR + i];
+        GMM_RESCREATE_PARAMS         Params = gmmParams;
+        GMM_RESOURCE_INFO *          ResourceInfo;
+
+        ASSERT_EQ(1, Entry.Valid) << "Mode " << i;
+
+        SetTileFlag(Params, Tiles[i]);
+        ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&Params);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        EXPECT_EQ(ResourceInfo->GetSizeMainSurface(), Entry.Size) << "Mode " << i;
+        EXPECT_EQ(ResourceInfo->GetBaseAlignment(), Entry.BaseAlignment) << "Mode " << i;
+        EXPECT_EQ(ResourceInfo->GetRenderPitch(), Entry.Pitch) << "Mode " << i;
+        EXPECT_EQ(0, Entry.Compressible) << "Mode " << i;   // None requested.
+        EXPECT_EQ(Entry.Size - Payload, Entry.PaddingWaste) << "Mode " << i;
+
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+
+    // Y-major only usage drops Linear/TileX.
+    gmmParams.Flags.Gpu.Depth = 1;
+    gmmParams.Format          = GMM_FORMAT_D32_FLOAT;
+    gmmParams.MaxLod          = 0;
+    ASSERT_EQ(GMM_SUCCESS, pGmmULTClientContext->GetTileModeAdvice(&gmmParams, &Advice));
+    EXPECT_EQ(0, Advice.Modes[GMM_TILE_ADVICE_LINEAR].Valid);
+    EXPECT_EQ(0, Advice.Modes[GMM_TILE_ADVICE_TILEX].Valid);
+    EXPECT_EQ(1, Advice.Modes[GMM_TILE_ADVICE_TILEY].Valid);
+}
+
+/// @brief ULT for EstimateResourceSize matching created resources
+TEST_F(CTestGen9Resource, TestEstimateResourceSize)
+{
+    const struct
+    {
+        GMM_RESOURCE_TYPE   Type;
+        GMM_RESOURCE_FORMAT Format;
+        TEST_TILE_TYPE      Tiling;
+        uint32_t            Width, Height, Depth, ArraySize, MaxLod;
+        uint8_t             UnifiedCCS;
+    } Cases[] = {
+    {RESOURCE_BUFFER, GMM_FORMAT_GENERIC_8BIT, TEST_LINEAR, 12345, 1, 1, 1, 0, 0},
+    {RESOURCE_2D, GMM_FORMAT_R8G8B8A8_UNORM, TEST_TILEY, 1920, 1080, 1, 1, 0, 1},
+    {RESOURCE_2D, GMM_FORMAT_R8G8B8A8_UNORM, TEST_TILEYS, 300, 200, 1, 6, 5, 0},
+    {RESOURCE_3D, GMM_FORMAT_R32_FLOAT, TEST_TILEY, 64, 64, 16, 1, 3, 0},
+    {RESOURCE_2D, GMM_FORMAT_NV12, TEST_TILEY, 720, 480, 1, 1, 0, 0},
+    };
+
+    pGmmULTClientContext->SetLayoutCacheEnable(true);
+
+    for(uint32_t c = 0; c < sizeof(Cases) / sizeof(Cases[0]); c++)
+    {
+        GMM_RESCREATE_PARAMS   gmmParams = {};
+        GMM_SIZE_ESTIMATE      Estimate;
+        GMM_RESOURCE_INFO *    ResourceInfo;
+        GMM_LAYOUT_CACHE_STATS Before, After;
+
+        gmmParams.Type                        = Cases[c].Type;
+        gmmParams.NoGfxMemory                 = 1;
+        gmmParams.Flags.Gpu.Texture           = 1;
+        gmmParams.Flags.Gpu.RenderTarget      = Cases[c].UnifiedCCS;
+        gmmParams.Flags.Gpu.CCS               = Cases[c].UnifiedCCS;
+        gmmParams.Flags.Gpu.UnifiedAuxSurface = Cases[c].UnifiedCCS;
+        gmmParams.Format                      = Cases[c].Format;
+        gmmParams.BaseWidth64                 = Cases[c].Width;
+        gmmParams.BaseHeight                  = Cases[c].Height;
+        gmmParams.Depth                       = Cases[c].Depth;
+        gmmParams.ArraySize                   = Cases[c].ArraySize;
+        gmmParams.MaxLod                      = Cases[c].MaxLod;
+        SetTileFlag(gmmParams, Cases[c].Tiling);
+
+        pGmmULTClientContext->GetLayoutCacheStats(&Before);
+        ASSERT_EQ(GMM_SUCCESS, pGmmULTClientContext->EstimateResourceSize(&gmmParams, &Estimate)) << "Case " << c;
+
+        // Estimates leave the layout cache alone, even when opted in.
+        pGmmULTClientContext->GetLayoutCacheStats(&After);
+        EXPECT_EQ(Before.Entries, After.Entries) << "Case " << c;
+        EXPECT_EQ(Before.Hits, After.Hits) << "Case " << c;
+        EXPECT_EQ(Before.Misses, After.Misses) << "Case " << c;
+        EXPECT_EQ(Before.Evictions, After.Evictions) << "Case " << c;
+
+        ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        EXPECT_EQ(ResourceInfo->GetSizeAllocation(), Estimate.SizeAllocation) << "Case " << c;
+        EXPECT_EQ(ResourceInfo->GetSizeMainSurface(), Estimate.SizeMainSurface) << "Case " << c;
+        EXPECT_EQ(ResourceInfo->GetSizeAuxSurface(GMM_AUX_SURF), Estimate.SizeAuxSurface) << "Case " << c;
+        EXPECT_EQ(ResourceInfo->GetBaseAlignment(), Estimate.BaseAlignment) << "Case " << c;
+        EXPECT_EQ(ResourceInfo->Is64KBPageSuitable(), Estimate.Is64KBPageSuitable) << "Case " << c;
+        if(Cases[c].UnifiedCCS)
+        {
+            EXPECT_LT(0u, Estimate.SizeAuxSurface);
+        }
+
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+
+    pGmmULTClientContext->SetLayoutCacheEnable(false);
+}
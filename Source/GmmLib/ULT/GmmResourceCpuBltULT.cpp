@@ -24,6 +24,15 @@ OTHER DEALINGS IN THE SOFTWARE.
 
 using namespace std;
 
+#ifdef _WIN32
+#define ULT_ALIGNED_MALLOC(Size, alignBytes) _aligned_malloc(Size, alignBytes)
+#define ULT_ALIGNED_FREE(ptr) _aligned_free(ptr)
+#else
+#include <malloc.h>
+#define ULT_ALIGNED_MALLOC(Size, alignBytes) memalign(alignBytes, Size)
+#define ULT_ALIGNED_FREE(ptr) free(ptr)
+#endif
+
 
 /////////////////////////////////////////////////////////////////////////////////////
 /// CTestCpuBltResource Constructor
@@ -41,12 +50,88 @@ CTestCpuBltResource::~CTestCpuBltResource()
 {
 }
 
+/////////////////////////////////////////////////////////////////////////////////////
+/// Sets up common environment for CpuBlt fixture tests. this is called once per
+/// test case before executing all tests under resource fixture test case.
+/// It also calls SetupTestCase from CommonULT to initialize global context and others.
+///
+/////////////////////////////////////////////////////////////////////////////////////
 void CTestCpuBltResource::SetUpTestCase()
 {
+    printf("%s\n", __FUNCTION__);
+
+    GfxPlatform.eProductFamily    = IGFX_BROADWELL;
+    GfxPlatform.eRenderCoreFamily = IGFX_GEN8_CORE;
+
+    CommonULT::SetUpTestCase();
 }
 
+/////////////////////////////////////////////////////////////////////////////////////
+/// Cleans up once all the tests finish execution.  It also calls TearDownTestCase
+/// from CommonULT to destroy global context and others.
+///
+/////////////////////////////////////////////////////////////////////////////////////
 void CTestCpuBltResource::TearDownTestCase()
 {
+    printf("%s\n", __FUNCTION__);
+
+    CommonULT::TearDownTestCase();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Reference (bit-by-bit) swizzle of surface byte (x, y), independent of the
+/// library's CpuSwizzleBlt/SwizzleOffset implementation.
+///
+/// @param[in]  pSwizzle: Swizzle descriptor of the surface
+/// @param[in]  Pitch: Surface pitch in bytes
+/// @param[in]  x: Horizontal byte offset
+/// @param[in]  y: Row
+/// @return     Byte offset of (x, y) within swizzled surface
+/////////////////////////////////////////////////////////////////////////////////////
+static uint64_t RefSwizzleOffset(const SWIZZLE_DESCRIPTOR *pSwizzle, uint32_t Pitch, uint32_t x, uint32_t y)
+{
+    uint32_t TileWidthBits = 0, TileHeightBits = 0, TileSizeBits = 0;
+    uint64_t Offset = 0;
+    uint32_t Bit, xBit = 0, yBit = 0;
+
+    for(Bit = 0; Bit < 32; Bit++)
+    {
+        TileWidthBits += (pSwizzle->Mask.x >> Bit) & 1;
+        TileHeightBits += (pSwizzle->Mask.y >> Bit) & 1;
+        TileSizeBits += ((pSwizzle->Mask.x | pSwizzle->Mask.y | pSwizzle->Mask.z) >> Bit) & 1;
+    }
+
+    for(Bit = 0; Bit < TileSizeBits; Bit++)
+    {
+        if(pSwizzle->Mask.x & (1 << Bit))
+        {
+            Offset |= (uint64_t)((x >> xBit++) & 1) << Bit;
+        }
+        else if(pSwizzle->Mask.y & (1 << Bit))
+        {
+            Offset |= (uint64_t)((y >> yBit++) & 1) << Bit;
+        }
+    }
+
+    Offset += ((uint64_t)(y >> TileHeightBits) * (Pitch >> TileWidthBits) + (x >> TileWidthBits)) << TileSizeBits;
+
+    return Offset;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns whether pixel (x, y) lies in any of the given CpuBltRects rects.
+/////////////////////////////////////////////////////////////////////////////////////
+static bool RectsContain(const GMM_RES_COPY_BLT_RECT *pRects, uint32_t NumRects, uint32_t x, uint32_t y)
+{
+    for(uint32_t r = 0; r < NumRects; r++)
+    {
+        if((x >= pRects[r].OffsetX) && (x < pRects[r].OffsetX + pRects[r].Width) &&
+           (y >= pRects[r].OffsetY) && (y < pRects[r].OffsetY + pRects[r].Height))
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 /// @brief ULT for 1D Resource
@@ -57,6 +142,1401 @@ TEST_F(CTestCpuBltResource, TestCpuBlt1D)
 /// @brief ULT for 2D Resource
 TEST_F(CTestCpuBltResource, TestCpuBlt2D)
 {
+    const uint32_t Width = 203, Height = 71; // Not tile-aligned, to exercise crusts and partial transfers.
+
+    GMM_RESCREATE_PARAMS gmmParams = {};
+    gmmParams.Type                 = RESOURCE_2D;
+    gmmParams.NoGfxMemory          = 1;
+    gmmParams.Flags.Info.TiledY    = 1;
+    gmmParams.Flags.Gpu.Texture    = 1;
+    gmmParams.BaseWidth64          = Width;
+    gmmParams.BaseHeight           = Height;
+
+    for(uint32_t i = 0; i < TEST_BPP_MAX; i++)
+    {
+        TEST_BPP bpp      = static_cast<TEST_BPP>(i);
+        gmmParams.Format  = SetResourceFormat(bpp);
+        uint32_t BytesPP  = GetBppValue(bpp);
+        uint32_t RowBytes = Width * BytesPP;
+
+        GMM_RESOURCE_INFO *ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        const SWIZZLE_DESCRIPTOR *pSwizzle = pGmmULTClientContext->GetSwizzleDesc(TILEY, Res_2D, BytesPP * 8);
+        ASSERT_TRUE(pSwizzle != NULL);
+
+        uint32_t Pitch    = GFX_ULONG_CAST(ResourceInfo->GetRenderPitch());
+        uint8_t *pSurf    = (uint8_t *)ULT_ALIGNED_MALLOC(ResourceInfo->GetSizeSurface(), 64); // Cache-line aligned, as CPU mappings are.
+        uint8_t *Linear   = (uint8_t *)malloc(RowBytes * Height);
+        uint8_t *ReadBack = (uint8_t *)malloc(RowBytes * Height);
+        memset(pSurf, 0, ResourceInfo->GetSizeSurface());
+
+        for(uint32_t n = 0; n < RowBytes * Height; n++)
+        {
+            Linear[n] = (uint8_t)(n * 7 + (n >> 8) * 13 + 1);
+        }
+
+        // Upload whole surface...
+        GMM_RES_COPY_BLT Blt = {};
+        Blt.Gpu.pData        = pSurf;
+        Blt.Sys.pData        = Linear;
+        Blt.Sys.RowPitch     = RowBytes;
+        Blt.Sys.BufferSize   = RowBytes * Height;
+        Blt.Blt.Width        = Width;
+        Blt.Blt.Height       = Height;
+        Blt.Blt.Slices       = 1;
+        Blt.Blt.Upload       = 1;
+        EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+
+        for(uint32_t y = 0; y < Height; y++)
+        {
+            for(uint32_t x = 0; x < RowBytes; x++)
+            {
+                ASSERT_EQ(Linear[y * RowBytes + x], pSurf[RefSwizzleOffset(pSwizzle, Pitch, x, y)]);
+            }
+        }
+
+        // Download unaligned sub-rectangle...
+        const uint32_t OffsetX = 3, OffsetY = 5;
+        Blt.Sys.pData          = ReadBack;
+        Blt.Gpu.OffsetX        = OffsetX;
+        Blt.Gpu.OffsetY        = OffsetY;
+        Blt.Blt.Width          = Width - OffsetX;
+        Blt.Blt.Height         = Height - OffsetY;
+        Blt.Blt.Upload         = 0;
+        EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+
+        for(uint32_t y = 0; y < Height - OffsetY; y++)
+        {
+            ASSERT_EQ(0, memcmp(&ReadBack[y * RowBytes],
+                                &Linear[(y + OffsetY) * RowBytes + OffsetX * BytesPP],
+                                (Width - OffsetX) * BytesPP));
+        }
+
+        free(ReadBack);
+        free(Linear);
+        ULT_ALIGNED_FREE(pSurf);
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+}
+
+/// Caller-pool stand-in for CpuBltParallel ULT: runs tasks in reverse order.
+static void GMM_STDCALL ReverseParallelFor(void *pPoolContext, uint32_t NumTasks, PFN_GMM_TASK pfnTask, void *pTaskContext)
+{
+    *(uint32_t *)pPoolContext = NumTasks;
+    for(uint32_t i = NumTasks; i > 0; i--)
+    {
+        pfnTask(pTaskContext, i - 1);
+    }
+}
+
+/// @brief ULT for CpuBltParallel--must be bit-exact with CpuBlt
+TEST_F(CTestCpuBltResource, TestCpuBltParallel)
+{
+    const uint32_t Width = 1000, Height = 301, OffsetY = 13, ArraySize = 2;
+
+    GMM_RESCREATE_PARAMS gmmParams = {};
+    gmmParams.Type                 = RESOURCE_2D;
+    gmmParams.NoGfxMemory          = 1;
+    gmmParams.Flags.Gpu.Texture    = 1;
+    gmmParams.Format               = SetResourceFormat(TEST_BPP_32);
+    gmmParams.BaseWidth64          = Width;
+    gmmParams.BaseHeight           = Height;
+    gmmParams.ArraySize            = ArraySize;
+
+    for(uint32_t Tiling = 0; Tiling < 3; Tiling++)
+    {
+        gmmParams.Flags.Info.Linear = (Tiling == 0);
+        gmmParams.Flags.Info.TiledX = (Tiling == 1);
+        gmmParams.Flags.Info.TiledY = (Tiling == 2);
+
+        GMM_RESOURCE_INFO *ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        size_t   SurfSize   = GFX_ULONG_CAST(ResourceInfo->GetSizeSurface());
+        uint32_t RowBytes   = Width * 4;
+        uint32_t SlicePitch = RowBytes * Height;
+        uint8_t *pSerial    = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+        uint8_t *pParallel  = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+        uint8_t *Linear     = (uint8_t *)malloc(SlicePitch * ArraySize);
+        memset(pSerial, 0, SurfSize);
+        memset(pParallel, 0, SurfSize);
+
+        for(uint32_t n = 0; n < SlicePitch * ArraySize; n++)
+        {
+            Linear[n] = (uint8_t)(n * 11 + (n >> 10));
+        }
+
+        GMM_RES_COPY_BLT Blt = {};
+        Blt.Gpu.pData        = pSerial;
+        Blt.Gpu.OffsetY      = OffsetY;
+        Blt.Sys.pData        = Linear;
+        Blt.Sys.RowPitch     = RowBytes;
+        Blt.Sys.SlicePitch   = SlicePitch;
+        Blt.Sys.BufferSize   = SlicePitch * ArraySize;
+        Blt.Blt.Width        = Width;
+        Blt.Blt.Height       = Height - OffsetY;
+        Blt.Blt.Slices       = ArraySize;
+        Blt.Blt.Upload       = 1;
+        EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+
+        // GmmLib-internal threads...
+        GMM_TASK_PARALLEL Parallel = {};
+        Parallel.MaxThreads                = 4;
+        Blt.Gpu.pData                      = pParallel;
+        EXPECT_EQ(1, ResourceInfo->CpuBltParallel(&Blt, &Parallel));
+        EXPECT_EQ(0, memcmp(pSerial, pParallel, SurfSize));
+
+        // Caller-provided pool...
+        uint32_t NumTasks       = 0;
+        Parallel.pfnParallelFor = ReverseParallelFor;
+        Parallel.pPoolContext   = &NumTasks;
+        memset(pParallel, 0, SurfSize);
+        EXPECT_EQ(1, ResourceInfo->CpuBltParallel(&Blt, &Parallel));
+        EXPECT_GT(NumTasks, 1u);
+        EXPECT_EQ(0, memcmp(pSerial, pParallel, SurfSize));
+
+        free(Linear);
+        ULT_ALIGNED_FREE(pParallel);
+        ULT_ALIGNED_FREE(pSerial);
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+}
+
+/// Band producer/consumer for CpuBltStream ULT: copies bands to/from a linear image.
+typedef struct
+{
+    uint8_t *pImage;
+    uint32_t RowBytes, SlicePitch, OffsetY;
+    uint8_t  Upload;
+    uint32_t NumBands, AbortAt;
+} ULT_STREAM_CONTEXT;
+
+static uint8_t GMM_STDCALL StreamBand(void *pStreamContext, uint32_t Slice, uint32_t FirstRow, uint32_t NumRows, void *pBand, uint32_t RowPitch)
+{
+    ULT_STREAM_CONTEXT *pContext = (ULT_STREAM_CONTEXT *)pStreamContext;
+
+    if(++pContext->NumBands == pContext->AbortAt)
+    {
+        return 0;
+    }
+
+    for(uint32_t y = 0; y < NumRows; y++)
+    {
+        uint8_t *pImageRow = pContext->pImage + Slice * pContext->SlicePitch + (pContext->OffsetY + FirstRow + y) * pContext->RowBytes;
+        uint8_t *pBandRow  = (uint8_t *)pBand + y * RowPitch;
+
+        if(pContext->Upload)
+        {
+            memcpy(pBandRow, pImageRow, pContext->RowBytes);
+        }
+        else
+        {
+            memcpy(pImageRow, pBandRow, pContext->RowBytes);
+        }
+    }
+
+    return 1;
+}
+
+/// @brief ULT for CpuBltStream--must be bit-exact with CpuBlt, with and without overlap
+TEST_F(CTestCpuBltResource, TestCpuBltStream)
+{
+    const uint32_t Width = 1000, Height = 301, OffsetY = 13, ArraySize = 2;
+
+    GMM_RESCREATE_PARAMS gmmParams = {};
+    gmmParams.Type                 = RESOURCE_2D;
+    gmmParams.NoGfxMemory          = 1;
+    gmmParams.Flags.Info.TiledY    = 1;
+    gmmParams.Flags.Gpu.Texture    = 1;
+    gmmParams.Format               = SetResourceFormat(TEST_BPP_32);
+    gmmParams.BaseWidth64          = Width;
+    gmmParams.BaseHeight           = Height;
+    gmmParams.ArraySize            = ArraySize;
+
+    GMM_RESOURCE_INFO *ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+    ASSERT_TRUE(ResourceInfo != NULL);
+
+    size_t   SurfSize   = GFX_ULONG_CAST(ResourceInfo->GetSizeSurface());
+    uint32_t RowBytes   = Width * 4;
+    uint32_t SlicePitch = RowBytes * Height;
+    uint8_t *pSerial    = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+    uint8_t *pStreamed  = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+    uint8_t *Linear     = (uint8_t *)malloc(SlicePitch * ArraySize);
+    uint8_t *ReadBack   = (uint8_t *)malloc(SlicePitch * ArraySize);
+    memset(pSerial, 0, SurfSize);
+
+    for(uint32_t n = 0; n < SlicePitch * ArraySize; n++)
+    {
+        Linear[n] = (uint8_t)(n * 13 + (n >> 9));
+    }
+
+    GMM_RES_COPY_BLT Blt = {};
+    Blt.Gpu.pData        = pSerial;
+    Blt.Gpu.OffsetY      = OffsetY;
+    Blt.Sys.pData        = Linear + OffsetY * RowBytes;
+    Blt.Sys.RowPitch     = RowBytes;
+    Blt.Sys.SlicePitch   = SlicePitch;
+    Blt.Sys.BufferSize   = SlicePitch * ArraySize - OffsetY * RowBytes;
+    Blt.Blt.Width        = Width;
+    Blt.Blt.Height       = Height - OffsetY;
+    Blt.Blt.Slices       = ArraySize;
+    Blt.Blt.Upload       = 1;
+    EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+
+    for(uint8_t Overlap = 0; Overlap < 2; Overlap++)
+    {
+        GMM_RES_COPY_BLT_STREAM Stream  = {};
+        ULT_STREAM_CONTEXT      Context = {};
+        Stream.pfnBand                  = StreamBand;
+        Stream.pStreamContext           = &Context;
+        Stream.BandTileRows             = 2;
+        Stream.Overlap                  = Overlap;
+        Context.RowBytes                = RowBytes;
+        Context.SlicePitch              = SlicePitch;
+        Context.OffsetY                 = OffsetY;
+
+        // Upload...
+        GMM_RES_COPY_BLT StreamBlt = Blt;
+        StreamBlt.Gpu.pData        = pStreamed;
+        StreamBlt.Sys.pData        = NULL;
+        StreamBlt.Sys.RowPitch     = 0;
+        StreamBlt.Sys.BufferSize   = 0;
+        Context.pImage             = Linear;
+        Context.Upload             = 1;
+        memset(pStreamed, 0, SurfSize);
+        EXPECT_EQ(1, ResourceInfo->CpuBltStream(&StreamBlt, &Stream));
+        EXPECT_GT(Context.NumBands, 2 * ArraySize);
+        EXPECT_EQ(0, memcmp(pSerial, pStreamed, SurfSize));
+
+        // Download...
+        Context.pImage           = ReadBack;
+        Context.Upload           = 0;
+        Context.NumBands         = 0;
+        StreamBlt.Blt.Upload     = 0;
+        memset(ReadBack, 0, SlicePitch * ArraySize);
+        EXPECT_EQ(1, ResourceInfo->CpuBltStream(&StreamBlt, &Stream));
+        for(uint32_t Slice = 0; Slice < ArraySize; Slice++)
+        {
+            uint32_t Offset = Slice * SlicePitch + OffsetY * RowBytes;
+            EXPECT_EQ(0, memcmp(&ReadBack[Offset], &Linear[Offset], (Height - OffsetY) * RowBytes));
+        }
+
+        // Abort...
+        Context.NumBands = 0;
+        Context.AbortAt  = 3;
+        EXPECT_EQ(0, ResourceInfo->CpuBltStream(&StreamBlt, &Stream));
+        EXPECT_EQ(3u, Context.NumBands);
+    }
+
+    free(ReadBack);
+    free(Linear);
+    ULT_ALIGNED_FREE(pStreamed);
+    ULT_ALIGNED_FREE(pSerial);
+    pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+}
+
+/// @brief ULT for CpuBltConvert--converting BLT's must match a plain CpuBlt of
+/// pre-converted pixels, and round-trip
+TEST_F(CTestCpuBltResource, TestCpuBltConvert)
+{
+    const uint32_t Width = 97, Height = 45;
+
+    struct
+    {
+        GMM_RESOURCE_FORMAT ResFormat, SysFormat;
+        uint32_t            SysPixelPitch;
+    } Cases[] =
+    {
+        {GMM_FORMAT_R8G8B8A8_UNORM, GMM_FORMAT_B8G8R8A8_UNORM, 4},
+        {GMM_FORMAT_R8G8B8X8_UNORM, GMM_FORMAT_R8G8B8_UNORM, 3},
+        {GMM_FORMAT_R24G8_TYPELESS, GMM_FORMAT_D24_UNORM_X8_UINT, 4},
+    };
+
+    for(uint32_t c = 0; c < sizeof(Cases) / sizeof(Cases[0]); c++)
+    {
+        GMM_RESCREATE_PARAMS gmmParams = {};
+        gmmParams.Type                 = RESOURCE_2D;
+        gmmParams.NoGfxMemory          = 1;
+        gmmParams.Flags.Info.TiledY    = 1;
+        gmmParams.Flags.Gpu.Texture    = 1;
+        gmmParams.Format               = Cases[c].ResFormat;
+        gmmParams.BaseWidth64          = Width;
+        gmmParams.BaseHeight           = Height;
+        gmmParams.ArraySize            = 1;
+
+        GMM_RESOURCE_INFO *ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        uint8_t  Split      = (Cases[c].ResFormat == GMM_FORMAT_R24G8_TYPELESS);
+        size_t   SurfSize   = GFX_ULONG_CAST(ResourceInfo->GetSizeSurface());
+        uint32_t SysPitch   = Width * Cases[c].SysPixelPitch;
+        uint8_t *pConverted = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+        uint8_t *pExpected  = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+        uint8_t *Sys        = (uint8_t *)malloc(SysPitch * Height);
+        uint8_t *Sys2       = (uint8_t *)malloc(Width * Height);
+        uint8_t *Res        = (uint8_t *)malloc(Width * 4 * Height);
+        uint8_t *ReadBack   = (uint8_t *)malloc(SysPitch * Height);
+        uint8_t *ReadBack2  = (uint8_t *)malloc(Width * Height);
+
+        for(uint32_t n = 0; n < SysPitch * Height; n++)
+        {
+            Sys[n] = (uint8_t)(n * 7 + (n >> 8));
+        }
+        for(uint32_t n = 0; n < Width * Height; n++)
+        {
+            const uint8_t *pSysPixel = &Sys[n * Cases[c].SysPixelPitch];
+            uint8_t *      pResPixel = &Res[n * 4];
+
+            Sys2[n] = (uint8_t)(n * 3 + 1);
+            switch(c)
+            {
+                case 0: // BGRA --> RGBA
+                    pResPixel[0] = pSysPixel[2];
+                    pResPixel[1] = pSysPixel[1];
+                    pResPixel[2] = pSysPixel[0];
+                    pResPixel[3] = pSysPixel[3];
+                    break;
+                case 1: // RGB --> RGBX
+                    memcpy(pResPixel, pSysPixel, 3);
+                    pResPixel[3] = 0xff;
+                    break;
+                default: // D24X8 + S8 --> D24S8
+                    memcpy(pResPixel, pSysPixel, 3);
+                    pResPixel[3] = Sys2[n];
+                    break;
+            }
+        }
+
+        // Reference: plain CpuBlt of pre-converted pixels...
+        GMM_RES_COPY_BLT Blt = {};
+        Blt.Gpu.pData        = pExpected;
+        Blt.Sys.pData        = Res;
+        Blt.Sys.RowPitch     = Width * 4;
+        Blt.Sys.BufferSize   = Width * 4 * Height;
+        Blt.Blt.Width        = Width;
+        Blt.Blt.Height       = Height;
+        Blt.Blt.Upload       = 1;
+        memset(pExpected, 0, SurfSize);
+        EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+
+        // Converting upload...
+        GMM_RES_COPY_BLT_CONVERT Convert = {};
+        Convert.SysFormat                = Cases[c].SysFormat;
+        Convert.pData2                   = Split ? Sys2 : NULL;
+        Convert.RowPitch2                = Width;
+
+        Blt.Gpu.pData      = pConverted;
+        Blt.Sys.pData      = Sys;
+        Blt.Sys.RowPitch   = SysPitch;
+        Blt.Sys.BufferSize = SysPitch * Height;
+        memset(pConverted, 0, SurfSize);
+        EXPECT_EQ(1, ResourceInfo->CpuBltConvert(&Blt, &Convert));
+        EXPECT_EQ(0, memcmp(pExpected, pConverted, SurfSize));
+
+        // Converting download...
+        Convert.pData2     = Split ? ReadBack2 : NULL;
+        Blt.Sys.pData      = ReadBack;
+        Blt.Blt.Upload     = 0;
+        memset(ReadBack, 0, SysPitch * Height);
+        memset(ReadBack2, 0, Width * Height);
+        EXPECT_EQ(1, ResourceInfo->CpuBltConvert(&Blt, &Convert));
+        for(uint32_t n = 0; n < Width * Height; n++)
+        {
+            // X8 of D24X8 reads back as zero; everything else round-trips.
+            uint32_t Bytes = Split ? 3 : Cases[c].SysPixelPitch;
+            EXPECT_EQ(0, memcmp(&ReadBack[n * Cases[c].SysPixelPitch], &Sys[n * Cases[c].SysPixelPitch], Bytes));
+            if(Split)
+            {
+                EXPECT_EQ(0, ReadBack[n * 4 + 3]);
+                EXPECT_EQ(Sys2[n], ReadBack2[n]);
+            }
+        }
+
+        free(ReadBack2);
+        free(ReadBack);
+        free(Res);
+        free(Sys2);
+        free(Sys);
+        ULT_ALIGNED_FREE(pExpected);
+        ULT_ALIGNED_FREE(pConverted);
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+}
+
+/// @brief ULT for CpuBlt cache policy--streaming and temporal BLT's must agree,
+/// and report the policy used
+TEST_F(CTestCpuBltResource, TestCpuBltCachePolicy)
+{
+    const uint32_t Width = 300, Height = 200;
+
+    GMM_RESCREATE_PARAMS gmmParams = {};
+    gmmParams.Type                 = RESOURCE_2D;
+    gmmParams.NoGfxMemory          = 1;
+    gmmParams.Flags.Info.TiledY    = 1;
+    gmmParams.Flags.Gpu.Texture    = 1;
+    gmmParams.Format               = SetResourceFormat(TEST_BPP_32);
+    gmmParams.BaseWidth64          = Width;
+    gmmParams.BaseHeight           = Height;
+    gmmParams.ArraySize            = 1;
+
+    GMM_RESOURCE_INFO *ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+    ASSERT_TRUE(ResourceInfo != NULL);
+
+    size_t   SurfSize   = GFX_ULONG_CAST(ResourceInfo->GetSizeSurface());
+    uint32_t RowBytes   = Width * 4;
+    uint8_t *pStreamed  = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+    uint8_t *pTemporal  = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+    uint8_t *Linear     = (uint8_t *)malloc(RowBytes * Height);
+    uint8_t *ReadBack   = (uint8_t *)malloc(RowBytes * Height);
+    memset(pStreamed, 0, SurfSize);
+    memset(pTemporal, 0, SurfSize);
+
+    for(uint32_t n = 0; n < RowBytes * Height; n++)
+    {
+        Linear[n] = (uint8_t)(n * 11 + (n >> 10));
+    }
+
+    GMM_RES_COPY_BLT Blt = {};
+    Blt.Sys.pData        = Linear;
+    Blt.Sys.RowPitch     = RowBytes;
+    Blt.Sys.BufferSize   = RowBytes * Height;
+    Blt.Blt.Width        = Width;
+    Blt.Blt.Height       = Height;
+    Blt.Blt.Upload       = 1;
+
+    Blt.Gpu.pData       = pStreamed;
+    Blt.Blt.CachePolicy = GMM_CPU_BLT_CACHE_STREAMING;
+    EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+    EXPECT_EQ(GMM_CPU_BLT_CACHE_STREAMING, Blt.Blt.CachePolicyUsed);
+
+    Blt.Gpu.pData       = pTemporal;
+    Blt.Blt.CachePolicy = GMM_CPU_BLT_CACHE_TEMPORAL;
+    EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+    EXPECT_EQ(GMM_CPU_BLT_CACHE_TEMPORAL, Blt.Blt.CachePolicyUsed);
+    EXPECT_EQ(0, memcmp(pStreamed, pTemporal, SurfSize));
+
+    Blt.Sys.pData  = ReadBack;
+    Blt.Blt.Upload = 0;
+    memset(ReadBack, 0, RowBytes * Height);
+    EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+    EXPECT_EQ(0, memcmp(Linear, ReadBack, RowBytes * Height));
+
+    // Auto: temporal only if transfer fits in a quarter of the LLC...
+    GMM_CACHE_SIZES CacheSizes = {};
+    pGmmULTClientContext->GetCacheSizes(&CacheSizes);
+
+    Blt.Blt.CachePolicy     = GMM_CPU_BLT_CACHE_AUTO;
+    Blt.Blt.CachePolicyUsed = 0;
+    EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+    EXPECT_EQ((RowBytes * Height <= CacheSizes.TotalLLCCache / 4) ? GMM_CPU_BLT_CACHE_TEMPORAL : GMM_CPU_BLT_CACHE_STREAMING,
+              Blt.Blt.CachePolicyUsed);
+    EXPECT_EQ(GMM_CPU_BLT_CACHE_AUTO, Blt.Blt.CachePolicy); // Hint left as given.
+
+    free(ReadBack);
+    free(Linear);
+    ULT_ALIGNED_FREE(pTemporal);
+    ULT_ALIGNED_FREE(pStreamed);
+    pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+}
+
+/// @brief ULT for CpuFill--pattern and solid fills must match a CpuBlt
+/// download of the same rectangles filled in linear memory
+TEST_F(CTestCpuBltResource, TestCpuFill)
+{
+    const uint32_t Width = 200, Height = 100;
+    const uint32_t PatternWidth = 3, PatternHeight = 2;
+
+    struct
+    {
+        TEST_BPP Bpp;
+        uint8_t  TiledY, TiledX;
+    } Cases[] =
+    {
+        {TEST_BPP_32, 1, 0},
+        {TEST_BPP_8, 1, 0},
+        {TEST_BPP_64, 1, 0},
+        {TEST_BPP_32, 0, 1},
+        {TEST_BPP_32, 0, 0},
+    };
+
+    for(uint32_t c = 0; c < sizeof(Cases) / sizeof(Cases[0]); c++)
+    {
+        GMM_RESCREATE_PARAMS gmmParams = {};
+        gmmParams.Type                 = RESOURCE_2D;
+        gmmParams.NoGfxMemory          = 1;
+        gmmParams.Flags.Info.TiledY    = Cases[c].TiledY;
+        gmmParams.Flags.Info.TiledX    = Cases[c].TiledX;
+        gmmParams.Flags.Info.Linear    = !Cases[c].TiledY && !Cases[c].TiledX;
+        gmmParams.Flags.Gpu.Texture    = 1;
+        gmmParams.Format               = SetResourceFormat(Cases[c].Bpp);
+        gmmParams.BaseWidth64          = Width;
+        gmmParams.BaseHeight           = Height;
+        gmmParams.ArraySize            = 1;
+
+        GMM_RESOURCE_INFO *ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        uint32_t PixelBytes = GetBppValue(Cases[c].Bpp);
+        size_t   SurfSize   = GFX_ULONG_CAST(ResourceInfo->GetSizeSurface());
+        uint32_t RowBytes   = Width * PixelBytes;
+        uint8_t *pSurface   = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+        uint8_t *Expected   = (uint8_t *)malloc(RowBytes * Height);
+        uint8_t *ReadBack   = (uint8_t *)malloc(RowBytes * Height);
+        uint8_t  Pattern[PatternHeight][PatternWidth * 8];
+        uint8_t  Solid[8];
+
+        for(uint32_t n = 0; n < RowBytes * Height; n++)
+        {
+            Expected[n] = (uint8_t)(n * 5 + (n >> 9));
+        }
+        for(uint32_t n = 0; n < sizeof(Pattern); n++)
+        {
+            ((uint8_t *)Pattern)[n] = (uint8_t)(0x80 + n);
+        }
+        memset(Solid, 0xa5, sizeof(Solid));
+
+        GMM_RES_COPY_BLT Blt = {};
+        Blt.Gpu.pData        = pSurface;
+        Blt.Sys.pData        = Expected;
+        Blt.Sys.RowPitch     = RowBytes;
+        Blt.Sys.BufferSize   = RowBytes * Height;
+        Blt.Blt.Upload       = 1;
+        EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+
+        // Pattern fill of odd-aligned rectangle, then solid fill overlapping it...
+        struct
+        {
+            uint32_t OffsetX, OffsetY, Width, Height;
+            uint8_t  Solid;
+        } Fills[] =
+        {
+            {3, 5, 150, 61, 0},
+            {101, 40, 77, 59, 1},
+        };
+
+        for(uint32_t f = 0; f < sizeof(Fills) / sizeof(Fills[0]); f++)
+        {
+            GMM_RES_CPU_FILL Fill = {};
+            Fill.Gpu.pData        = pSurface;
+            Fill.Gpu.OffsetX      = Fills[f].OffsetX;
+            Fill.Gpu.OffsetY      = Fills[f].OffsetY;
+            Fill.Pattern.pData    = Fills[f].Solid ? (void *)Solid : (void *)Pattern;
+            Fill.Pattern.Width    = Fills[f].Solid ? 0 : PatternWidth;
+            Fill.Pattern.Height   = Fills[f].Solid ? 0 : PatternHeight;
+            Fill.Pattern.RowPitch = Fills[f].Solid ? 0 : sizeof(Pattern[0]);
+            Fill.Fill.Width       = Fills[f].Width;
+            Fill.Fill.Height      = Fills[f].Height;
+            Fill.Fill.CachePolicy = f ? GMM_CPU_BLT_CACHE_TEMPORAL : GMM_CPU_BLT_CACHE_STREAMING;
+            EXPECT_EQ(1, ResourceInfo->CpuFill(&Fill));
+
+            for(uint32_t y = 0; y < Fills[f].Height; y++)
+            {
+                for(uint32_t x = 0; x < Fills[f].Width; x++)
+                {
+                    const uint8_t *pPixel = Fills[f].Solid ? Solid : &Pattern[y % PatternHeight][(x % PatternWidth) * PixelBytes];
+                    memcpy(&Expected[(Fills[f].OffsetY + y) * RowBytes + (Fills[f].OffsetX + x) * PixelBytes], pPixel, PixelBytes);
+                }
+            }
+        }
+
+        Blt.Sys.pData  = ReadBack;
+        Blt.Blt.Upload = 0;
+        memset(ReadBack, 0, RowBytes * Height);
+        EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+        EXPECT_EQ(0, memcmp(Expected, ReadBack, RowBytes * Height));
+
+        free(ReadBack);
+        free(Expected);
+        ULT_ALIGNED_FREE(pSurface);
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+}
+
+/// @brief ULT for CpuBltSubresources--whole MIP chain/array BLT's from packed
+/// images must match per-subresource CpuBlt's, serially and in parallel, for
+/// both the default (MIP-major) layout and a caller's (slice-major) table
+TEST_F(CTestCpuBltResource, TestCpuBltSubresources)
+{
+    struct
+    {
+        GMM_RESOURCE_TYPE Type;
+        uint32_t          Width, Height, Depth, ArraySize, MaxLod;
+    } Cases[] =
+    {
+        {RESOURCE_2D, 67, 45, 1, 3, 6},
+        {RESOURCE_3D, 33, 17, 9, 1, 4},
+    };
+
+    for(uint32_t c = 0; c < sizeof(Cases) / sizeof(Cases[0]); c++)
+    {
+        GMM_RESCREATE_PARAMS gmmParams = {};
+        gmmParams.Type                 = Cases[c].Type;
+        gmmParams.NoGfxMemory          = 1;
+        gmmParams.Flags.Info.TiledY    = 1;
+        gmmParams.Flags.Gpu.Texture    = 1;
+        gmmParams.Format               = SetResourceFormat(TEST_BPP_32);
+        gmmParams.BaseWidth64          = Cases[c].Width;
+        gmmParams.BaseHeight           = Cases[c].Height;
+        gmmParams.Depth                = Cases[c].Depth;
+        gmmParams.ArraySize            = Cases[c].ArraySize;
+        gmmParams.MaxLod               = Cases[c].MaxLod;
+
+        GMM_RESOURCE_INFO *ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        // Default layout: one packed entry per MIP...
+        GMM_RES_COPY_BLT_SUBRESOURCE Layout[16];
+        uint32_t                     NumMips   = 0;
+        size_t                       ImageSize = GFX_ULONG_CAST(ResourceInfo->GetCpuBltSubresourceLayout(NULL, &NumMips));
+        ASSERT_EQ(Cases[c].MaxLod + 1, NumMips);
+        EXPECT_EQ(ImageSize, GFX_ULONG_CAST(ResourceInfo->GetCpuBltSubresourceLayout(Layout, &NumMips)));
+
+        size_t Expected = 0;
+        for(uint32_t Mip = 0; Mip < NumMips; Mip++)
+        {
+            uint32_t Slices = (Cases[c].Type == RESOURCE_3D) ? ResourceInfo->GetMipDepth(Mip) : Cases[c].ArraySize;
+            EXPECT_EQ(Mip, Layout[Mip].MipLevel);
+            EXPECT_EQ(Slices, Layout[Mip].Slices);
+            EXPECT_EQ(GFX_ULONG_CAST(ResourceInfo->GetMipWidth(Mip)) * 4, Layout[Mip].RowPitch);
+            EXPECT_EQ(Expected, Layout[Mip].Offset);
+            Expected += GFX_ULONG_CAST(Layout[Mip].SlicePitch) * Slices;
+        }
+        EXPECT_EQ(Expected, ImageSize);
+
+        size_t   SurfSize = GFX_ULONG_CAST(ResourceInfo->GetSizeSurface());
+        uint8_t *pSurf    = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+        uint8_t *pRef     = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+        uint8_t *Image    = (uint8_t *)malloc(ImageSize);
+        memset(pSurf, 0, SurfSize);
+        memset(pRef, 0, SurfSize);
+
+        for(uint32_t n = 0; n < ImageSize; n++)
+        {
+            Image[n] = (uint8_t)(n * 7 + (n >> 10) + c);
+        }
+
+        // Reference: per-subresource CpuBlt's...
+        for(uint32_t Mip = 0; Mip < NumMips; Mip++)
+        {
+            GMM_RES_COPY_BLT Blt = {};
+            Blt.Gpu.pData        = pRef;
+            Blt.Gpu.MipLevel     = Mip;
+            Blt.Sys.pData        = Image + Layout[Mip].Offset;
+            Blt.Sys.RowPitch     = Layout[Mip].RowPitch;
+            Blt.Sys.SlicePitch   = GFX_ULONG_CAST(Layout[Mip].SlicePitch);
+            Blt.Sys.BufferSize   = GFX_ULONG_CAST(ImageSize - Layout[Mip].Offset);
+            Blt.Blt.Slices       = Layout[Mip].Slices;
+            Blt.Blt.Upload       = 1;
+            EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+        }
+
+        // Whole-resource upload, default layout, serial...
+        GMM_RES_COPY_BLT_SUBRESOURCES Blt = {};
+        Blt.Gpu.pData                     = pSurf;
+        Blt.Sys.pData                     = Image;
+        Blt.Sys.BufferSize                = ImageSize;
+        Blt.Blt.Upload                    = 1;
+        EXPECT_EQ(1, ResourceInfo->CpuBltSubresources(&Blt));
+        EXPECT_EQ(0, memcmp(pSurf, pRef, SurfSize));
+        EXPECT_TRUE((Blt.Blt.CachePolicyUsed == GMM_CPU_BLT_CACHE_STREAMING) ||
+                    (Blt.Blt.CachePolicyUsed == GMM_CPU_BLT_CACHE_TEMPORAL));
+
+        // Parallel download to a slice-major (DDS-style) image with padded rows...
+        std::vector<GMM_RES_COPY_BLT_SUBRESOURCE> Table;
+        size_t                                    Offset = 0;
+        uint32_t                                  Slices = (Cases[c].Type == RESOURCE_3D) ? Cases[c].Depth : Cases[c].ArraySize;
+        for(uint32_t Slice = 0; Slice < Slices; Slice++)
+        {
+            for(uint32_t Mip = 0; Mip < NumMips; Mip++)
+            {
+                if(Slice < Layout[Mip].Slices)
+                {
+                    GMM_RES_COPY_BLT_SUBRESOURCE Entry = {};
+                    Entry.MipLevel                     = Mip;
+                    Entry.Slice                        = Slice;
+                    Entry.RowPitch                     = Layout[Mip].RowPitch + 12;
+                    Entry.Offset                       = Offset;
+                    Table.push_back(Entry);
+                    Offset += Entry.RowPitch * ResourceInfo->GetMipHeight(Mip);
+                }
+            }
+        }
+
+        uint8_t *SliceMajor = (uint8_t *)malloc(Offset);
+        memset(SliceMajor, 0, Offset);
+
+        GMM_TASK_PARALLEL Parallel = {};
+        Parallel.MaxThreads                = 4;
+        Blt.Sys.pData                      = SliceMajor;
+        Blt.Sys.BufferSize                 = Offset;
+        Blt.Blt.pSubresources              = Table.data();
+        Blt.Blt.NumSubresources            = (uint32_t)Table.size();
+        Blt.Blt.pParallel                  = &Parallel;
+        Blt.Blt.Upload                     = 0;
+        EXPECT_EQ(1, ResourceInfo->CpuBltSubresources(&Blt));
+
+        for(auto &Entry : Table)
+        {
+            const GMM_RES_COPY_BLT_SUBRESOURCE &Packed = Layout[Entry.MipLevel];
+            for(uint32_t y = 0; y < ResourceInfo->GetMipHeight(Entry.MipLevel); y++)
+            {
+                EXPECT_EQ(0, memcmp(SliceMajor + Entry.Offset + y * Entry.RowPitch,
+                                    Image + Packed.Offset + Entry.Slice * Packed.SlicePitch + y * Packed.RowPitch,
+                                    Packed.RowPitch));
+            }
+        }
+
+        free(SliceMajor);
+        free(Image);
+        ULT_ALIGNED_FREE(pRef);
+        ULT_ALIGNED_FREE(pSurf);
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+}
+
+/// @brief ULT for CpuBltPlanar--Y and UV planes must land at their planar
+/// offsets (checked against reference swizzle), serially and in parallel
+TEST_F(CTestCpuBltResource, TestCpuBltPlanar)
+{
+    const uint32_t Width = 130, Height = 66;
+
+    struct
+    {
+        GMM_RESOURCE_FORMAT Format;
+        uint32_t            PixelBytes;
+        uint8_t             TiledY;
+    } Cases[] =
+    {
+        {GMM_FORMAT_NV12, 1, 1},
+        {GMM_FORMAT_P010, 2, 1},
+        {GMM_FORMAT_NV12, 1, 0},
+    };
+
+    for(uint32_t c = 0; c < sizeof(Cases) / sizeof(Cases[0]); c++)
+    {
+        GMM_RESCREATE_PARAMS gmmParams = {};
+        gmmParams.Type                 = RESOURCE_2D;
+        gmmParams.NoGfxMemory          = 1;
+        gmmParams.Flags.Info.TiledY    = Cases[c].TiledY;
+        gmmParams.Flags.Info.Linear    = !Cases[c].TiledY;
+        gmmParams.Flags.Gpu.Texture    = 1;
+        gmmParams.Format               = Cases[c].Format;
+        gmmParams.BaseWidth64          = Width;
+        gmmParams.BaseHeight           = Height;
+
+        GMM_RESOURCE_INFO *ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        const SWIZZLE_DESCRIPTOR *pSwizzle = pGmmULTClientContext->GetSwizzleDesc(TILEY, Res_2D, Cases[c].PixelBytes * 8);
+        ASSERT_TRUE(pSwizzle != NULL);
+
+        size_t   SurfSize = GFX_ULONG_CAST(ResourceInfo->GetSizeSurface());
+        uint32_t Pitch    = GFX_ULONG_CAST(ResourceInfo->GetRenderPitch());
+        uint32_t UVOffset = GFX_ULONG_CAST(ResourceInfo->GetPlanarYOffset(GMM_PLANE_U));
+        uint32_t RowBytes = Width * Cases[c].PixelBytes;
+        uint32_t SysPitch = RowBytes + 16; // Padded system rows.
+        uint8_t *pSurf    = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+        uint8_t *Y        = (uint8_t *)malloc(SysPitch * Height);
+        uint8_t *UV       = (uint8_t *)malloc(SysPitch * Height / 2);
+        uint8_t *ReadBack = (uint8_t *)malloc(SysPitch * Height * 3 / 2);
+        memset(pSurf, 0, SurfSize);
+
+        for(uint32_t n = 0; n < SysPitch * Height; n++)
+        {
+            Y[n] = (uint8_t)(n * 3 + (n >> 8));
+        }
+        for(uint32_t n = 0; n < SysPitch * Height / 2; n++)
+        {
+            UV[n] = (uint8_t)(n * 11 + (n >> 7) + 0x40);
+        }
+
+        GMM_RES_COPY_BLT_PLANAR Blt = {};
+        Blt.Gpu.pData               = pSurf;
+        Blt.Sys.pY                  = Y;
+        Blt.Sys.pUV                 = UV;
+        Blt.Sys.YRowPitch           = SysPitch;
+        Blt.Sys.UVRowPitch          = SysPitch;
+        Blt.Blt.Upload              = 1;
+        EXPECT_EQ(1, ResourceInfo->CpuBltPlanar(&Blt));
+
+        for(uint32_t y = 0; y < Height * 3 / 2; y++)
+        {
+            const uint8_t *pSys   = (y < Height) ? &Y[y * SysPitch] : &UV[(y - Height) * SysPitch];
+            uint32_t       SurfY = (y < Height) ? y : (UVOffset + y - Height);
+
+            for(uint32_t x = 0; x < RowBytes; x++)
+            {
+                uint64_t SurfOffset = Cases[c].TiledY ? RefSwizzleOffset(pSwizzle, Pitch, x, SurfY) : ((uint64_t)SurfY * Pitch + x);
+                ASSERT_EQ(pSys[x], pSurf[SurfOffset]);
+            }
+        }
+
+        // Parallel download into packed planes...
+        GMM_TASK_PARALLEL Parallel = {};
+        Parallel.MaxThreads                = 4;
+        memset(ReadBack, 0, SysPitch * Height * 3 / 2);
+        Blt.Sys.pY         = ReadBack;
+        Blt.Sys.pUV        = ReadBack + RowBytes * Height;
+        Blt.Sys.YRowPitch  = 0;
+        Blt.Sys.UVRowPitch = 0;
+        Blt.Blt.pParallel  = &Parallel;
+        Blt.Blt.Upload     = 0;
+        EXPECT_EQ(1, ResourceInfo->CpuBltPlanar(&Blt));
+
+        for(uint32_t y = 0; y < Height; y++)
+        {
+            ASSERT_EQ(0, memcmp(&ReadBack[y * RowBytes], &Y[y * SysPitch], RowBytes));
+        }
+        for(uint32_t y = 0; y < Height / 2; y++)
+        {
+            ASSERT_EQ(0, memcmp(&ReadBack[(Height + y) * RowBytes], &UV[y * SysPitch], RowBytes));
+        }
+
+        free(ReadBack);
+        free(UV);
+        free(Y);
+        ULT_ALIGNED_FREE(pSurf);
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+}
+
+/// @brief ULT for CpuBltRects--merged damage rects must copy exactly the damage
+/// (or, with MayOvercopy, at least the damage and nothing outside the BLT rectangle)
+TEST_F(CTestCpuBltResource, TestCpuBltRects)
+{
+    const uint32_t Width = 100, Height = 40, PixelBytes = 4;
+    const uint32_t RegionX = 8, RegionY = 4, RegionWidth = 80, RegionHeight = 30;
+
+    const GMM_RES_COPY_BLT_RECT Rects[] =
+    {
+        {0, 0, 4, 4},     // Adjacent to next--merge into one.
+        {4, 0, 4, 4},
+        {10, 10, 6, 6},   // Overlapping, but union not a rect--two BLT's.
+        {12, 12, 6, 6},
+        {70, 25, 20, 10}, // Clipped to BLT rectangle.
+        {100, 0, 5, 5},   // Outside BLT rectangle--dropped.
+        {1, 20, 3, 3},
+    };
+    const uint32_t NumRects = sizeof(Rects) / sizeof(Rects[0]);
+
+    const SWIZZLE_DESCRIPTOR *pSwizzle = pGmmULTClientContext->GetSwizzleDesc(TILEY, Res_2D, PixelBytes * 8);
+    ASSERT_TRUE(pSwizzle != NULL);
+
+    for(uint32_t TiledY = 0; TiledY <= 1; TiledY++)
+    {
+        GMM_RESCREATE_PARAMS gmmParams = {};
+        gmmParams.Type                 = RESOURCE_2D;
+        gmmParams.NoGfxMemory          = 1;
+        gmmParams.Flags.Info.TiledY    = TiledY;
+        gmmParams.Flags.Info.Linear    = !TiledY;
+        gmmParams.Flags.Gpu.Texture    = 1;
+        gmmParams.Format               = GMM_FORMAT_R8G8B8A8_UINT;
+        gmmParams.BaseWidth64          = Width;
+        gmmParams.BaseHeight           = Height;
+
+        GMM_RESOURCE_INFO *ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        size_t   SurfSize = GFX_ULONG_CAST(ResourceInfo->GetSizeSurface());
+        uint32_t Pitch    = GFX_ULONG_CAST(ResourceInfo->GetRenderPitch());
+        uint32_t SysPitch = RegionWidth * PixelBytes + 32;
+        uint8_t *pSurf    = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+        uint8_t *pSys     = (uint8_t *)malloc(SysPitch * RegionHeight);
+        uint8_t *ReadBack = (uint8_t *)malloc(SysPitch * RegionHeight);
+
+        for(uint32_t n = 0; n < SysPitch * RegionHeight; n++)
+        {
+            pSys[n] = (uint8_t)(n * 7 + (n >> 8) + 1) | 1; // Nonzero, so untouched pixels are distinguishable.
+        }
+
+        for(uint8_t MayOvercopy = 0; MayOvercopy <= 1; MayOvercopy++)
+        {
+            memset(pSurf, 0, SurfSize);
+
+            GMM_RES_COPY_BLT Blt = {};
+            Blt.Gpu.pData        = pSurf;
+            Blt.Gpu.OffsetX      = RegionX;
+            Blt.Gpu.OffsetY      = RegionY;
+            Blt.Sys.pData        = pSys;
+            Blt.Sys.RowPitch     = SysPitch;
+            Blt.Sys.BufferSize   = SysPitch * RegionHeight;
+            Blt.Blt.Width        = RegionWidth;
+            Blt.Blt.Height       = RegionHeight;
+            Blt.Blt.Upload       = 1;
+
+            GMM_RES_COPY_BLT_RECTS BltRects = {};
+            BltRects.pRects                 = Rects;
+            BltRects.NumRects               = NumRects;
+            BltRects.MayOvercopy            = MayOvercopy;
+            EXPECT_EQ(1, ResourceInfo->CpuBltRects(&Blt, &BltRects));
+            if(MayOvercopy)
+            {
+                EXPECT_LE(BltRects.NumBlts, 5u);
+            }
+            else
+            {
+                EXPECT_EQ(5u, BltRects.NumBlts);
+            }
+
+            for(uint32_t y = 0; y < Height; y++)
+            {
+                for(uint32_t x = 0; x < Width; x++)
+                {
+                    bool InRegion = (x >= RegionX) && (x < RegionX + RegionWidth) && (y >= RegionY) && (y < RegionY + RegionHeight);
+                    bool Damaged  = InRegion && RectsContain(Rects, NumRects, x - RegionX, y - RegionY);
+
+                    for(uint32_t b = 0; b < PixelBytes; b++)
+                    {
+                        uint32_t XBytes     = x * PixelBytes + b;
+                        uint64_t SurfOffset = TiledY ? RefSwizzleOffset(pSwizzle, Pitch, XBytes, y) : ((uint64_t)y * Pitch + XBytes);
+                        uint8_t  Expected   = InRegion ? pSys[(y - RegionY) * SysPitch + (x - RegionX) * PixelBytes + b] : 0;
+
+                        if(Damaged)
+                        {
+                            ASSERT_EQ(Expected, pSurf[SurfOffset]);
+                        }
+                        else if(!MayOvercopy || !InRegion)
+                        {
+                            ASSERT_EQ(0, pSurf[SurfOffset]);
+                        }
+                        else
+                        {
+                            ASSERT_TRUE((pSurf[SurfOffset] == 0) || (pSurf[SurfOffset] == Expected));
+                        }
+                    }
+                }
+            }
+
+            // Download of same rects must match upload of them...
+            memset(ReadBack, 0, SysPitch * RegionHeight);
+            Blt.Sys.pData  = ReadBack;
+            Blt.Blt.Upload = 0;
+            EXPECT_EQ(1, ResourceInfo->CpuBltRects(&Blt, &BltRects));
+
+            for(uint32_t y = 0; y < RegionHeight; y++)
+            {
+                for(uint32_t x = 0; x < RegionWidth * PixelBytes; x++)
+                {
+                    uint8_t Got = ReadBack[y * SysPitch + x];
+
+                    if(RectsContain(Rects, NumRects, x / PixelBytes, y))
+                    {
+                        ASSERT_EQ(pSys[y * SysPitch + x], Got);
+                    }
+                    else if(!MayOvercopy)
+                    {
+                        ASSERT_EQ(0, Got);
+                    }
+                    else
+                    {
+                        ASSERT_TRUE((Got == 0) || (Got == pSys[y * SysPitch + x]));
+                    }
+                }
+            }
+        }
+
+        free(ReadBack);
+        free(pSys);
+        ULT_ALIGNED_FREE(pSurf);
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+}
+
+/// Bitwise CRC32C of Size bytes, as the reference for CpuHash.
+static uint32_t RefCrc32c(uint32_t Crc, const uint8_t *pData, size_t Size)
+{
+    for(size_t i = 0; i < Size; i++)
+    {
+        Crc ^= pData[i];
+        for(int Bit = 0; Bit < 8; Bit++)
+        {
+            Crc = (Crc >> 1) ^ ((Crc & 1) ? 0x82F63B78 : 0);
+        }
+    }
+
+    return Crc;
+}
+
+/// @brief ULT for CpuHash/CpuCompare--hash must be the CRC32C of the packed
+/// linear rectangle whatever the tiling, and compare must find the first
+/// differing pixel
+TEST_F(CTestCpuBltResource, TestCpuHashCompare)
+{
+    const uint32_t Width = 300, Height = 70, ArraySize = 2, PixelBytes = 4;
+    const uint32_t OffsetX = 5, OffsetY = 3, BltWidth = 250, BltHeight = 60;
+    const uint32_t RowBytes = BltWidth * PixelBytes, SlicePitch = RowBytes * BltHeight;
+
+    uint8_t *Linear = (uint8_t *)malloc(SlicePitch * ArraySize);
+    uint32_t RefHash = ~0u;
+
+    for(uint32_t n = 0; n < SlicePitch * ArraySize; n++)
+    {
+        Linear[n] = (uint8_t)(n * 7 + (n >> 11));
+    }
+    RefHash = ~RefCrc32c(RefHash, Linear, SlicePitch * ArraySize);
+
+    for(uint32_t TiledY = 0; TiledY <= 1; TiledY++)
+    {
+        GMM_RESCREATE_PARAMS gmmParams = {};
+        gmmParams.Type                 = RESOURCE_2D;
+        gmmParams.NoGfxMemory          = 1;
+        gmmParams.Flags.Info.TiledY    = TiledY;
+        gmmParams.Flags.Info.Linear    = !TiledY;
+        gmmParams.Flags.Gpu.Texture    = 1;
+        gmmParams.Format               = SetResourceFormat(TEST_BPP_32);
+        gmmParams.BaseWidth64          = Width;
+        gmmParams.BaseHeight           = Height;
+        gmmParams.ArraySize            = ArraySize;
+
+        GMM_RESOURCE_INFO *ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+        ASSERT_TRUE(ResourceInfo != NULL);
+
+        size_t   SurfSize = GFX_ULONG_CAST(ResourceInfo->GetSizeSurface());
+        uint8_t *pSurf    = (uint8_t *)ULT_ALIGNED_MALLOC(SurfSize, 64);
+        memset(pSurf, 0, SurfSize);
+
+        GMM_RES_COPY_BLT Blt = {};
+        Blt.Gpu.pData        = pSurf;
+        Blt.Gpu.OffsetX      = OffsetX;
+        Blt.Gpu.OffsetY      = OffsetY;
+        Blt.Sys.pData        = Linear;
+        Blt.Sys.RowPitch     = RowBytes;
+        Blt.Sys.SlicePitch   = SlicePitch;
+        Blt.Sys.BufferSize   = SlicePitch * ArraySize;
+        Blt.Blt.Width        = BltWidth;
+        Blt.Blt.Height       = BltHeight;
+        Blt.Blt.Slices       = ArraySize;
+        Blt.Blt.Upload       = 1;
+        EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+
+        // Hash...
+        uint32_t Hash = 0;
+        EXPECT_EQ(1, ResourceInfo->CpuHash(&Blt, &Hash));
+        EXPECT_EQ(RefHash, Hash);
+
+        // Compare, matching...
+        GMM_RES_CPU_COMPARE Compare = {};
+        EXPECT_EQ(1, ResourceInfo->CpuCompare(&Blt, &Compare));
+        EXPECT_EQ(1, Compare.Match);
+
+        // ...and with a difference (plus a later one, which mustn't be reported)...
+        Linear[SlicePitch + 45 * RowBytes + 123 * PixelBytes + 2] ^= 0xff;
+        Linear[SlicePitch + 50 * RowBytes + 7 * PixelBytes] ^= 0xff;
+        EXPECT_EQ(1, ResourceInfo->CpuCompare(&Blt, &Compare));
+        EXPECT_EQ(0, Compare.Match);
+        EXPECT_EQ(1u, Compare.Slice);
+        EXPECT_EQ(123u, Compare.X);
+        EXPECT_EQ(45u, Compare.Y);
+        Linear[SlicePitch + 45 * RowBytes + 123 * PixelBytes + 2] ^= 0xff;
+        Linear[SlicePitch + 50 * RowBytes + 7 * PixelBytes] ^= 0xff;
+
+        ULT_ALIGNED_FREE(pSurf);
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+    }
+
+    free(Linear);
+}
+
+/// @brief ULT for MSAA CpuBlt--all-sample and per-sample BLT's must agree
+TEST_F(CTestCpuBltResource, TestCpuBltMsaa)
+{
+    const uint32_t Width = 131, Height = 67, NumSamples = 4;
+
+    GMM_RESCREATE_PARAMS gmmParams   = {};
+    gmmParams.Type                   = RESOURCE_2D;
+    gmmParams.NoGfxMemory            = 1;
+    gmmParams.Flags.Info.TiledY      = 1;
+    gmmParams.Flags.Gpu.Texture      = 1;
+    gmmParams.Flags.Gpu.RenderTarget = 1;
+    gmmParams.Format                 = SetResourceFormat(TEST_BPP_32);
+    gmmParams.BaseWidth64            = Width;
+    gmmParams.BaseHeight             = Height;
+    gmmParams.MSAA.NumSamples        = NumSamples;
+
+    GMM_RESOURCE_INFO *ResourceInfo = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+    ASSERT_TRUE(ResourceInfo != NULL);
+
+    uint32_t RowBytes    = Width * 4;
+    uint32_t SampleBytes = RowBytes * Height;
+    uint8_t *pSurf       = (uint8_t *)ULT_ALIGNED_MALLOC(ResourceInfo->GetSizeSurface(), 64);
+    uint8_t *Linear      = (uint8_t *)malloc(SampleBytes * NumSamples);
+    uint8_t *ReadBack    = (uint8_t *)malloc(SampleBytes);
+    memset(pSurf, 0, ResourceInfo->GetSizeSurface());
+
+    for(uint32_t n = 0; n < SampleBytes * NumSamples; n++)
+    {
+        Linear[n] = (uint8_t)(n * 3 + (n >> 8) * 29 + 5);
+    }
+
+    // Upload all samples (sample-major system layout)...
+    GMM_RES_COPY_BLT Blt    = {};
+    Blt.Gpu.pData           = pSurf;
+    Blt.Sys.pData           = Linear;
+    Blt.Sys.RowPitch        = RowBytes;
+    Blt.Sys.MsaaSamplePitch = SampleBytes;
+    Blt.Sys.BufferSize      = SampleBytes * NumSamples;
+    Blt.Blt.Width           = Width;
+    Blt.Blt.Height          = Height;
+    Blt.Blt.MsaaSamples     = NumSamples;
+    Blt.Blt.Upload          = 1;
+    EXPECT_EQ(1, ResourceInfo->CpuBlt(&Blt));
+
+    // ...then read back each sample individually...
+    for(uint32_t Sample = 0; Sample < NumSamples; Sample++)
+    {
+        GMM_RES_COPY_BLT SampleBlt = {};
+        SampleBlt.Gpu.pData        = pSurf;
+        SampleBlt.Gpu.MsaaSample   = Sample;
+        SampleBlt.Sys.pData        = ReadBack;
+        SampleBlt.Sys.RowPitch     = RowBytes;
+        SampleBlt.Sys.BufferSize   = SampleBytes;
+        SampleBlt.Blt.Width        = Width;
+        SampleBlt.Blt.Height       = Height;
+        SampleBlt.Blt.Upload       = 0;
+        EXPECT_EQ(1, ResourceInfo->CpuBlt(&SampleBlt));
+
+        EXPECT_EQ(0, memcmp(ReadBack, &Linear[Sample * SampleBytes], SampleBytes));
+    }
+
+    free(ReadBack);
+    free(Linear);
+    ULT_ALIGNED_FREE(pSurf);
+    pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
+}
+
+/// @brief ULT for CpuBltResource--tile-to-tile transcode must match linear data
+TEST_F(CTestCpuBltResource, TestCpuBltResource)
+{
+    const uint32_t Width = 517, Height = 203, OffsetX = 5, OffsetY = 3;
+    const TEST_BPP Bpps[] = {TEST_BPP_8, TEST_BPP_32, TEST_BPP_128};
+    const struct
+    {
+        uint8_t SrcTiledY, SrcTiledX, DstTiledY, DstTiledX;
+    } Layouts[] = {
+    {1, 0, 0, 1}, // TileY --> TileX
+    {0, 1, 1, 0}, // TileX --> TileY
+    {1, 0, 0, 0}, // TileY --> Linear
+    {0, 0, 1, 0}, // Linear --> TileY
+    };
+
+    for(uint32_t b = 0; b < sizeof(Bpps) / sizeof(Bpps[0]); b++)
+    {
+        for(uint32_t l = 0; l < sizeof(Layouts) / sizeof(Layouts[0]); l++)
+        {
+            GMM_RESCREATE_PARAMS gmmParams = {};
+            gmmParams.Type                 = RESOURCE_2D;
+            gmmParams.NoGfxMemory          = 1;
+            gmmParams.Flags.Gpu.Texture    = 1;
+            gmmParams.Format               = SetResourceFormat(Bpps[b]);
+            gmmParams.BaseWidth64          = Width;
+            gmmParams.BaseHeight           = Height;
+
+            gmmParams.Flags.Info.TiledY = Layouts[l].SrcTiledY;
+            gmmParams.Flags.Info.TiledX = Layouts[l].SrcTiledX;
+            gmmParams.Flags.Info.Linear = !Layouts[l].SrcTiledY && !Layouts[l].SrcTiledX;
+            GMM_RESOURCE_INFO *pSrcRes  = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+
+            gmmParams.Flags.Info.TiledY = Layouts[l].DstTiledY;
+            gmmParams.Flags.Info.TiledX = Layouts[l].DstTiledX;
+            gmmParams.Flags.Info.Linear = !Layouts[l].DstTiledY && !Layouts[l].DstTiledX;
+            GMM_RESOURCE_INFO *pDstRes  = pGmmULTClientContext->CreateResInfoObject(&gmmParams);
+
+            ASSERT_TRUE(pSrcRes != NULL && pDstRes != NULL);
+
+            uint32_t BytesPP  = GetBppValue(Bpps[b]);
+            uint32_t RowBytes = Width * BytesPP;
+            uint8_t *pSrc     = (uint8_t *)ULT_ALIGNED_MALLOC(pSrcRes->GetSizeSurface(), 64);
+            uint8_t *pDst     = (uint8_t *)ULT_ALIGNED_MALLOC(pDstRes->GetSizeSurface(), 64);
+            uint8_t *Linear   = (uint8_t *)malloc(RowBytes * Height);
+            uint8_t *ReadBack = (uint8_t *)malloc(RowBytes * Height);
+            memset(pDst, 0, pDstRes->GetSizeSurface());
+
+            for(uint32_t n = 0; n < RowBytes * Height; n++)
+            {
+                Linear[n] = (uint8_t)(n * 5 + (n >> 10) * 17 + 9);
+            }
+
+            GMM_RES_COPY_BLT Blt = {};
+            Blt.Gpu.pData        = pSrc;
+            Blt.Sys.pData        = Linear;
+            Blt.Sys.RowPitch     = RowBytes;
+            Blt.Sys.BufferSize   = RowBytes * Height;
+            Blt.Blt.Width        = Width;
+            Blt.Blt.Height       = Height;
+            Blt.Blt.Slices       = 1;
+            Blt.Blt.Upload       = 1;
+            EXPECT_EQ(1, pSrcRes->CpuBlt(&Blt));
+
+            // Transcode source (0,0) to unaligned destination (OffsetX,OffsetY)...
+            GMM_RES_COPY_BLT_RESOURCE ResBlt = {};
+            ResBlt.Src.pResInfo              = pSrcRes;
+            ResBlt.Src.pData                 = pSrc;
+            ResBlt.Dst.pData                 = pDst;
+            ResBlt.Dst.OffsetX               = OffsetX;
+            ResBlt.Dst.OffsetY               = OffsetY;
+            ResBlt.Blt.Width                 = Width - OffsetX;
+            ResBlt.Blt.Height                = Height - OffsetY;
+            EXPECT_EQ(1, pDstRes->CpuBltResource(&ResBlt));
+
+            Blt.Gpu.pData   = pDst;
+            Blt.Sys.pData   = ReadBack;
+            Blt.Gpu.OffsetX = OffsetX;
+            Blt.Gpu.OffsetY = OffsetY;
+            Blt.Blt.Width   = Width - OffsetX;
+            Blt.Blt.Height  = Height - OffsetY;
+            Blt.Blt.Upload  = 0;
+            EXPECT_EQ(1, pDstRes->CpuBlt(&Blt));
+
+            for(uint32_t y = 0; y < Height - OffsetY; y++)
+            {
+                ASSERT_EQ(0, memcmp(&ReadBack[y * RowBytes], &Linear[y * RowBytes], (Width - OffsetX) * BytesPP));
+            }
+
+            free(ReadBack);
+            free(Linear);
+            ULT_ALIGNED_FREE(pDst);
+            ULT_ALIGNED_FREE(pSrc);
+            pGmmULTClientContext->DestroyResInfoObject(pDstRes);
+            pGmmULTClientContext->DestroyResInfoObject(pSrcRes);
+        }
+    }
+}
+
+/// @brief ULT for GetSwizzleBltKernel--specialized kernels must match swizzle
+TEST_F(CTestCpuBltResource, TestSwizzleBltKernels)
+{
+    const int      Pitch = 1024, Height = 64, CopyHeight = 53, OffsetY = 7;
+    EXTERNAL_SWIZZLE_NAME Swizzles[] = {TILEX, TILEY};
+
+    uint8_t *pSurf    = (uint8_t *)ULT_ALIGNED_MALLOC(Pitch * Height, 64);
+    uint8_t *Linear   = (uint8_t *)malloc(Pitch * Height);
+    uint8_t *ReadBack = (uint8_t *)malloc(Pitch * Height);
+
+    for(int n = 0; n < Pitch * Height; n++)
+    {
+        Linear[n] = (uint8_t)(n * 11 + (n >> 9) + 3);
+    }
+
+    for(uint32_t s = 0; s < sizeof(Swizzles) / sizeof(Swizzles[0]); s++)
+    {
+        for(uint32_t i = 0; i < TEST_BPP_MAX; i++)
+        {
+            uint32_t BytesPP = GetBppValue(static_cast<TEST_BPP>(i));
+            int      OffsetX = 3 * BytesPP, CopyWidth = Pitch - 2 * OffsetX;
+
+            const SWIZZLE_DESCRIPTOR *pSwizzle = pGmmULTClientContext->GetSwizzleDesc(Swizzles[s], Res_2D, BytesPP * 8);
+            CPU_SWIZZLE_BLT_KERNEL    pfnUpload   = pGmmULTClientContext->GetSwizzleBltKernel(Swizzles[s], Res_2D, BytesPP * 8, true);
+            CPU_SWIZZLE_BLT_KERNEL    pfnDownload = pGmmULTClientContext->GetSwizzleBltKernel(Swizzles[s], Res_2D, BytesPP * 8, false);
+            ASSERT_TRUE(pSwizzle != NULL);
+            ASSERT_TRUE(pfnUpload != NULL && pfnDownload != NULL);
+            EXPECT_NE(pfnUpload, pfnDownload); // Specialized kernels exist for TileX/Y.
+
+            CPU_SWIZZLE_BLT_SURFACE Swizzled = {}, Lin = {};
+            Swizzled.pBase           = pSurf;
+            Swizzled.Pitch           = Pitch;
+            Swizzled.Height          = Height;
+            Swizzled.pSwizzle        = pSwizzle;
+            Swizzled.OffsetX         = OffsetX;
+            Swizzled.OffsetY         = OffsetY;
+            Swizzled.Element.Pitch   = BytesPP;
+            Swizzled.Element.Size    = BytesPP;
+            Lin.pBase                = Linear;
+            Lin.Pitch                = Pitch;
+            Lin.Height               = Height;
+            Lin.Element.Pitch        = BytesPP;
+            Lin.Element.Size         = BytesPP;
+
+            memset(pSurf, 0, Pitch * Height);
+            pfnUpload(&Swizzled, &Lin, CopyWidth, CopyHeight);
+
+            for(int y = 0; y < Height; y++)
+            {
+                for(int x = 0; x < Pitch; x++)
+                {
+                    bool    Inside   = (x >= OffsetX) && (x < OffsetX + CopyWidth) && (y >= OffsetY) && (y < OffsetY + CopyHeight);
+                    uint8_t Expected = Inside ? Linear[(y - OffsetY) * Pitch + (x - OffsetX)] : 0;
+                    ASSERT_EQ(Expected, pSurf[RefSwizzleOffset(pSwizzle, Pitch, x, y)]);
+                }
+            }
+
+            Lin.pBase = ReadBack;
+            pfnDownload(&Lin, &Swizzled, CopyWidth, CopyHeight);
+
+            for(int y = 0; y < CopyHeight; y++)
+            {
+                ASSERT_EQ(0, memcmp(&ReadBack[y * Pitch], &Linear[y * Pitch], CopyWidth));
+            }
+        }
+    }
+
+    free(ReadBack);
+    free(Linear);
+    ULT_ALIGNED_FREE(pSurf);
+}
+
+/// @brief ULT for SwizzleOffsetBatch/SwizzleOffsetInverseBatch
+TEST_F(CTestCpuBltResource, TestSwizzleOffsetBatch)
+{
+    const int Pitch = 2048, MaxY = 300;
+    const int Counts[] = {7, 1000}; // Small and large batches take different paths.
+    const struct
+    {
+        EXTERNAL_SWIZZLE_NAME Name;
+        EXTERNAL_RES_TYPE     ResType;
+        int                   Samples;
+    } Swizzles[] = {
+    {TILEX, Res_2D, 1},
+    {TILEY, Res_2D, 1},
+    {TILEYS, Res_2D, 1},
+    {TILEYS, MSAA_4X, 4},
+    };
+
+    for(uint32_t s = 0; s < sizeof(Swizzles) / sizeof(Swizzles[0]); s++)
+    {
+        const SWIZZLE_DESCRIPTOR *pSwizzle = pGmmULTClientContext->GetSwizzleDesc(Swizzles[s].Name, Swizzles[s].ResType, 32);
+        ASSERT_TRUE(pSwizzle != NULL);
+
+        for(uint32_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); c++)
+        {
+            int      Count = Counts[c];
+            int *    X = new int[Count], *Y = new int[Count], *Z = new int[Count];
+            int *    Offsets = new int[Count];
+            int *    X2 = new int[Count], *Y2 = new int[Count], *Z2 = new int[Count];
+            uint32_t Seed    = 12345;
+
+            for(int i = 0; i < Count; i++)
+            {
+                Seed = Seed * 1103515245 + 12345;
+                X[i] = (Seed >> 8) % Pitch;
+                Seed = Seed * 1103515245 + 12345;
+                Y[i] = (Seed >> 8) % MaxY;
+                Z[i] = i % Swizzles[s].Samples;
+            }
+
+            pGmmULTClientContext->SwizzleOffsetBatch(pSwizzle, Pitch, Count, X, Y, Z, Offsets);
+            pGmmULTClientContext->SwizzleOffsetInverseBatch(pSwizzle, Pitch, Count, Offsets, X2, Y2, Z2);
+
+            for(int i = 0; i < Count; i++)
+            {
+                if(Swizzles[s].Samples == 1)
+                {
+                    ASSERT_EQ(RefSwizzleOffset(pSwizzle, Pitch, X[i], Y[i]), (uint64_t)Offsets[i]);
+                }
+                ASSERT_EQ(X[i], X2[i]);
+                ASSERT_EQ(Y[i], Y2[i]);
+                ASSERT_EQ(Z[i], Z2[i]);
+            }
+
+            delete[] X;
+            delete[] Y;
+            delete[] Z;
+            delete[] Offsets;
+            delete[] X2;
+            delete[] Y2;
+            delete[] Z2;
+        }
+    }
 }
 
 /// @brief ULT for 3D Resource
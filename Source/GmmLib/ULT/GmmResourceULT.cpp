@@ -3495,3 +3495,513 @@ TEST_F(CTestResource, TestCompressedSurface)
 
     pGmmULTClientContext->DestroyResInfoObject(ResourceInfo);
 }
+
+/// @brief ULT for memoization of repeated creates' layouts
+TEST_F(CTestResource, TestLayoutCache)
+{
+    GMM_LAYOUT_CACHE_STATS Before, After;
+
+    GMM_RESCREATE_PARAMS gmmParams = {};
+    gmmParams.Type                 = RESOURCE_2D;
+    gmmParams.NoGfxMemory          = 1;
+    gmmParams.Flags.Gpu.Texture    = 1;
+    gmmParams.BaseWidth64          = 1920;
+    gmmParams.BaseHeight           = 1080;
+    gmmParams.Depth                = 0x1;
+    SetTileFlag(gmmParams, TEST_TILEY);
+    gmmParams.Format = GMM_FORMAT_NV12;
+
+    // Off until the client opts in.
+    pGmmULTClientContext->GetLayoutCacheStats(&Before);
+    EXPECT_FALSE(Before.Enabled);
+
+    pGmmULTClientContext->SetLayoutCacheEnable(true);
+    pGmmULTClientContext->FlushLayoutCache();
+    pGmmULTClientContext->GetLayoutCacheStats(&Before);
+    ASSERT_TRUE(Before.Enabled);
+    EXPECT_EQ(0, Before.Entries);
+
+    // First create computes and caches the layout, second is served from the cache...
+    GMM_RESCREATE_PARAMS Params[2] = {gmmParams, gmmParams};
+    GMM_RESOURCE_INFO *  ResourceInfo[2];
+    for(uint32_t i = 0; i < 2; i++)
+    {
+        ResourceInfo[i] = pGmmULTClientContext->CreateResInfoObject(&Params[i]);
+        ASSERT_TRUE(ResourceInfo[i] != NULL);
+    }
+
+    pGmmULTClientContext->GetLayoutCacheStats(&After);
+    EXPECT_EQ(Before.Misses + 1, After.Misses);
+    EXPECT_EQ(Before.Hits + 1, After.Hits);
+    EXPECT_EQ(1, After.Entries);
+
+    // ...with identical results.
+    EXPECT_EQ(0, memcmp(&Params[0], &Params[1], sizeof(Params[0])));
+    EXPECT_EQ(0, memcmp(&ResourceInfo[0]->GetResFlags(), &ResourceInfo[1]->GetResFlags(), sizeof(GMM_RESOURCE_FLAG)));
+    EXPECT_EQ(ResourceInfo[0]->GetRenderPitch(), ResourceInfo[1]->GetRenderPitch());
+    EXPECT_EQ(ResourceInfo[0]->GetSizeSurface(), ResourceInfo[1]->GetSizeSurface());
+    EXPECT_EQ(ResourceInfo[0]->GetPlanarYOffset(GMM_PLANE_U), ResourceInfo[1]->GetPlanarYOffset(GMM_PLANE_U));
+
+    for(uint32_t i = 0; i < 2; i++)
+    {
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo[i]);
+    }
+
+    // Garbage in the params' padding (clients needn't zero them) still hits...
+    const size_t PadStart = offsetof(GMM_RESCREATE_PARAMS, NoGfxMemory) + sizeof(gmmParams.NoGfxMemory);
+    const size_t TailPad  = offsetof(GMM_RESCREATE_PARAMS, MultiTileArch) + sizeof(gmmParams.MultiTileArch);
+
+    Before    = After;
+    Params[0] = gmmParams;
+    memset(reinterpret_cast<uint8_t *>(&Params[0]) + PadStart, 0xa5, offsetof(GMM_RESCREATE_PARAMS, pPreallocatedResInfo) - PadStart);
+    memset(reinterpret_cast<uint8_t *>(&Params[0]) + TailPad, 0xa5, sizeof(Params[0]) - TailPad);
+    reinterpret_cast<uint8_t *>(&Params[0].Flags.Info)[sizeof(Params[0].Flags.Info) - 1] = 0xa5; // Undefined Info bits.
+    reinterpret_cast<uint8_t *>(&Params[0].Flags.Wa)[sizeof(Params[0].Flags.Wa) - 1]     = 0xa5; // Undefined Wa bits.
+    ResourceInfo[0] = pGmmULTClientContext->CreateResInfoObject(&Params[0]);
+    ASSERT_TRUE(ResourceInfo[0] != NULL);
+    pGmmULTClientContext->DestroyResInfoObject(ResourceInfo[0]);
+
+    pGmmULTClientContext->GetLayoutCacheStats(&After);
+    EXPECT_EQ(Before.Misses, After.Misses);
+    EXPECT_EQ(Before.Hits + 1, After.Hits);
+
+    // Changing context state layouts depend on invalidates cached layouts...
+    GMM_LIB_CONTEXT *pLibContext = pGmmULTClientContext->GetLibContext();
+    pLibContext->SetAllowedPaddingFor64KBTileSurf(pLibContext->GetAllowedPaddingFor64KBTileSurf());
+
+    Before = After;
+    Params[0] = gmmParams;
+    ResourceInfo[0] = pGmmULTClientContext->CreateResInfoObject(&Params[0]);
+    ASSERT_TRUE(ResourceInfo[0] != NULL);
+    pGmmULTClientContext->DestroyResInfoObject(ResourceInfo[0]);
+
+    pGmmULTClientContext->GetLayoutCacheStats(&After);
+    EXPECT_EQ(Before.Misses + 1, After.Misses);
+    EXPECT_EQ(Before.Hits, After.Hits);
+
+    // ...as does a GtSysInfo tile mask written in place...
+    uint8_t TileMask = pLibContext->GetGtSysInfo()->MultiTileArchInfo.TileMask;
+    pLibContext->GetGtSysInfo()->MultiTileArchInfo.TileMask ^= 0x2;
+
+    Before = After;
+    Params[0] = gmmParams;
+    ResourceInfo[0] = pGmmULTClientContext->CreateResInfoObject(&Params[0]);
+    ASSERT_TRUE(ResourceInfo[0] != NULL);
+    pGmmULTClientContext->DestroyResInfoObject(ResourceInfo[0]);
+    pLibContext->GetGtSysInfo()->MultiTileArchInfo.TileMask = TileMask;
+
+    pGmmULTClientContext->GetLayoutCacheStats(&After);
+    EXPECT_EQ(Before.Misses + 1, After.Misses);
+    EXPECT_EQ(Before.Hits, After.Hits);
+
+    // ...disabling bypasses the cache...
+    pGmmULTClientContext->SetLayoutCacheEnable(false);
+
+    Before = After;
+    Params[0] = gmmParams;
+    ResourceInfo[0] = pGmmULTClientContext->CreateResInfoObject(&Params[0]);
+    ASSERT_TRUE(ResourceInfo[0] != NULL);
+    pGmmULTClientContext->DestroyResInfoObject(ResourceInfo[0]);
+
+    pGmmULTClientContext->GetLayoutCacheStats(&After);
+    EXPECT_FALSE(After.Enabled);
+    EXPECT_EQ(Before.Misses, After.Misses);
+    EXPECT_EQ(Before.Hits, After.Hits);
+
+    pGmmULTClientContext->SetLayoutCacheEnable(true);
+
+    // ...and the cache stays bounded, evicting as needed.
+    for(uint32_t i = 0; i < 2 * After.Capacity; i++)
+    {
+        Params[0]             = gmmParams;
+        Params[0].BaseWidth64 = 64 + i;
+        ResourceInfo[0]       = pGmmULTClientContext->CreateResInfoObject(&Params[0]);
+        ASSERT_TRUE(ResourceInfo[0] != NULL);
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo[0]);
+    }
+
+    Before = After;
+    pGmmULTClientContext->GetLayoutCacheStats(&After);
+    EXPECT_LE(After.Entries, After.Capacity);
+    EXPECT_LT(Before.Evictions, After.Evictions);
+
+    pGmmULTClientContext->FlushLayoutCache();
+    pGmmULTClientContext->GetLayoutCacheStats(&After);
+    EXPECT_EQ(0, After.Entries);
+
+    pGmmULTClientContext->SetLayoutCacheEnable(false);
+}
+
+/// @brief ULT for batch creation of ResourceInfo objects
+TEST_F(CTestResource, TestCreateResInfoObjects)
+{
+    const uint32_t       Count    = 200;
+    GMM_RESCREATE_PARAMS Base     = {};
+    GMM_TASK_PARALLEL    Parallel = {};
+    GMM_RESCREATE_PARAMS Params[Count], Single;
+    GMM_RESOURCE_INFO *  ResourceInfo[Count];
+
+    Base.Type              = RESOURCE_2D;
+    Base.NoGfxMemory       = 1;
+    Base.Flags.Gpu.Texture = 1;
+    Base.Depth             = 0x1;
+
+    // Mostly repeats of a few descriptors, plus distinct ones.
+    for(uint32_t i = 0; i < Count; i++)
+    {
+        Params[i]             = Base;
+        Params[i].Format      = (i & 1) ? GMM_FORMAT_NV12 : GMM_FORMAT_R8G8B8A8_UNORM;
+        Params[i].BaseWidth64 = (i % 3 == 0) ? (256 + i) : 1920;
+        Params[i].BaseHeight  = 1080;
+        SetTileFlag(Params[i], (i & 2) ? TEST_TILEY : TEST_LINEAR);
+    }
+
+    // Batch matches one-by-one creation, serial and threaded alike.
+    for(uint32_t Threaded = 0; Threaded < 2; Threaded++)
+    {
+        GMM_RESCREATE_PARAMS Original[Count];
+
+        memcpy(Original, Params, sizeof(Params));
+        Parallel.MaxThreads = 4;
+
+        ASSERT_EQ(GMM_SUCCESS, pGmmULTClientContext->CreateResInfoObjects(Params, Count, ResourceInfo, Threaded ? &Parallel : NULL));
+
+        for(uint32_t i = 0; i < Count; i++)
+        {
+            ASSERT_TRUE(ResourceInfo[i] != NULL);
+            if(i)
+            {
+                EXPECT_EQ(ResourceInfo[i - 1] + 1, ResourceInfo[i]); // Contiguous
+            }
+
+            Single                     = Original[i];
+            GMM_RESOURCE_INFO *pSingle = pGmmULTClientContext->CreateResInfoObject(&Single);
+            ASSERT_TRUE(pSingle != NULL);
+
+            EXPECT_EQ(0, memcmp(&Single, &Params[i], sizeof(Single)));
+            EXPECT_EQ(pSingle->GetRenderPitch(), ResourceInfo[i]->GetRenderPitch());
+            EXPECT_EQ(pSingle->GetSizeSurface(), ResourceInfo[i]->GetSizeSurface());
+            EXPECT_EQ(pSingle->GetPlanarYOffset(GMM_PLANE_U), ResourceInfo[i]->GetPlanarYOffset(GMM_PLANE_U));
+            EXPECT_EQ(0, memcmp(&pSingle->GetResFlags(), &ResourceInfo[i]->GetResFlags(), sizeof(GMM_RESOURCE_FLAG))); // Batch ownership isn't flagged.
+
+            pGmmULTClientContext->DestroyResInfoObject(pSingle);
+        }
+
+        // Individually destroying a batch object is harmless.
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo[1]);
+        pGmmULTClientContext->DestroyResInfoObjects(ResourceInfo, Count);
+        EXPECT_EQ(NULL, ResourceInfo[0]);
+
+        memcpy(Params, Original, sizeof(Params));
+    }
+}
+
+/// @brief ULT for the opt-in ResourceInfo object pool
+TEST_F(CTestResource, TestResInfoPool)
+{
+    const uint32_t       Count       = 1000;
+    GMM_RESCREATE_PARAMS gmmParams   = {};
+    GMM_RESCREATE_PARAMS Params;
+    GMM_RESOURCE_INFO *  pHeap, *pFirst, *pSecond, *pCopy;
+    GMM_RESOURCE_INFO *  ResourceInfo[Count];
+
+    gmmParams.Type              = RESOURCE_2D;
+    gmmParams.NoGfxMemory       = 1;
+    gmmParams.Flags.Gpu.Texture = 1;
+    gmmParams.Format            = GMM_FORMAT_NV12;
+    gmmParams.BaseWidth64       = 1920;
+    gmmParams.BaseHeight        = 1080;
+    gmmParams.Depth             = 0x1;
+    SetTileFlag(gmmParams, TEST_TILEY);
+
+    // Object created before the pool must still be destroyable after.
+    Params = gmmParams;
+    pHeap  = pGmmULTClientContext->CreateResInfoObject(&Params);
+    ASSERT_TRUE(pHeap != NULL);
+
+    ASSERT_EQ(GMM_SUCCESS, pGmmULTClientContext->EnableResInfoPool());
+    ASSERT_EQ(GMM_SUCCESS, pGmmULTClientContext->EnableResInfoPool());
+
+    // Destroy-then-create on one thread recycles the object.
+    Params = gmmParams;
+    pFirst = pGmmULTClientContext->CreateResInfoObject(&Params);
+    ASSERT_TRUE(pFirst != NULL);
+    pGmmULTClientContext->DestroyResInfoObject(pFirst);
+
+    Params  = gmmParams;
+    pSecond = pGmmULTClientContext->CreateResInfoObject(&Params);
+    ASSERT_TRUE(pSecond != NULL);
+    EXPECT_EQ(pFirst, pSecond);
+
+    EXPECT_EQ(pHeap->GetSizeSurface(), pSecond->GetSizeSurface());
+    EXPECT_EQ(pHeap->GetRenderPitch(), pSecond->GetRenderPitch());
+    EXPECT_EQ(pHeap->GetPlanarYOffset(GMM_PLANE_U), pSecond->GetPlanarYOffset(GMM_PLANE_U));
+
+    pCopy = pGmmULTClientContext->CopyResInfoObject(pSecond);
+    ASSERT_TRUE(pCopy != NULL);
+    EXPECT_NE(pSecond, pCopy);
+    EXPECT_EQ(pSecond->GetSizeSurface(), pCopy->GetSizeSurface());
+
+    pGmmULTClientContext->DestroyResInfoObject(pCopy);
+    pGmmULTClientContext->DestroyResInfoObject(pSecond);
+    pGmmULTClientContext->DestroyResInfoObject(pHeap);
+
+    // Enough objects to span several slabs, all distinct and valid.
+    for(uint32_t i = 0; i < Count; i++)
+    {
+        Params             = gmmParams;
+        Params.BaseWidth64 = 64 + i;
+        ResourceInfo[i]    = pGmmULTClientContext->CreateResInfoObject(&Params);
+        ASSERT_TRUE(ResourceInfo[i] != NULL);
+        EXPECT_EQ(GFX_ALIGN(64 + i, 128), ResourceInfo[i]->GetRenderPitch());
+    }
+
+    for(uint32_t i = 1; i < Count; i++)
+    {
+        EXPECT_NE(ResourceInfo[i - 1], ResourceInfo[i]);
+    }
+
+    // Leave the odd ones to the pool's bulk release at context destruction.
+    for(uint32_t i = 0; i < Count; i += 2)
+    {
+        pGmmULTClientContext->DestroyResInfoObject(ResourceInfo[i]);
+    }
+
+    // A second client context on the same adapter...
+    GMM_INIT_IN_ARGS  InArgs  = {};
+    GMM_INIT_OUT_ARGS OutArgs = {};
+
+    InArgs.ClientType = GMM_EXCITE_VISTA;
+    InArgs.pGtSysInfo = &pGfxAdapterInfo->SystemInfo;
+    InArgs.pSkuTable  = &pGfxAdapterInfo->SkuTable;
+    InArgs.pWaTable   = &pGfxAdapterInfo->WaTable;
+    InArgs.Platform   = GfxPlatform;
+#ifdef _WIN32
+    InArgs.stAdapterBDF = {0, 2, 0, 0};
+#else
+    InArgs.FileDescriptor = 512;
+#endif
+    ASSERT_EQ(GMM_SUCCESS, pfnGmmInit(&InArgs, &OutArgs));
+    GMM_CLIENT_CONTEXT *pOtherClientContext = OutArgs.pGmmClientContext;
+    ASSERT_TRUE(pOtherClientContext != NULL);
+
+    // ...freeing a pooled object returns it to its own pool...
+    Params = gmmParams;
+    pFirst = pGmmULTClientContext->CreateResInfoObject(&Params);
+    ASSERT_TRUE(pFirst != NULL);
+    pOtherClientContext->DestroyResInfoObject(pFirst);
+
+    Params  = gmmParams;
+    pSecond = pGmmULTClientContext->CreateResInfoObject(&Params);
+    ASSERT_TRUE(pSecond != NULL);
+    EXPECT_EQ(pFirst, pSecond);
+    pGmmULTClientContext->DestroyResInfoObject(pSecond);
+
+    // ...and destroying it with a leaked, pooled object that owns GMM-allocated
+    // system memory frees that memory too (checked under sanitizers).
+    ASSERT_EQ(GMM_SUCCESS, pOtherClientContext->EnableResInfoPool());
+
+    Params                           = {};
+    Params.Type                      = RESOURCE_BUFFER;
+    Params.Format                    = GMM_FORMAT_GENERIC_8BIT;
+    Params.Flags.Gpu.Texture         = 1;
+    Params.Flags.Info.ExistingSysMem = 1;
+    Params.BaseWidth64               = 0x10000;
+    Params.BaseHeight                = 1;
+    Params.Depth                     = 1;
+    SetTileFlag(Params, TEST_LINEAR);
+    pHeap = pOtherClientContext->CreateResInfoObject(&Params);
+    ASSERT_TRUE(pHeap != NULL);
+    EXPECT_TRUE(pHeap->GetSystemMemPointer(false) != NULL);
+
+    pfnGmmDestroy(&OutArgs);
+}
+
+/// @brief ULT for shared, reference-counted ResourceInfo objects
+TEST_F(CTestResource, TestSharedLayouts)
+{
+    GMM_RESCREATE_PARAMS gmmParams = {};
+    GMM_RESCREATE_PARAMS Params, Normalized;
+    GMM_RESOURCE_INFO *  pPrivate, *pFirst, *pSecond, *pOther, *pCopy;
+    GMM_GFX_SIZE_T       Size;
+
+    gmmParams.Type              = RESOURCE_2D;
+    gmmParams.NoGfxMemory       = 1;
+    gmmParams.Flags.Gpu.Texture = 1;
+    gmmParams.Format            = GMM_FORMAT_NV12;
+    gmmParams.BaseWidth64       = 1280;
+    gmmParams.BaseHeight        = 720;
+    gmmParams.Depth             = 0x1;
+    SetTileFlag(gmmParams, TEST_TILEY);
+
+    Normalized = gmmParams;
+    pPrivate   = pGmmULTClientContext->CreateResInfoObject(&Normalized);
+    ASSERT_TRUE(pPrivate != NULL);
+    Size = pPrivate->GetSizeSurface();
+
+    ASSERT_EQ(GMM_SUCCESS, pGmmULTClientContext->EnableSharedLayouts());
+
+    // Identical creates share one object, and see the same normalized params.
+    Params = gmmParams;
+    pFirst = pGmmULTClientContext->CreateResInfoObject(&Params);
+    ASSERT_TRUE(pFirst != NULL);
+    EXPECT_EQ(0, memcmp(&Normalized, &Params, sizeof(Params)));
+
+    Params  = gmmParams;
+    pSecond = pGmmULTClientContext->CreateResInfoObject(&Params);
+    EXPECT_EQ(pFirst, pSecond);
+    EXPECT_EQ(0, memcmp(&Normalized, &Params, sizeof(Params)));
+
+    EXPECT_EQ(pPrivate->GetSizeSurface(), pFirst->GetSizeSurface());
+    EXPECT_EQ(pPrivate->GetRenderPitch(), pFirst->GetRenderPitch());
+    EXPECT_EQ(pPrivate->GetPlanarYOffset(GMM_PLANE_U), pFirst->GetPlanarYOffset(GMM_PLANE_U));
+
+    Params             = gmmParams;
+    Params.BaseWidth64 = 1920;
+    pOther             = pGmmULTClientContext->CreateResInfoObject(&Params);
+    ASSERT_TRUE(pOther != NULL);
+    EXPECT_NE(pFirst, pOther);
+
+    EXPECT_TRUE(pGmmULTClientContext->IsSharedResInfo(pFirst));
+    EXPECT_FALSE(pGmmULTClientContext->IsSharedResInfo(pPrivate));
+
+    // Copies are private, and may be modified without touching the shared object.
+    pCopy = pGmmULTClientContext->CopyResInfoObject(pFirst);
+    ASSERT_TRUE(pCopy != NULL);
+    EXPECT_NE(pFirst, pCopy);
+    EXPECT_FALSE(pGmmULTClientContext->IsSharedResInfo(pCopy));
+    pCopy->SetPrivateData(pCopy);
+    pCopy->OverrideSize(Size * 2);
+    EXPECT_EQ(pCopy, pCopy->GetPrivateData());
+    EXPECT_EQ(Size, pFirst->GetSizeSurface());
+    EXPECT_TRUE(pFirst->GetPrivateData() == NULL);
+    pGmmULTClientContext->DestroyResInfoObject(pCopy);
+
+#if !(_DEBUG || _RELEASE_INTERNAL)
+    // Mutators of shared objects (assert and) do nothing.
+    pFirst->SetPrivateData(pFirst);
+    pFirst->OverrideSize(Size * 2);
+    EXPECT_TRUE(pSecond->GetPrivateData() == NULL);
+    EXPECT_EQ(Size, pSecond->GetSizeSurface());
+#endif
+
+    pCopy = pGmmULTClientContext->CopyResInfoObject(pPrivate);
+    ASSERT_TRUE(pCopy != NULL);
+    EXPECT_NE(pPrivate, pCopy);
+    pGmmULTClientContext->DestroyResInfoObject(pCopy);
+    pGmmULTClientContext->DestroyResInfoObject(pPrivate);
+
+    // Object outlives all but its last reference.
+    pGmmULTClientContext->DestroyResInfoObject(pFirst);
+    EXPECT_EQ(Size, pSecond->GetSizeSurface());
+    EXPECT_TRUE(pGmmULTClientContext->IsSharedResInfo(pSecond));
+    pGmmULTClientContext->DestroyResInfoObject(pSecond);
+    EXPECT_FALSE(pGmmULTClientContext->IsSharedResInfo(pSecond));
+
+    pGmmULTClientContext->DestroyResInfoObject(pOther);
+}
+
+/// @brief ULT for PackResInfoObjects suballocation placements
+TEST_F(CTestResource, TestPackResInfoObjects)
+{
+    const GMM_GFX_SIZE_T HeapSize = GMM_MBYTE(1);
+    std::vector<GMM_RESOURCE_INFO *> Res;
+
+    for(uint32_t i = 0; i < 64; i++)
+    {
+        GMM_RESCREATE_PARAMS gmmParams = {};
+
+        gmmParams.NoGfxMemory = 1;
+        gmmParams.Depth       = 1;
+        if(i % 4)
+        {
+            gmmParams.Type            = RESOURCE_BUFFER;
+            gmmParams.Format          = GMM_FORMAT_GENERIC_8BIT;
+            gmmParams.Flags.Gpu.State = 1;
+            gmmParams.BaseWidth64     = 100 + i * 997;
+            gmmParams.BaseHeight      = 1;
+            SetTileFlag(gmmParams, TEST_LINEAR);
+        }
+        else
+        {
+            gmmParams.Type              = RESOURCE_2D;
+            gmmParams.Format            = GMM_FORMAT_R8G8B8A8_UNORM;
+            gmmParams.Flags.Gpu.Texture = 1;
+            gmmParams.BaseWidth64       = 16 + i;
+            gmmParams.BaseHeight        = 16 + 2 * i;
+            SetTileFlag(gmmParams, (i % 8) ? TEST_TILEY : TEST_TILEX);
+        }
+        Res.push_back(pGmmULTClientContext->CreateResInfoObject(&gmmParams));
+        ASSERT_TRUE(Res.back() != NULL);
+    }
+
+    { // Too large for a heap.
+        GMM_RESCREATE_PARAMS gmmParams = {};
+
+        gmmParams.Type            = RESOURCE_BUFFER;
+        gmmParams.NoGfxMemory     = 1;
+        gmmParams.Format          = GMM_FORMAT_GENERIC_8BIT;
+        gmmParams.Flags.Gpu.State = 1;
+        gmmParams.BaseWidth64     = 2 * HeapSize;
+        gmmParams.BaseHeight      = 1;
+        gmmParams.Depth           = 1;
+        SetTileFlag(gmmParams, TEST_LINEAR);
+        Res.push_back(pGmmULTClientContext->CreateResInfoObject(&gmmParams));
+        ASSERT_TRUE(Res.back() != NULL);
+    }
+
+    GMM_SUBALLOC_PARAMS                 Params = {};
+    GMM_SUBALLOC_REPORT                 Report, Again;
+    std::vector<GMM_SUBALLOC_PLACEMENT> Placements(Res.size()), Repeat(Res.size());
+
+    Params.HeapSize = HeapSize;
+    ASSERT_EQ(GMM_SUCCESS, pGmmULTClientContext->PackResInfoObjects(&Res[0], (uint32_t)Res.size(), &Params, &Placements[0], &Report));
+
+    EXPECT_EQ(1u, Report.NumStandalone);
+    EXPECT_EQ(GMM_SUBALLOC_STANDALONE, Placements.back().HeapIndex);
+    EXPECT_LT(0u, Report.NumHeaps);
+    EXPECT_EQ(Report.NumHeaps * HeapSize, Report.HeapBytes);
+    EXPECT_EQ(Report.HeapBytes, Report.UsedBytes + Report.FreeBytes);
+    EXPECT_LE(Report.InteriorFreeBytes, Report.FreeBytes);
+    EXPECT_LE(Report.LargestFreeBlock, Report.FreeBytes);
+    EXPECT_LE(Report.FragmentationPct, 100u);
+    EXPECT_LE(Report.UsedBytes, Report.SeparateBytes);
+
+    // Aligned, within the heap, and not overlapping anything in it.
+    for(uint32_t i = 0; i + 1 < Res.size(); i++)
+    {
+        const GMM_SUBALLOC_PLACEMENT &A = Placements[i];
+
+        ASSERT_LT(A.HeapIndex, Report.NumHeaps) << "Resource " << i;
+        EXPECT_EQ(Res[i]->GetSizeAllocation(), A.Size);
+        EXPECT_EQ(0u, A.Alignment % Res[i]->GetBaseAlignment());
+        EXPECT_EQ(0u, A.Offset % A.Alignment) << "Resource " << i;
+        EXPECT_LE(A.Offset + A.Size, HeapSize) << "Resource " << i;
+
+        for(uint32_t j = i + 1; j + 1 < Res.size(); j++)
+        {
+            const GMM_SUBALLOC_PLACEMENT &B = Placements[j];
+
+            if(A.HeapIndex == B.HeapIndex)
+            {
+                EXPECT_TRUE((A.Offset + A.Size <= B.Offset) || (B.Offset + B.Size <= A.Offset)) << "Resources " << i << ", " << j;
+            }
+        }
+    }
+
+    // Deterministic.
+    ASSERT_EQ(GMM_SUCCESS, pGmmULTClientContext->PackResInfoObjects(&Res[0], (uint32_t)Res.size(), &Params, &Repeat[0], &Again));
+    for(uint32_t i = 0; i < Res.size(); i++)
+    {
+        EXPECT_EQ(Placements[i].HeapIndex, Repeat[i].HeapIndex);
+        EXPECT_EQ(Placements[i].Offset, Repeat[i].Offset);
+    }
+    EXPECT_EQ(Report.NumHeaps, Again.NumHeaps);
+    EXPECT_EQ(Report.FreeBytes, Again.FreeBytes);
+    EXPECT_EQ(Report.LargestFreeBlock, Again.LargestFreeBlock);
+
+    for(uint32_t i = 0; i < Res.size(); i++)
+    {
+        pGmmULTClientContext->DestroyResInfoObject(Res[i]);
+    }
+}
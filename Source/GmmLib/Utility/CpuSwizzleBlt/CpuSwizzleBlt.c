@@ -338,6 +338,7 @@ typedef struct _CPU_SWIZZLE_BLT_SURFACE
     int                         OffsetX;        // Horizontal offset into surface for BLT rectangle, in bytes.
     int                         OffsetY;        // Vertical offset into surface for BLT rectangle, in physical/pitch rows.
     int                         OffsetZ;        // Zero if N/A, or 3D offset into surface for BLT rectangle, in 3D slices or MSAA samples as appropriate.
+    int                         Temporal;       // Swizzled surface only: Nonzero to access via cache (regular loads/stores), rather than non-temporal streaming.
 
     #ifdef SUB_ELEMENT_SUPPORT
         struct _CPU_SWIZZLE_BLT_SURFACE_ELEMENT
@@ -353,8 +354,14 @@ typedef struct _CPU_SWIZZLE_BLT_SURFACE
     #endif
 } CPU_SWIZZLE_BLT_SURFACE;
 
+typedef void (*CPU_SWIZZLE_BLT_KERNEL)(CPU_SWIZZLE_BLT_SURFACE *pDest, CPU_SWIZZLE_BLT_SURFACE *pSrc, int CopyWidthBytes, int CopyHeight);
+
 extern int SwizzleOffset(const SWIZZLE_DESCRIPTOR *pSwizzle, int Pitch, int OffsetX, int OffsetY, int OffsetZ);
+extern void SwizzleOffsetBatch(const SWIZZLE_DESCRIPTOR *pSwizzle, int Pitch, int Count, const int *pOffsetX, const int *pOffsetY, const int *pOffsetZ, int *pSwizzledOffset);
+extern void SwizzleOffsetInverseBatch(const SWIZZLE_DESCRIPTOR *pSwizzle, int Pitch, int Count, const int *pSwizzledOffset, int *pOffsetX, int *pOffsetY, int *pOffsetZ);
 extern void CpuSwizzleBlt(CPU_SWIZZLE_BLT_SURFACE *pDest, CPU_SWIZZLE_BLT_SURFACE *pSrc, int CopyWidthBytes, int CopyHeight);
+extern CPU_SWIZZLE_BLT_KERNEL CpuSwizzleBltKernel(const SWIZZLE_DESCRIPTOR *pSwizzle, int LinearToSwizzled);
+extern void CpuSwizzleFill(CPU_SWIZZLE_BLT_SURFACE *pDest, CPU_SWIZZLE_BLT_SURFACE *pPattern, int PatternPeriodBytes, int FillWidthBytes, int FillHeight);
 
 #ifdef __cplusplus
 }
@@ -370,6 +377,8 @@ extern void CpuSwizzleBlt(CPU_SWIZZLE_BLT_SURFACE *pDest, CPU_SWIZZLE_BLT_SURFAC
 //#define MINIMALIST                // Use minimalist, unoptimized implementation.
 
 #include "assert.h" // Quoted to allow local-directory override.
+#include <limits.h>
+#include <stdint.h>
 
 #if(_MSC_VER >= 1400)
     #include <intrin.h>
@@ -384,20 +393,143 @@ extern void CpuSwizzleBlt(CPU_SWIZZLE_BLT_SURFACE *pDest, CPU_SWIZZLE_BLT_SURFAC
 
 
 // POPCNT: Count Lit Bits...                 0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15
-static unsigned char PopCnt4[16] =          {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+static const unsigned char PopCnt4[16] =    {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
 #define POPCNT4(x)  (PopCnt4[(x) & 0xf])
 #define POPCNT16(x) (POPCNT4((x) >> 12) + POPCNT4((x) >> 8) + POPCNT4((x) >> 4) + POPCNT4(x))
 
 
-int SwizzleOffset( // ##########################################################
+// CPU Feature Detection #######################################################
 
-    /* Return swizzled offset of dimensionally-specified surface byte. */
+/* Wider-than-SSE transfer instructions are selected at runtime, since the
+library is built for a baseline ISA. Detection involves CPUID (and XGETBV, to
+confirm OS saves the wider register state), which is too costly to repeat on
+every BLT--so it's done once per process and cached.
+
+The cache is a single int written once with a complete value. Racing first
+callers compute identical values, so no locking is needed. */
+
+#define CPU_SWIZZLE_FEATURE_DETECTED    (1 << 0)
+#define CPU_SWIZZLE_FEATURE_SSE41       (1 << 1) // MOVNTDQA
+#define CPU_SWIZZLE_FEATURE_AVX2        (1 << 2)
+#define CPU_SWIZZLE_FEATURE_AVX512F     (1 << 3)
+#define CPU_SWIZZLE_FEATURE_BMI2        (1 << 4) // PDEP/PEXT
+#define CPU_SWIZZLE_FEATURE_NEON        (1 << 5)
+
+#ifdef CPU_SWIZZLE_FEATURE_OVERRIDE
+    /* Benchmark/test harnesses (e.g. GMMBENCH) compiling this file themselves
+    can restrict the paths used to compare them: only CPU_SWIZZLE_FEATURE_*
+    bits set in the harness-defined mask are reported. */
+    extern int CpuSwizzleFeatureMask;
+#endif
+
+#if((defined __GNUC__) && !(defined __ARM_ARCH))
+    #define CPU_SWIZZLE_TARGET(Isa) __attribute__((target(Isa)))
+#else
+    #define CPU_SWIZZLE_TARGET(Isa)
+#endif
+
+#if(_MSC_VER)
+    #define CPU_SWIZZLE_INLINE      __forceinline
+#else
+    #define CPU_SWIZZLE_INLINE      inline __attribute__((always_inline))
+#endif
+
+static int CpuSwizzleFeatures(void) // #########################################
+{
+    static volatile int CachedFeatures = 0;
+
+    int Features = CachedFeatures;
+
+    if(!Features)
+    {
+        Features = CPU_SWIZZLE_FEATURE_DETECTED;
+
+        #if(defined(__ARM_ARCH))
+        {
+            #if(defined(__ARM_NEON) || defined(__aarch64__))
+                Features |= CPU_SWIZZLE_FEATURE_NEON;
+            #endif
+        }
+        #else
+        {
+            unsigned int Leaf1Ecx, Leaf7Ebx = 0;
+            unsigned long long Xcr0 = 0;
+
+            #if(_MSC_VER >= 1500)
+                int CpuInfo[4];
+                __cpuid(CpuInfo, 0);
+                if(CpuInfo[0] >= 7)
+                {
+                    __cpuidex(CpuInfo, 7, 0);
+                    Leaf7Ebx = CpuInfo[1];
+                }
+                __cpuid(CpuInfo, 1);
+                Leaf1Ecx = CpuInfo[2];
+                #if(_MSC_VER >= 1600)
+                    if(Leaf1Ecx & (1 << 27)) Xcr0 = _xgetbv(0); // ECX[27] = OSXSAVE
+                #endif
+            #else
+                unsigned int eax, ebx, ecx, edx;
+                if(__get_cpuid_max(0, NULL) >= 7)
+                {
+                    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+                    Leaf7Ebx = ebx;
+                }
+                __cpuid(1, eax, ebx, ecx, edx);
+                Leaf1Ecx = ecx;
+                if(Leaf1Ecx & (1 << 27)) // ECX[27] = OSXSAVE
+                {
+                    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+                    Xcr0 = ((unsigned long long) edx << 32) | eax;
+                }
+            #endif
+
+            if(Leaf1Ecx & (1 << 19)) Features |= CPU_SWIZZLE_FEATURE_SSE41; // ECX[19] = SSE4.1
+            if(Leaf7Ebx & (1 << 8))  Features |= CPU_SWIZZLE_FEATURE_BMI2;  // EBX[8] = BMI2
+
+            if(((Xcr0 & 0x06) == 0x06) && // OS saves XMM/YMM state...
+               (Leaf7Ebx & (1 << 5)))     // EBX[5] = AVX2
+            {
+                Features |= CPU_SWIZZLE_FEATURE_AVX2;
+
+                if(((Xcr0 & 0xe0) == 0xe0) && // ...and opmask/ZMM state...
+                   (Leaf7Ebx & (1 << 16)))    // EBX[16] = AVX-512F
+                {
+                    Features |= CPU_SWIZZLE_FEATURE_AVX512F;
+                }
+            }
+        }
+        #endif
+
+        CachedFeatures = Features;
+    }
+
+    #ifdef CPU_SWIZZLE_FEATURE_OVERRIDE
+        Features &= CpuSwizzleFeatureMask | CPU_SWIZZLE_FEATURE_DETECTED;
+    #endif
+
+    return(Features);
+}
+
+
+#if((_MSC_VER >= 1700) || (defined (__BMI2__)))
+    #define PDEP(Src, Mask) _pdep_u32((Src), (Mask))
+#else
+    #define PDEP(Src, Mask) 0
+#endif
+
+static CPU_SWIZZLE_INLINE int SwizzleOffsetTemplate( // ########################
+
+    /* Body of SwizzleOffset, inlined so that callers with compile-time-
+    constant descriptors (e.g. specialized CpuSwizzleBlt kernels) have
+    computation folded away. */
 
     const SWIZZLE_DESCRIPTOR    *pSwizzle,  // Pointer to applicable swizzle descriptor.
     int                         Pitch,      // Pointer to applicable surface row-pitch.
     int                         OffsetX,    // Horizontal offset into surface of the target byte, in bytes.
     int                         OffsetY,    // Vertical offset into surface of the target byte, in physical/pitch rows.
-    int                         OffsetZ)    // Zero if N/A, or 3D offset into surface of the target byte, in 3D slices or MSAA samples as appropriate.
+    int                         OffsetZ,    // Zero if N/A, or 3D offset into surface of the target byte, in 3D slices or MSAA samples as appropriate.
+    int                         PDepSupported) // Nonzero to use PDEP (when compiled in) rather than PDEP workalike.
 
     /* Given logically-specified (x, y, z) byte within swizzled surface,
     function returns byte's linear/memory offset from surface's base--i.e. it
@@ -412,8 +544,6 @@ int SwizzleOffset( // ##########################################################
 
 { // ###########################################################################
 
-    char PDepSupported = -1; // AVX2/BMI2 PDEP (Parallel Deposit) Instruction
-
     int SwizzledOffset; // Return value being computed.
 
     int TileWidthBits =  POPCNT16(pSwizzle->Mask.x); // Log2(Tile Width in Bytes)
@@ -425,24 +555,6 @@ int SwizzleOffset( // ##########################################################
     int Row, Col;   // Tile grid position on surface, of tile containing specified byte.
     int x, y, z;    // Position of specified byte within tile that contains it.
 
-    if(PDepSupported == -1)
-    {
-        #if(_MSC_VER >= 1700)
-            #define PDEP(Src, Mask) _pdep_u32((Src), (Mask))
-            int CpuInfo[4];
-            __cpuidex(CpuInfo, 7, 0);
-            PDepSupported = ((CpuInfo[1] & (1 << 8)) != 0); // EBX[8] = BMI2
-        #elif ( defined (__BMI2__ ))
-            #define PDEP(Src, Mask) _pdep_u32((Src), (Mask))
-            unsigned int eax, ebx, ecx, edx;
-            __cpuid_count(7, 0, eax, ebx, ecx, edx);
-            PDepSupported = ((ebx & (1 << 8)) != 0); // EBX[8] = BMI2
-        #else
-            #define PDEP(Src, Mask) 0
-            PDepSupported = 0;
-        #endif
-    }
-
     assert( // Mutually Exclusive Swizzle Positions...
         (pSwizzle->Mask.x | pSwizzle->Mask.y | pSwizzle->Mask.z) ==
         (pSwizzle->Mask.x + pSwizzle->Mask.y + pSwizzle->Mask.z));
@@ -502,14 +614,506 @@ int SwizzleOffset( // ##########################################################
 }
 
 
-void CpuSwizzleBlt( // #########################################################
+int SwizzleOffset( // ##########################################################
+
+    /* Return swizzled offset of dimensionally-specified surface byte. */
+
+    const SWIZZLE_DESCRIPTOR    *pSwizzle,  // Pointer to applicable swizzle descriptor.
+    int                         Pitch,      // Pointer to applicable surface row-pitch.
+    int                         OffsetX,    // Horizontal offset into surface of the target byte, in bytes.
+    int                         OffsetY,    // Vertical offset into surface of the target byte, in physical/pitch rows.
+    int                         OffsetZ)    // Zero if N/A, or 3D offset into surface of the target byte, in 3D slices or MSAA samples as appropriate.
+
+    /* See SwizzleOffsetTemplate. */
+
+{ // ###########################################################################
+
+    int PDepSupported = 0; // AVX2/BMI2 PDEP (Parallel Deposit) Instruction
+
+    #if((_MSC_VER >= 1700) || (defined (__BMI2__)))
+        PDepSupported = ((CpuSwizzleFeatures() & CPU_SWIZZLE_FEATURE_BMI2) != 0);
+    #endif
+
+    return(SwizzleOffsetTemplate(pSwizzle, Pitch, OffsetX, OffsetY, OffsetZ, PDepSupported));
+}
+
+
+// Batched Offset Conversion ###################################################
+
+/* SwizzleOffsetBatch/SwizzleOffsetInverseBatch convert arrays of positions to
+swizzled offsets and back, for callers (e.g. software rasterizers, debug
+tools) needing many per frame. Per-swizzle setup is done once per batch, and
+the intra-tile bit deposit/extract then uses BMI2 PDEP/PEXT where the CPU has
+it--selected at runtime, since the library is built for a baseline ISA--else
+byte-indexed lookup tables built from the swizzle masks. */
+
+#define SWIZZLE_BATCH_LUT_MIN_COUNT 256 // Below this, building LUT's costs more than it saves.
+
+typedef struct _SWIZZLE_BATCH_SETUP
+{
+    int     TileWidthBits, TileHeightBits, TileDepthBits, TileSizeBits, TilesPerRow;
+} SWIZZLE_BATCH_SETUP;
+
+static void SwizzleBatchSetup(const SWIZZLE_DESCRIPTOR *pSwizzle, int Pitch, SWIZZLE_BATCH_SETUP *pSetup)
+{
+    pSetup->TileWidthBits =  POPCNT16(pSwizzle->Mask.x);
+    pSetup->TileHeightBits = POPCNT16(pSwizzle->Mask.y);
+    pSetup->TileDepthBits =  POPCNT16(pSwizzle->Mask.z);
+    pSetup->TileSizeBits =   pSetup->TileWidthBits + pSetup->TileHeightBits + pSetup->TileDepthBits;
+    pSetup->TilesPerRow =    Pitch >> pSetup->TileWidthBits;
+
+    assert( // Mutually Exclusive Swizzle Positions...
+        (pSwizzle->Mask.x | pSwizzle->Mask.y | pSwizzle->Mask.z) ==
+        (pSwizzle->Mask.x + pSwizzle->Mask.y + pSwizzle->Mask.z));
+
+    assert( // Swizzle Limited to 16-bit (LUT's below are two bytes deep)...
+        (pSwizzle->Mask.x | pSwizzle->Mask.y | pSwizzle->Mask.z) < (1 << 16));
+
+    assert( // Pitch is Multiple of Tile Width...
+        Pitch == ((Pitch >> pSetup->TileWidthBits) << pSetup->TileWidthBits));
+}
+
+static void SwizzleBatchLut( // ################################################
+
+    /* Builds two-byte LUT for depositing into (Extract == 0), or extracting
+    from (Extract != 0), given 16-bit mask. Lut[0][b] and Lut[1][b] handle
+    low and high source bytes, so result is Lut[0][v & 0xff] | Lut[1][v >> 8]. */
+
+    int Mask,
+    int Extract,
+    unsigned short Lut[2][256])
+
+{ // ###########################################################################
+
+    int Bit, Rank = 0, Byte, i;
+    unsigned short SingleBit[16] = {0}; // Result for each lone source bit.
+
+    for(Bit = 0; Bit < 16; Bit++)
+    {
+        if(Extract)
+        {
+            if(Mask & (1 << Bit)) SingleBit[Bit] = (unsigned short) (1 << Rank++);
+        }
+        else
+        {
+            while((Rank < 16) && !(Mask & (1 << Rank))) Rank++;
+            if(Rank < 16) SingleBit[Bit] = (unsigned short) (1 << Rank++);
+        }
+    }
+
+    for(Byte = 0; Byte < 2; Byte++)
+    {
+        Lut[Byte][0] = 0;
+        for(i = 1; i < 256; i++)
+        {
+            // Lowest set bit, combined with (already built) remaining bits...
+            int Lowest = i & -i;
+            int LowestIndex = POPCNT4((Lowest - 1) >> 4) + POPCNT4(Lowest - 1);
+            Lut[Byte][i] = Lut[Byte][i & (i - 1)] | SingleBit[Byte * 8 + LowestIndex];
+        }
+    }
+}
+
+#if((_MSC_VER >= 1700) || ((defined __GNUC__) && !(defined __ARM_ARCH)))
+    #define CPU_SWIZZLE_BMI2_KERNELS
+
+    static CPU_SWIZZLE_TARGET("bmi2") void SwizzleOffsetBatch_BMI2(
+        const SWIZZLE_DESCRIPTOR *pSwizzle, const SWIZZLE_BATCH_SETUP *pSetup, int Count,
+        const int *pOffsetX, const int *pOffsetY, const int *pOffsetZ, int *pSwizzledOffset)
+    {
+        unsigned int MaskX = pSwizzle->Mask.x, MaskY = pSwizzle->Mask.y, MaskZ = pSwizzle->Mask.z;
+        int i;
+
+        for(i = 0; i < Count; i++)
+        {
+            int x = pOffsetX[i], y = pOffsetY[i], z = pOffsetZ ? pOffsetZ[i] : 0;
+
+            pSwizzledOffset[i] =
+                (((y >> pSetup->TileHeightBits) * pSetup->TilesPerRow + (x >> pSetup->TileWidthBits)) << pSetup->TileSizeBits) +
+                (int) (_pdep_u32((unsigned int) x, MaskX) | _pdep_u32((unsigned int) y, MaskY) | _pdep_u32((unsigned int) z, MaskZ));
+        }
+    }
+
+    static CPU_SWIZZLE_TARGET("bmi2") void SwizzleOffsetInverseBatch_BMI2(
+        const SWIZZLE_DESCRIPTOR *pSwizzle, const SWIZZLE_BATCH_SETUP *pSetup, int Count,
+        const int *pSwizzledOffset, int *pOffsetX, int *pOffsetY, int *pOffsetZ)
+    {
+        unsigned int MaskX = pSwizzle->Mask.x, MaskY = pSwizzle->Mask.y, MaskZ = pSwizzle->Mask.z;
+        int i;
+
+        for(i = 0; i < Count; i++)
+        {
+            int Tile = pSwizzledOffset[i] >> pSetup->TileSizeBits;
+            unsigned int Intra = (unsigned int) pSwizzledOffset[i];
+
+            pOffsetX[i] = ((Tile % pSetup->TilesPerRow) << pSetup->TileWidthBits) + (int) _pext_u32(Intra, MaskX);
+            pOffsetY[i] = ((Tile / pSetup->TilesPerRow) << pSetup->TileHeightBits) + (int) _pext_u32(Intra, MaskY);
+            if(pOffsetZ) pOffsetZ[i] = (int) _pext_u32(Intra, MaskZ);
+        }
+    }
+#endif
+
+
+void SwizzleOffsetBatch( // ####################################################
+
+    /* Return swizzled offsets of array of dimensionally-specified bytes. */
+
+    const SWIZZLE_DESCRIPTOR    *pSwizzle,          // Pointer to applicable swizzle descriptor.
+    int                         Pitch,              // Applicable surface row-pitch.
+    int                         Count,              // Number of positions to convert.
+    const int                   *pOffsetX,          // Horizontal offsets of target bytes, in bytes.
+    const int                   *pOffsetY,          // Vertical offsets of target bytes, in physical/pitch rows.
+    const int                   *pOffsetZ,          // NULL if N/A, or 3D offsets (slices or MSAA samples) of target bytes--each within a single tile depth.
+    int                         *pSwizzledOffset)   // Receives Count swizzled offsets.
+
+    /* Equivalent to calling SwizzleOffset for each position. */
+
+{ // ###########################################################################
+
+    SWIZZLE_BATCH_SETUP Setup;
+    int i;
+
+    assert(pSwizzle && (Count >= 0) && pOffsetX && pOffsetY && pSwizzledOffset);
+
+    SwizzleBatchSetup(pSwizzle, Pitch, &Setup);
+
+    #ifdef CPU_SWIZZLE_BMI2_KERNELS
+        if(CpuSwizzleFeatures() & CPU_SWIZZLE_FEATURE_BMI2)
+        {
+            SwizzleOffsetBatch_BMI2(pSwizzle, &Setup, Count, pOffsetX, pOffsetY, pOffsetZ, pSwizzledOffset);
+            return;
+        }
+    #endif
+
+    if(Count >= SWIZZLE_BATCH_LUT_MIN_COUNT)
+    {
+        unsigned short LutX[2][256], LutY[2][256], LutZ[2][256];
+
+        SwizzleBatchLut(pSwizzle->Mask.x, 0, LutX);
+        SwizzleBatchLut(pSwizzle->Mask.y, 0, LutY);
+        SwizzleBatchLut(pSwizzle->Mask.z, 0, LutZ);
+
+        for(i = 0; i < Count; i++)
+        {
+            int x = pOffsetX[i], y = pOffsetY[i], z = pOffsetZ ? pOffsetZ[i] : 0;
+            int xt = x & ((1 << Setup.TileWidthBits) - 1);
+            int yt = y & ((1 << Setup.TileHeightBits) - 1);
+
+            assert((z >> Setup.TileDepthBits) == 0);
+
+            pSwizzledOffset[i] =
+                (((y >> Setup.TileHeightBits) * Setup.TilesPerRow + (x >> Setup.TileWidthBits)) << Setup.TileSizeBits) +
+                (LutX[0][xt & 0xff] | LutX[1][xt >> 8]) +
+                (LutY[0][yt & 0xff] | LutY[1][yt >> 8]) +
+                (LutZ[0][z & 0xff] | LutZ[1][z >> 8]);
+        }
+    }
+    else
+    {
+        for(i = 0; i < Count; i++)
+        {
+            pSwizzledOffset[i] = SwizzleOffsetTemplate(pSwizzle, Pitch, pOffsetX[i], pOffsetY[i], pOffsetZ ? pOffsetZ[i] : 0, 0);
+        }
+    }
+}
+
+
+void SwizzleOffsetInverseBatch( // #############################################
+
+    /* Return dimensional positions of array of swizzled surface offsets. */
+
+    const SWIZZLE_DESCRIPTOR    *pSwizzle,          // Pointer to applicable swizzle descriptor.
+    int                         Pitch,              // Applicable surface row-pitch.
+    int                         Count,              // Number of offsets to convert.
+    const int                   *pSwizzledOffset,   // Swizzled offsets of target bytes.
+    int                         *pOffsetX,          // Receives horizontal offsets, in bytes.
+    int                         *pOffsetY,          // Receives vertical offsets, in physical/pitch rows.
+    int                         *pOffsetZ)          // NULL if N/A, or receives 3D offsets (slices or MSAA samples) within tile depth.
+
+    /* Inverse of SwizzleOffsetBatch--i.e. performs the swizzled, linear-to-
+    spatial mapping. */
+
+{ // ###########################################################################
+
+    SWIZZLE_BATCH_SETUP Setup;
+    int i;
+
+    assert(pSwizzle && (Count >= 0) && pSwizzledOffset && pOffsetX && pOffsetY);
+
+    SwizzleBatchSetup(pSwizzle, Pitch, &Setup);
+
+    #ifdef CPU_SWIZZLE_BMI2_KERNELS
+        if(CpuSwizzleFeatures() & CPU_SWIZZLE_FEATURE_BMI2)
+        {
+            SwizzleOffsetInverseBatch_BMI2(pSwizzle, &Setup, Count, pSwizzledOffset, pOffsetX, pOffsetY, pOffsetZ);
+            return;
+        }
+    #endif
+
+    {
+        unsigned short LutX[2][256], LutY[2][256], LutZ[2][256];
+
+        SwizzleBatchLut(pSwizzle->Mask.x, 1, LutX);
+        SwizzleBatchLut(pSwizzle->Mask.y, 1, LutY);
+        SwizzleBatchLut(pSwizzle->Mask.z, 1, LutZ);
+
+        for(i = 0; i < Count; i++)
+        {
+            int Tile = pSwizzledOffset[i] >> Setup.TileSizeBits;
+            int Lo = pSwizzledOffset[i] & 0xff, Hi = (pSwizzledOffset[i] >> 8) & 0xff;
+
+            pOffsetX[i] = ((Tile % Setup.TilesPerRow) << Setup.TileWidthBits) + (LutX[0][Lo] | LutX[1][Hi]);
+            pOffsetY[i] = ((Tile / Setup.TilesPerRow) << Setup.TileHeightBits) + (LutY[0][Lo] | LutY[1][Hi]);
+            if(pOffsetZ) pOffsetZ[i] = LutZ[0][Lo] | LutZ[1][Hi];
+        }
+    }
+}
+
+
+#ifndef MINIMALIST
+
+// Cache-Line Kernels ##########################################################
+
+/* For swizzles whose low-order bits are "Y Y X X X X" (e.g. TileY, Tile4,
+Tile64, Yf/Ys), an aligned 16x4 transfer chunk is a single, contiguous 64-byte
+cache line of swizzled memory. The SSE path moves such a chunk as four 16-byte
+transfers; the kernels below move it as one (AVX-512) or two (AVX2) full-width
+transfers, so WC/streaming buffers always see whole cache lines.
+
+Each kernel transfers MainRunBytes (multiple of 16) bytes of four linear rows,
+swizzled-incrementing SwizzledOffsetX by the 16-byte MaskX, and returns the
+advanced SwizzledOffsetX. Caller guarantees every chunk is 64-byte aligned.
+Swizzled memory is accessed with non-temporal loads/stores when Streaming,
+else with regular ones (NEON has no distinction). */
+
+typedef int (*CPU_SWIZZLE_CACHE_LINE_KERNEL)(
+    char    *pSwizzledAddressLine,
+    int     SwizzledOffsetX,
+    int     MaskX,
+    char    *pLinearAddress,
+    int     LinearPitch,
+    int     MainRunBytes,
+    int     Streaming);
+
+typedef struct _CPU_SWIZZLE_CACHE_LINE_KERNELS
+{
+    CPU_SWIZZLE_CACHE_LINE_KERNEL   pfnLinearToSwizzled;
+    CPU_SWIZZLE_CACHE_LINE_KERNEL   pfnSwizzledToLinear;
+} CPU_SWIZZLE_CACHE_LINE_KERNELS;
+
+#if(defined(__ARM_ARCH))
+
+    #if(defined(__ARM_NEON) || defined(__aarch64__))
+
+        static int CacheLineLinearToSwizzled_NEON(char *pSwizzledAddressLine, int SwizzledOffsetX, int MaskX, char *pLinearAddress, int LinearPitch, int MainRunBytes, int Streaming)
+        {
+            (void) Streaming;
+
+            char *pLinearAddressEnd = pLinearAddress + MainRunBytes;
+            while(pLinearAddress < pLinearAddressEnd)
+            {
+                uint8_t *pSwizzledAddress = (uint8_t *) (pSwizzledAddressLine + SwizzledOffsetX);
+                uint8x16_t Row0 = vld1q_u8((const uint8_t *) (pLinearAddress));
+                uint8x16_t Row1 = vld1q_u8((const uint8_t *) (pLinearAddress + LinearPitch));
+                uint8x16_t Row2 = vld1q_u8((const uint8_t *) (pLinearAddress + 2 * LinearPitch));
+                uint8x16_t Row3 = vld1q_u8((const uint8_t *) (pLinearAddress + 3 * LinearPitch));
+                vst1q_u8(pSwizzledAddress,      Row0);
+                vst1q_u8(pSwizzledAddress + 16, Row1);
+                vst1q_u8(pSwizzledAddress + 32, Row2);
+                vst1q_u8(pSwizzledAddress + 48, Row3);
+
+                SwizzledOffsetX = (SwizzledOffsetX - MaskX) & MaskX;
+                pLinearAddress += 16;
+            }
+            return(SwizzledOffsetX);
+        }
+
+        static int CacheLineSwizzledToLinear_NEON(char *pSwizzledAddressLine, int SwizzledOffsetX, int MaskX, char *pLinearAddress, int LinearPitch, int MainRunBytes, int Streaming)
+        {
+            (void) Streaming;
+
+            char *pLinearAddressEnd = pLinearAddress + MainRunBytes;
+            while(pLinearAddress < pLinearAddressEnd)
+            {
+                const uint8_t *pSwizzledAddress = (const uint8_t *) (pSwizzledAddressLine + SwizzledOffsetX);
+                uint8x16_t Row0 = vld1q_u8(pSwizzledAddress);
+                uint8x16_t Row1 = vld1q_u8(pSwizzledAddress + 16);
+                uint8x16_t Row2 = vld1q_u8(pSwizzledAddress + 32);
+                uint8x16_t Row3 = vld1q_u8(pSwizzledAddress + 48);
+                vst1q_u8((uint8_t *) (pLinearAddress),                   Row0);
+                vst1q_u8((uint8_t *) (pLinearAddress + LinearPitch),     Row1);
+                vst1q_u8((uint8_t *) (pLinearAddress + 2 * LinearPitch), Row2);
+                vst1q_u8((uint8_t *) (pLinearAddress + 3 * LinearPitch), Row3);
+
+                SwizzledOffsetX = (SwizzledOffsetX - MaskX) & MaskX;
+                pLinearAddress += 16;
+            }
+            return(SwizzledOffsetX);
+        }
+
+        static const CPU_SWIZZLE_CACHE_LINE_KERNELS CacheLineKernels_NEON =
+            { CacheLineLinearToSwizzled_NEON, CacheLineSwizzledToLinear_NEON };
+
+    #endif
+
+#elif((_MSC_VER >= 1700) || (defined __clang__) || (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))
+
+    #define CPU_SWIZZLE_AVX_KERNELS
+
+    CPU_SWIZZLE_TARGET("avx2")
+    static int CacheLineLinearToSwizzled_AVX2(char *pSwizzledAddressLine, int SwizzledOffsetX, int MaskX, char *pLinearAddress, int LinearPitch, int MainRunBytes, int Streaming)
+    {
+        char *pLinearAddressEnd = pLinearAddress + MainRunBytes;
+        while(pLinearAddress < pLinearAddressEnd)
+        {
+            __m256i *pSwizzledAddress = (__m256i *) (pSwizzledAddressLine + SwizzledOffsetX);
+            __m256i Rows01 = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128((__m128i *) (pLinearAddress))),
+                _mm_loadu_si128((__m128i *) (pLinearAddress + LinearPitch)), 1);
+            __m256i Rows23 = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128((__m128i *) (pLinearAddress + 2 * LinearPitch))),
+                _mm_loadu_si128((__m128i *) (pLinearAddress + 3 * LinearPitch)), 1);
+            if(Streaming)
+            {
+                _mm256_stream_si256(pSwizzledAddress,     Rows01);
+                _mm256_stream_si256(pSwizzledAddress + 1, Rows23);
+            }
+            else
+            {
+                _mm256_store_si256(pSwizzledAddress,     Rows01);
+                _mm256_store_si256(pSwizzledAddress + 1, Rows23);
+            }
+
+            SwizzledOffsetX = (SwizzledOffsetX - MaskX) & MaskX;
+            pLinearAddress += 16;
+        }
+        return(SwizzledOffsetX);
+    }
+
+    CPU_SWIZZLE_TARGET("avx2")
+    static int CacheLineSwizzledToLinear_AVX2(char *pSwizzledAddressLine, int SwizzledOffsetX, int MaskX, char *pLinearAddress, int LinearPitch, int MainRunBytes, int Streaming)
+    {
+        char *pLinearAddressEnd = pLinearAddress + MainRunBytes;
+        while(pLinearAddress < pLinearAddressEnd)
+        {
+            __m256i *pSwizzledAddress = (__m256i *) (pSwizzledAddressLine + SwizzledOffsetX);
+            __m256i Rows01 = Streaming ? _mm256_stream_load_si256(pSwizzledAddress)     : _mm256_load_si256(pSwizzledAddress);
+            __m256i Rows23 = Streaming ? _mm256_stream_load_si256(pSwizzledAddress + 1) : _mm256_load_si256(pSwizzledAddress + 1);
+            _mm_storeu_si128((__m128i *) (pLinearAddress),                   _mm256_castsi256_si128(Rows01));
+            _mm_storeu_si128((__m128i *) (pLinearAddress + LinearPitch),     _mm256_extracti128_si256(Rows01, 1));
+            _mm_storeu_si128((__m128i *) (pLinearAddress + 2 * LinearPitch), _mm256_castsi256_si128(Rows23));
+            _mm_storeu_si128((__m128i *) (pLinearAddress + 3 * LinearPitch), _mm256_extracti128_si256(Rows23, 1));
+
+            SwizzledOffsetX = (SwizzledOffsetX - MaskX) & MaskX;
+            pLinearAddress += 16;
+        }
+        return(SwizzledOffsetX);
+    }
+
+    CPU_SWIZZLE_TARGET("avx512f")
+    static int CacheLineLinearToSwizzled_AVX512(char *pSwizzledAddressLine, int SwizzledOffsetX, int MaskX, char *pLinearAddress, int LinearPitch, int MainRunBytes, int Streaming)
+    {
+        char *pLinearAddressEnd = pLinearAddress + MainRunBytes;
+        while(pLinearAddress < pLinearAddressEnd)
+        {
+            __m512i Line = _mm512_castsi128_si512(_mm_loadu_si128((__m128i *) (pLinearAddress)));
+            Line = _mm512_inserti32x4(Line, _mm_loadu_si128((__m128i *) (pLinearAddress + LinearPitch)), 1);
+            Line = _mm512_inserti32x4(Line, _mm_loadu_si128((__m128i *) (pLinearAddress + 2 * LinearPitch)), 2);
+            Line = _mm512_inserti32x4(Line, _mm_loadu_si128((__m128i *) (pLinearAddress + 3 * LinearPitch)), 3);
+            if(Streaming)
+            {
+                _mm512_stream_si512((void *) (pSwizzledAddressLine + SwizzledOffsetX), Line);
+            }
+            else
+            {
+                _mm512_store_si512((void *) (pSwizzledAddressLine + SwizzledOffsetX), Line);
+            }
+
+            SwizzledOffsetX = (SwizzledOffsetX - MaskX) & MaskX;
+            pLinearAddress += 16;
+        }
+        return(SwizzledOffsetX);
+    }
+
+    CPU_SWIZZLE_TARGET("avx512f")
+    static int CacheLineSwizzledToLinear_AVX512(char *pSwizzledAddressLine, int SwizzledOffsetX, int MaskX, char *pLinearAddress, int LinearPitch, int MainRunBytes, int Streaming)
+    {
+        char *pLinearAddressEnd = pLinearAddress + MainRunBytes;
+        while(pLinearAddress < pLinearAddressEnd)
+        {
+            __m512i Line = Streaming ?
+                _mm512_stream_load_si512((void *) (pSwizzledAddressLine + SwizzledOffsetX)) :
+                _mm512_load_si512((void *) (pSwizzledAddressLine + SwizzledOffsetX));
+            // (Zero-masked extracts, since some compilers' unmasked forms trip uninitialized-use warnings.)
+            _mm_storeu_si128((__m128i *) (pLinearAddress),                   _mm512_maskz_extracti32x4_epi32(0xf, Line, 0));
+            _mm_storeu_si128((__m128i *) (pLinearAddress + LinearPitch),     _mm512_maskz_extracti32x4_epi32(0xf, Line, 1));
+            _mm_storeu_si128((__m128i *) (pLinearAddress + 2 * LinearPitch), _mm512_maskz_extracti32x4_epi32(0xf, Line, 2));
+            _mm_storeu_si128((__m128i *) (pLinearAddress + 3 * LinearPitch), _mm512_maskz_extracti32x4_epi32(0xf, Line, 3));
+
+            SwizzledOffsetX = (SwizzledOffsetX - MaskX) & MaskX;
+            pLinearAddress += 16;
+        }
+        return(SwizzledOffsetX);
+    }
+
+    static const CPU_SWIZZLE_CACHE_LINE_KERNELS CacheLineKernels_AVX2 =
+        { CacheLineLinearToSwizzled_AVX2, CacheLineSwizzledToLinear_AVX2 };
+
+    static const CPU_SWIZZLE_CACHE_LINE_KERNELS CacheLineKernels_AVX512 =
+        { CacheLineLinearToSwizzled_AVX512, CacheLineSwizzledToLinear_AVX512 };
+
+#endif
+
+
+static const CPU_SWIZZLE_CACHE_LINE_KERNELS *CpuSwizzleCacheLineKernels(void) // #
+{
+    /* Returns best available cache-line kernels for this CPU, or NULL if only
+    the SSE path applies. */
+
+    const CPU_SWIZZLE_CACHE_LINE_KERNELS *pKernels = NULL;
+    int Features = CpuSwizzleFeatures();
+
+    #if(defined(CPU_SWIZZLE_AVX_KERNELS))
+        if(Features & CPU_SWIZZLE_FEATURE_AVX512F)
+        {
+            pKernels = &CacheLineKernels_AVX512;
+        }
+        else if(Features & CPU_SWIZZLE_FEATURE_AVX2)
+        {
+            pKernels = &CacheLineKernels_AVX2;
+        }
+    #elif(defined(__ARM_ARCH) && (defined(__ARM_NEON) || defined(__aarch64__)))
+        if(Features & CPU_SWIZZLE_FEATURE_NEON)
+        {
+            pKernels = &CacheLineKernels_NEON;
+        }
+    #else
+        (void) Features;
+    #endif
+
+    return(pKernels);
+}
+
+#endif // MINIMALIST
+
+
+static CPU_SWIZZLE_INLINE void CpuSwizzleBltTemplate( // #######################
 
     /* Performs specified swizzling BLT between two given surfaces. */
 
-    CPU_SWIZZLE_BLT_SURFACE *pDest,         // Pointer to destination surface descriptor.
-    CPU_SWIZZLE_BLT_SURFACE *pSrc,          // Pointer to source surface descriptor.
-    int                     CopyWidthBytes, // Width of BLT rectangle, in bytes.
-    int                     CopyHeight)     // Height of BLT rectangle, in physical/pitch rows.
+    CPU_SWIZZLE_BLT_SURFACE     *pDest,             // Pointer to destination surface descriptor.
+    CPU_SWIZZLE_BLT_SURFACE     *pSrc,              // Pointer to source surface descriptor.
+    int                         CopyWidthBytes,     // Width of BLT rectangle, in bytes.
+    int                         CopyHeight,         // Height of BLT rectangle, in physical/pitch rows.
+    const SWIZZLE_DESCRIPTOR    *pSwizzle,          // Swizzle of whichever surface is swizzled.
+    int                         LinearToSwizzled,   // Nonzero if pDest is the swizzled surface.
+    int                         FullElementsOnly)   // Nonzero if caller guarantees no sub-element transfer.
+
+    /* Body of CpuSwizzleBlt--Always inlined, so that when instantiated with
+    compile-time-constant pSwizzle/LinearToSwizzled/FullElementsOnly (see
+    "Specialized Kernels" below), the compiler folds the swizzle masks,
+    transfer dimensions and MaskX/MaskY computation to constants, and drops
+    the unused XFER instantiations. */
 
     #ifdef SUB_ELEMENT_SUPPORT
 
@@ -523,12 +1127,12 @@ void CpuSwizzleBlt( // #########################################################
 { // ###########################################################################
 
     CPU_SWIZZLE_BLT_SURFACE *pLinearSurface, *pSwizzledSurface;
-    int LinearToSwizzled;
+    int SubElementXfer = 0;
 
     { // One surface swizzled, the other unswizzled (aka "linear")...
         assert((pDest->pSwizzle != NULL) ^ (pSrc->pSwizzle != NULL));
+        assert(LinearToSwizzled == !pSrc->pSwizzle);
 
-        LinearToSwizzled = !pSrc->pSwizzle;
         if(LinearToSwizzled)
         {
             pSwizzledSurface =  pDest;
@@ -541,8 +1145,23 @@ void CpuSwizzleBlt( // #########################################################
         }
     }
 
+    assert(pSwizzle == pSwizzledSurface->pSwizzle ||
+        ((pSwizzle->Mask.x == pSwizzledSurface->pSwizzle->Mask.x) &&
+         (pSwizzle->Mask.y == pSwizzledSurface->pSwizzle->Mask.y) &&
+         (pSwizzle->Mask.z == pSwizzledSurface->pSwizzle->Mask.z)));
+
     #ifdef SUB_ELEMENT_SUPPORT
     {
+        SubElementXfer =
+            !FullElementsOnly &&
+            ((pLinearSurface->Element.Size != pLinearSurface->Element.Pitch) ||
+             (pSwizzledSurface->Element.Size != pSwizzledSurface->Element.Pitch));
+
+        assert( // Specialized kernels not handed sub-element transfers...
+            !FullElementsOnly ||
+            ((pLinearSurface->Element.Size == pLinearSurface->Element.Pitch) &&
+             (pSwizzledSurface->Element.Size == pSwizzledSurface->Element.Pitch)));
+
         assert( // Either both or neither specified...
             (pDest->Element.Pitch != 0) == (pSrc->Element.Pitch != 0));
 
@@ -716,16 +1335,18 @@ void CpuSwizzleBlt( // #########################################################
             #define MIN_CONTAINED_POW2_BELOW_CAP(x, Cap) (1 << LOW_BIT((1 << LOW_BIT(x)) | (1 << HIGH_BIT(Cap))))
 
             #define SWIZZLE_OFFSET(OffsetX, OffsetY, OffsetZ) \
-                SwizzleOffset(pSwizzledSurface->pSwizzle, pSwizzledSurface->Pitch, OffsetX, OffsetY, OffsetZ)
+                SwizzleOffsetTemplate(pSwizzle, pSwizzledSurface->Pitch, OffsetX, OffsetY, OffsetZ, 0)
 
             #define MAX_XFER_WIDTH  16  // See "Compute Transfer Dimensions".
             #define MAX_XFER_HEIGHT 4   // "
 
             char StreamingLoadSupported = -1; // SSE4.1: MOVNTDQA
+            int Streaming = !pSwizzledSurface->Temporal; // Non-temporal swizzled accesses (MOVNTDQ/MOVNTDQA), unless caller wants surface left in cache.
+            const CPU_SWIZZLE_CACHE_LINE_KERNELS *pCacheLineKernels = NULL; // Non-NULL when wide cache-line transfers usable.
 
-            int TileWidthBits = POPCNT16(pSwizzledSurface->pSwizzle->Mask.x);   // Log2(Tile Width in Bytes)
-            int TileHeightBits = POPCNT16(pSwizzledSurface->pSwizzle->Mask.y);  // Log2(Tile Height)
-            int TileDepthBits = POPCNT16(pSwizzledSurface->pSwizzle->Mask.z);   // Log2(Tile Depth or MSAA Samples)
+            int TileWidthBits = POPCNT16(pSwizzle->Mask.x);   // Log2(Tile Width in Bytes)
+            int TileHeightBits = POPCNT16(pSwizzle->Mask.y);  // Log2(Tile Height)
+            int TileDepthBits = POPCNT16(pSwizzle->Mask.z);   // Log2(Tile Depth or MSAA Samples)
             int BytesPerRowOfTiles = pSwizzledSurface->Pitch << (TileDepthBits + TileHeightBits);
 
             struct { int LeftCrust, MainRun, RightCrust; } CopyWidth;
@@ -741,25 +1362,19 @@ void CpuSwizzleBlt( // #########################################################
 
             if(StreamingLoadSupported == -1)
             {
-                #if(_MSC_VER >= 1500)
-                    #define MOVNTDQA_R(Reg, Src) ((Reg) = _mm_stream_load_si128((__m128i *)(Src)))
-                    int CpuInfo[4];
-                    __cpuid(CpuInfo, 1);
-                    StreamingLoadSupported = ((CpuInfo[2] & (1 << 19)) != 0); // ECX[19] = SSE4.1
-                #elif(defined(__ARM_ARCH))
+                #if(defined(__ARM_ARCH))
                     #define MOVNTDQA_R(Reg, Src) ((Reg) = (Reg))
                     StreamingLoadSupported = 0;
-                #elif((defined __clang__) || (__GNUC__ > 4) || (__GNUC__ == 4) && (__GNUC_MINOR__ >= 5))
+                #elif((_MSC_VER >= 1500) || (defined __clang__) || (__GNUC__ > 4) || (__GNUC__ == 4) && (__GNUC_MINOR__ >= 5))
                     #define MOVNTDQA_R(Reg, Src) ((Reg) = _mm_stream_load_si128((__m128i *)(Src)))
-                    unsigned int eax, ebx, ecx, edx;
-                    __cpuid(1, eax, ebx, ecx, edx);
-                    StreamingLoadSupported = ((ecx & (1 << 19)) != 0); // ECX[19] = SSE4.1
+                    StreamingLoadSupported = ((CpuSwizzleFeatures() & CPU_SWIZZLE_FEATURE_SSE41) != 0);
                 #else
                     #define MOVNTDQA_R(Reg, Src) ((Reg) = (Reg))
                     StreamingLoadSupported = 0;
                 #endif
             }
 
+
             { // Compute Transfer Dimensions...
 
                 /* When transferring between linear and swizzled surfaces, we
@@ -807,7 +1422,7 @@ void CpuSwizzleBlt( // #########################################################
                 // Narrow optimized transfer Width by looking for inflection from X's...
                 SwizzleMaxXfer.Width = MAX_XFER_WIDTH;
                 while(  (TargetMask = SwizzleMaxXfer.Width - 1) &&
-                        ((pSwizzledSurface->pSwizzle->Mask.x & TargetMask) != TargetMask))
+                        ((pSwizzle->Mask.x & TargetMask) != TargetMask))
                 {
                     SwizzleMaxXfer.Width >>= 1;
                 }
@@ -816,12 +1431,22 @@ void CpuSwizzleBlt( // #########################################################
                 SwizzleMaxXfer.Height = MAX_XFER_HEIGHT;
 
                 while(  (TargetMask = (SwizzleMaxXfer.Height - 1) * SwizzleMaxXfer.Width) &&
-                        ((pSwizzledSurface->pSwizzle->Mask.y & TargetMask) != TargetMask))
+                        ((pSwizzle->Mask.y & TargetMask) != TargetMask))
                 {
                     SwizzleMaxXfer.Height >>= 1;
                 }
             }
 
+            { // Wide cache-line transfers when 16x4 chunks are whole, aligned cache lines...
+                if( (SwizzleMaxXfer.Width == MAX_XFER_WIDTH) &&
+                    (SwizzleMaxXfer.Height == MAX_XFER_HEIGHT) &&
+                    (((intptr_t) pSwizzledAddressCopyBase & 63) == 0) &&
+                    !SubElementXfer)
+                {
+                    pCacheLineKernels = CpuSwizzleCacheLineKernels();
+                }
+            }
+
             { // Separate CopyWidthBytes into unaligned left/right "crust" and aligned "MainRun"...
                 int MaxXferWidth = MIN_CONTAINED_POW2_BELOW_CAP(SwizzleMaxXfer.Width, CopyWidthBytes);
 
@@ -836,8 +1461,7 @@ void CpuSwizzleBlt( // #########################################################
                 #ifdef SUB_ELEMENT_SUPPORT
                 {
                     // For partial-pixel transfers, there is no crust and MainRun is done pixel-by-pixel...
-                    if( (pLinearSurface->Element.Size != pLinearSurface->Element.Pitch) ||
-                        (pSwizzledSurface->Element.Size != pSwizzledSurface->Element.Pitch))
+                    if(SubElementXfer)
                     {
                         CopyWidth.LeftCrust = CopyWidth.RightCrust = 0;
                         CopyWidth.MainRun = CopyWidthBytes;
@@ -902,9 +1526,9 @@ void CpuSwizzleBlt( // #########################################################
 
             { // Compute Mask[IncSize] for Needed Increment Values...
                 int ExtendedMaskX = // Bits beyond the tile (so X incrementing can operate inter-tile)...
-                    ~(pSwizzledSurface->pSwizzle->Mask.x |
-                      pSwizzledSurface->pSwizzle->Mask.y |
-                      pSwizzledSurface->pSwizzle->Mask.z);
+                    ~(pSwizzle->Mask.x |
+                      pSwizzle->Mask.y |
+                      pSwizzle->Mask.z);
 
                 /* Subtraction below delivers natural mask for +1 increment,
                 and appropriately altered mask to deliver +1 to higher bit
@@ -994,23 +1618,47 @@ void CpuSwizzleBlt( // #########################################################
                     {                                       \
                         if(XFER_Crust)                      \
                         {                                   \
-                            XFER_SPAN(MOVB_M, MOVB_R, CopyWidth.LeftCrust  & 1, 1, 1, XFER_LINES_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
-                            XFER_SPAN(MOVW_M, MOVW_R, CopyWidth.LeftCrust  & 2, 2, 2, XFER_LINES_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
-                            XFER_SPAN(MOVD_M, MOVD_R, CopyWidth.LeftCrust  & 4, 4, 4, XFER_LINES_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
-                            XFER_SPAN(MOVQ_M, MOVQ_R, CopyWidth.LeftCrust  & 8, 8, 8, XFER_LINES_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
+                            XFER_LEFT_CRUST(XFER_LINES_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
                         }                                   \
                                                             \
                         XFER_SPAN(XFER_Store, XFER_Load, CopyWidth.MainRun, XFER_Pitch_Swizzled, XFER_Pitch_Linear, XFER_LINES_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch);\
                                                             \
                         if(XFER_Crust)                      \
                         {                                   \
-                            XFER_SPAN(MOVQ_M, MOVQ_R, CopyWidth.RightCrust & 8, 8, 8, XFER_LINES_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
-                            XFER_SPAN(MOVD_M, MOVD_R, CopyWidth.RightCrust & 4, 4, 4, XFER_LINES_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
-                            XFER_SPAN(MOVW_M, MOVW_R, CopyWidth.RightCrust & 2, 2, 2, XFER_LINES_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
-                            XFER_SPAN(MOVB_M, MOVB_R, CopyWidth.RightCrust & 1, 1, 1, XFER_LINES_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
+                            XFER_RIGHT_CRUST(XFER_LINES_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
                         }                                   \
                     }
 
+                #define XFER_LEFT_CRUST(XFER_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch) \
+                {                                                                                                                           \
+                    XFER_SPAN(MOVB_M, MOVB_R, CopyWidth.LeftCrust  & 1, 1, 1, XFER_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
+                    XFER_SPAN(MOVW_M, MOVW_R, CopyWidth.LeftCrust  & 2, 2, 2, XFER_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
+                    XFER_SPAN(MOVD_M, MOVD_R, CopyWidth.LeftCrust  & 4, 4, 4, XFER_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
+                    XFER_SPAN(MOVQ_M, MOVQ_R, CopyWidth.LeftCrust  & 8, 8, 8, XFER_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
+                }
+
+                #define XFER_RIGHT_CRUST(XFER_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch) \
+                {                                                                                                                           \
+                    XFER_SPAN(MOVQ_M, MOVQ_R, CopyWidth.RightCrust & 8, 8, 8, XFER_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
+                    XFER_SPAN(MOVD_M, MOVD_R, CopyWidth.RightCrust & 4, 4, 4, XFER_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
+                    XFER_SPAN(MOVW_M, MOVW_R, CopyWidth.RightCrust & 2, 2, 2, XFER_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
+                    XFER_SPAN(MOVB_M, MOVB_R, CopyWidth.RightCrust & 1, 1, 1, XFER_Lines, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
+                }
+
+                /* Four-line variant of XFER whose MainRun is handed to a
+                cache-line kernel, rather than expanded into SSE X-loop. */
+                #define XFER_CACHE_LINES(XFER_Kernel, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch) \
+                {                                                                                   \
+                    XFER_LEFT_CRUST(MAX_XFER_HEIGHT, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch);  \
+                                                                                                    \
+                    SwizzledOffsetX = XFER_Kernel(                                                  \
+                        pSwizzledAddressLine, SwizzledOffsetX, MaskX[MAX_XFER_WIDTH],               \
+                        pLinearAddress, pLinearSurface->Pitch, CopyWidth.MainRun, Streaming);       \
+                    pLinearAddress += CopyWidth.MainRun;                                            \
+                                                                                                    \
+                    XFER_RIGHT_CRUST(MAX_XFER_HEIGHT, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch); \
+                }
+
                 #define XFER_SPAN(XFER_Store, XFER_Load, XFER_CopyWidthBytes, XFER_Pitch_Swizzled, XFER_Pitch_Linear, XFER_Height, XFER_pDest, XFER_DestPitch, XFER_pSrc, XFER_SrcPitch) \
                 {                                                                           \
                     pLinearAddressEnd = pLinearAddress + (XFER_CopyWidthBytes);             \
@@ -1059,14 +1707,24 @@ void CpuSwizzleBlt( // #########################################################
                     (pSwizzledSurface->Pitch % 16 == 0));
 
                 #ifdef SUB_ELEMENT_SUPPORT
-                    if( (pLinearSurface->Element.Size != pLinearSurface->Element.Pitch) ||
-                        (pSwizzledSurface->Element.Size != pSwizzledSurface->Element.Pitch))
+                    if(SubElementXfer)
                     {
                         if(LinearToSwizzled)
                         {
                             switch(pLinearSurface->Element.Size)
                             {
-                                case 16: XFER(MOVNTDQ_M, MOVDQU_R, pSwizzledSurface->Element.Pitch, pLinearSurface->Element.Pitch, pSwizzledAddress, SwizzleMaxXfer.Width, pLinearAddress, pLinearSurface->Pitch, 0); break;
+                                case 16:
+                                {
+                                    if(Streaming)
+                                    {
+                                        XFER(MOVNTDQ_M, MOVDQU_R, pSwizzledSurface->Element.Pitch, pLinearSurface->Element.Pitch, pSwizzledAddress, SwizzleMaxXfer.Width, pLinearAddress, pLinearSurface->Pitch, 0);
+                                    }
+                                    else
+                                    {
+                                        XFER(  MOVDQ_M, MOVDQU_R, pSwizzledSurface->Element.Pitch, pLinearSurface->Element.Pitch, pSwizzledAddress, SwizzleMaxXfer.Width, pLinearAddress, pLinearSurface->Pitch, 0);
+                                    }
+                                    break;
+                                }
                                 case  8: XFER(   MOVQ_M,   MOVQ_R, pSwizzledSurface->Element.Pitch, pLinearSurface->Element.Pitch, pSwizzledAddress, SwizzleMaxXfer.Width, pLinearAddress, pLinearSurface->Pitch, 0); break;
                                 case  4: XFER(   MOVD_M,   MOVD_R, pSwizzledSurface->Element.Pitch, pLinearSurface->Element.Pitch, pSwizzledAddress, SwizzleMaxXfer.Width, pLinearAddress, pLinearSurface->Pitch, 0); break;
                                 case  3: XFER(   MOV3_M,   MOV3_R, pSwizzledSurface->Element.Pitch, pLinearSurface->Element.Pitch, pSwizzledAddress, SwizzleMaxXfer.Width, pLinearAddress, pLinearSurface->Pitch, 0); break;
@@ -1081,7 +1739,7 @@ void CpuSwizzleBlt( // #########################################################
                             {
                                 case 16:
                                 {
-                                    if(StreamingLoadSupported)
+                                    if(StreamingLoadSupported && Streaming)
                                     {
                                         XFER(MOVDQU_M, MOVNTDQA_R, pSwizzledSurface->Element.Pitch, pLinearSurface->Element.Pitch, pLinearAddress, pLinearSurface->Pitch, pSwizzledAddress, SwizzleMaxXfer.Width, 0);
                                     }
@@ -1101,11 +1759,33 @@ void CpuSwizzleBlt( // #########################################################
                         }
                     } else
                 #endif // SUB_ELEMENT_SUPPORT
-                if(LinearToSwizzled)
+                if(pCacheLineKernels && (xferHeight == MAX_XFER_HEIGHT))
+                {
+                    if(LinearToSwizzled)
+                    {
+                        XFER_CACHE_LINES(pCacheLineKernels->pfnLinearToSwizzled, pSwizzledAddress, 16, pLinearAddress, pLinearSurface->Pitch);
+                    }
+                    else
+                    {
+                        XFER_CACHE_LINES(pCacheLineKernels->pfnSwizzledToLinear, pLinearAddress, pLinearSurface->Pitch, pSwizzledAddress, 16);
+                    }
+                }
+                else if(LinearToSwizzled)
                 {
                     switch(SwizzleMaxXfer.Width)
                     {
-                        case 16: XFER(MOVNTDQ_M, MOVDQU_R, 16, 16, pSwizzledAddress, 16, pLinearAddress, pLinearSurface->Pitch, 1); break;
+                        case 16:
+                        {
+                            if(Streaming)
+                            {
+                                XFER(MOVNTDQ_M, MOVDQU_R, 16, 16, pSwizzledAddress, 16, pLinearAddress, pLinearSurface->Pitch, 1);
+                            }
+                            else
+                            {
+                                XFER(  MOVDQ_M, MOVDQU_R, 16, 16, pSwizzledAddress, 16, pLinearAddress, pLinearSurface->Pitch, 1);
+                            }
+                            break;
+                        }
                         #ifdef INTEL_TILE_W_SUPPORT
                             case  2: XFER(MOVW_M,  MOVW_R,  2,  2, pSwizzledAddress,  2, pLinearAddress, pLinearSurface->Pitch, 1); break;
                         #endif
@@ -1118,7 +1798,7 @@ void CpuSwizzleBlt( // #########################################################
                     {
                         case 16:
                         {
-                            if(StreamingLoadSupported)
+                            if(StreamingLoadSupported && Streaming)
                             {
                                 XFER(MOVDQU_M, MOVNTDQA_R, 16, 16, pLinearAddress, pLinearSurface->Pitch, pSwizzledAddress, 16, 1);
                             }
@@ -1148,7 +1828,10 @@ void CpuSwizzleBlt( // #########################################################
 
             } // foreach(y)
 
-            _mm_sfence(); // Flush Non-Temporal Writes
+            if(Streaming)
+            {
+                _mm_sfence(); // Flush Non-Temporal Writes
+            }
 
             #if(_MSC_VER)
                 #pragma warning(pop)
@@ -1156,7 +1839,235 @@ void CpuSwizzleBlt( // #########################################################
         }
         #endif
     }
-} // CpuSwizzleBlt
+} // CpuSwizzleBltTemplate
+
+
+void CpuSwizzleBlt( // #########################################################
+
+    /* Performs specified swizzling BLT between two given surfaces. */
+
+    CPU_SWIZZLE_BLT_SURFACE *pDest,         // Pointer to destination surface descriptor.
+    CPU_SWIZZLE_BLT_SURFACE *pSrc,          // Pointer to source surface descriptor.
+    int                     CopyWidthBytes, // Width of BLT rectangle, in bytes.
+    int                     CopyHeight)     // Height of BLT rectangle, in physical/pitch rows.
+
+    /* Generic instantiation of CpuSwizzleBltTemplate--i.e. swizzle and
+    transfer direction determined at runtime. */
+
+{ // ###########################################################################
+
+    int LinearToSwizzled = !pSrc->pSwizzle;
+
+    CpuSwizzleBltTemplate(
+        pDest, pSrc, CopyWidthBytes, CopyHeight,
+        LinearToSwizzled ? pDest->pSwizzle : pSrc->pSwizzle,
+        LinearToSwizzled,
+        0);
+}
+
+
+// Specialized Kernels #########################################################
+
+/* Swizzles used for bulk of CPU uploads/downloads get CpuSwizzleBltTemplate
+instantiated with compile-time-constant descriptor and direction, so each
+kernel's setup is constant-folded and its X-loops are only those that swizzle
+can use. Kernels accept same arguments as CpuSwizzleBlt and fall back to it
+for sub-element transfers.
+
+Swizzles with identical masks (e.g. INTEL_TILE_64_128 and INTEL_TILE_64_64)
+share a kernel, since lookup below is by mask rather than by descriptor. */
+
+#ifndef MINIMALIST
+
+    #define CPU_SWIZZLE_SPECIALIZED_KERNELS(Name)                                                                   \
+        static void CpuSwizzleBlt_Upload_##Name(CPU_SWIZZLE_BLT_SURFACE *pDest, CPU_SWIZZLE_BLT_SURFACE *pSrc, int CopyWidthBytes, int CopyHeight) \
+        {                                                                                                           \
+            if(CPU_SWIZZLE_FULL_ELEMENTS(pDest, pSrc))                                                             \
+            {                                                                                                       \
+                CpuSwizzleBltTemplate(pDest, pSrc, CopyWidthBytes, CopyHeight, &Name, 1, 1);                        \
+            }                                                                                                       \
+            else                                                                                                    \
+            {                                                                                                       \
+                CpuSwizzleBlt(pDest, pSrc, CopyWidthBytes, CopyHeight);                                             \
+            }                                                                                                       \
+        }                                                                                                           \
+        static void CpuSwizzleBlt_Download_##Name(CPU_SWIZZLE_BLT_SURFACE *pDest, CPU_SWIZZLE_BLT_SURFACE *pSrc, int CopyWidthBytes, int CopyHeight) \
+        {                                                                                                           \
+            if(CPU_SWIZZLE_FULL_ELEMENTS(pDest, pSrc))                                                             \
+            {                                                                                                       \
+                CpuSwizzleBltTemplate(pDest, pSrc, CopyWidthBytes, CopyHeight, &Name, 0, 1);                        \
+            }                                                                                                       \
+            else                                                                                                    \
+            {                                                                                                       \
+                CpuSwizzleBlt(pDest, pSrc, CopyWidthBytes, CopyHeight);                                             \
+            }                                                                                                       \
+        }
+
+    #ifdef SUB_ELEMENT_SUPPORT
+        #define CPU_SWIZZLE_FULL_ELEMENTS(pDest, pSrc) \
+            (((pDest)->Element.Size == (pDest)->Element.Pitch) && ((pSrc)->Element.Size == (pSrc)->Element.Pitch))
+    #else
+        #define CPU_SWIZZLE_FULL_ELEMENTS(pDest, pSrc) 1
+    #endif
+
+    #define CPU_SWIZZLE_SPECIALIZED_SWIZZLES(_) \
+        _(INTEL_TILE_X)                         \
+        _(INTEL_TILE_Y)                         \
+        _(INTEL_TILE_4)                         \
+        _(INTEL_TILE_64_128)                    \
+        _(INTEL_TILE_64_32)                     \
+        _(INTEL_TILE_64_8)                      \
+        _(INTEL_TILE_YS_128)                    \
+        _(INTEL_TILE_YS_32)                     \
+        _(INTEL_TILE_YS_8)
+
+    CPU_SWIZZLE_SPECIALIZED_SWIZZLES(CPU_SWIZZLE_SPECIALIZED_KERNELS)
+
+    static const struct
+    {
+        const SWIZZLE_DESCRIPTOR    *pSwizzle;
+        CPU_SWIZZLE_BLT_KERNEL      pfnUpload, pfnDownload;
+    } SpecializedKernels[] =
+    {
+        #define CPU_SWIZZLE_SPECIALIZED_ENTRY(Name) { &Name, CpuSwizzleBlt_Upload_##Name, CpuSwizzleBlt_Download_##Name },
+        CPU_SWIZZLE_SPECIALIZED_SWIZZLES(CPU_SWIZZLE_SPECIALIZED_ENTRY)
+        #undef CPU_SWIZZLE_SPECIALIZED_ENTRY
+    };
+
+#endif // MINIMALIST
+
+
+CPU_SWIZZLE_BLT_KERNEL CpuSwizzleBltKernel( // #################################
+
+    /* Returns BLT function best suited to given swizzle and direction. */
+
+    const SWIZZLE_DESCRIPTOR    *pSwizzle,          // Swizzle of the swizzled surface.
+    int                         LinearToSwizzled)   // Nonzero for upload (linear source, swizzled destination).
+
+    /* Returned function takes same arguments (and has same behavior) as
+    CpuSwizzleBlt, which is itself returned when no specialized kernel
+    matches the given swizzle. */
+
+{ // ###########################################################################
+
+    #ifndef MINIMALIST
+    {
+        int i;
+
+        for(i = 0; pSwizzle && (i < (int) (sizeof(SpecializedKernels) / sizeof(SpecializedKernels[0]))); i++)
+        {
+            if( (SpecializedKernels[i].pSwizzle->Mask.x == pSwizzle->Mask.x) &&
+                (SpecializedKernels[i].pSwizzle->Mask.y == pSwizzle->Mask.y) &&
+                (SpecializedKernels[i].pSwizzle->Mask.z == pSwizzle->Mask.z))
+            {
+                return(
+                    LinearToSwizzled ?
+                        SpecializedKernels[i].pfnUpload :
+                        SpecializedKernels[i].pfnDownload);
+            }
+        }
+    }
+    #endif
+
+    return(CpuSwizzleBlt);
+}
+
+
+// Fill ########################################################################
+
+void CpuSwizzleFill( // ########################################################
+
+    /* Fills rectangle of swizzled surface with repeating pattern. */
+
+    CPU_SWIZZLE_BLT_SURFACE *pDest,             // Pointer to swizzled destination surface descriptor.
+    CPU_SWIZZLE_BLT_SURFACE *pPattern,          // Pointer to linear pattern descriptor (see below).
+    int                     PatternPeriodBytes, // Horizontal period of pattern rows, in bytes; multiple of 16.
+    int                     FillWidthBytes,     // Width of fill rectangle, in bytes.
+    int                     FillHeight)         // Height of fill rectangle, in physical/pitch rows.
+
+    /* Pattern is pPattern->Height rows at pPattern->Pitch, repeating
+    vertically; each row holds at least PatternPeriodBytes + 15 bytes, and is
+    itself periodic in PatternPeriodBytes (i.e. caller replicates the pattern
+    horizontally until that holds), so any 16 bytes of the fill can be loaded
+    from the row unaligned. Pattern row 0/byte 0 lands on the destination's
+    (OffsetX, OffsetY); pPattern offsets are ignored.
+
+    Unlike CpuSwizzleBlt, there's no full-size linear source: each swizzled
+    chunk--the largest run of contiguous X bytes in the swizzle, up to 16--is
+    computed by masked increment and written directly, using non-temporal
+    stores unless pDest->Temporal. */
+
+{ // ###########################################################################
+
+    const SWIZZLE_DESCRIPTOR *pSwizzle = pDest->pSwizzle;
+    int TileWidthBits = POPCNT16(pSwizzle->Mask.x);
+    int TileSizeBits = TileWidthBits + POPCNT16(pSwizzle->Mask.y) + POPCNT16(pSwizzle->Mask.z);
+    int ChunkBytes = (pSwizzle->Mask.x + 1) & ~pSwizzle->Mask.x; // Contiguous X bytes--i.e. lowest non-X address bit.
+    int ChunkMaskX, X0, TileBaseX0, InTileX0, y;
+    int Streaming = !pDest->Temporal;
+
+    if(ChunkBytes > 16) ChunkBytes = 16;
+    ChunkMaskX = pSwizzle->Mask.x & ~(ChunkBytes - 1);
+
+    assert(pPattern->Height > 0);
+    assert((PatternPeriodBytes > 0) && (PatternPeriodBytes % 16 == 0));
+    assert(((intptr_t) pDest->pBase % 16 == 0) && (pDest->Pitch % 16 == 0));
+    assert( // No surface overrun...
+        ((pDest->OffsetX + FillWidthBytes) <= pDest->Pitch) &&
+        ((pDest->OffsetY + FillHeight) <= pDest->Height));
+
+    // Swizzled offset of first chunk, separated into tile and intra-tile parts...
+    X0 = pDest->OffsetX & ~(ChunkBytes - 1);
+    TileBaseX0 = (X0 >> TileWidthBits) << TileSizeBits;
+    InTileX0 = SwizzleOffset(pSwizzle, pDest->Pitch, X0, 0, 0) - TileBaseX0;
+
+    for(y = 0; y < FillHeight; y++)
+    {
+        char *pRow = (char *) pDest->pBase + SwizzleOffset(pSwizzle, pDest->Pitch, 0, pDest->OffsetY + y, pDest->OffsetZ);
+        const char *pPatternRow = (const char *) pPattern->pBase + (y % pPattern->Height) * pPattern->Pitch;
+        int InTileX = InTileX0, TileBase = TileBaseX0, Phase = 0;
+        int x;
+
+        for(x = X0; x < pDest->OffsetX + FillWidthBytes; x += ChunkBytes)
+        {
+            int Start = (x > pDest->OffsetX) ? x : pDest->OffsetX;
+            int End = (x + ChunkBytes < pDest->OffsetX + FillWidthBytes) ? (x + ChunkBytes) : (pDest->OffsetX + FillWidthBytes);
+            char *pChunk = pRow + TileBase + InTileX + (Start - x);
+
+            if(End - Start == 16) // Whole, aligned 16-byte chunk...
+            {
+                __m128i Value = _mm_loadu_si128((const __m128i *) (pPatternRow + Phase));
+                if(Streaming)
+                {
+                    _mm_stream_si128((__m128i *) pChunk, Value);
+                }
+                else
+                {
+                    _mm_store_si128((__m128i *) pChunk, Value);
+                }
+            }
+            else // Crust, or narrow-chunk swizzle...
+            {
+                int i;
+                for(i = 0; i < End - Start; i++)
+                {
+                    pChunk[i] = pPatternRow[Phase + i];
+                }
+            }
+
+            Phase += End - Start;
+            if(Phase >= PatternPeriodBytes) Phase -= PatternPeriodBytes;
+
+            InTileX = (InTileX - ChunkMaskX) & ChunkMaskX;
+            if(!InTileX) TileBase += 1 << TileSizeBits; // Wrapped to next tile over.
+        }
+    }
+
+    if(Streaming)
+    {
+        _mm_sfence(); // Flush Non-Temporal Writes
+    }
+}
 
 #endif // #ifndef INCLUDE_CpuSwizzleBlt_c_AS_HEADER
 // clang-format on
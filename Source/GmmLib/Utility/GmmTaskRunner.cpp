@@ -0,0 +1,278 @@
+/*==============================================================================
+Copyright(c) 2017 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and / or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+============================================================================*/
+
+#include "Internal/Common/GmmLibInc.h"
+
+#ifndef __GMM_KMD__
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////
+/// GmmLib-internal worker threads for GmmRunTasks(), started on first use
+/// and kept until library unload, so parallel calls don't pay for thread
+/// creation and joins each time. Runs one job at a time: the submitting
+/// thread works too, and up to MaxThreads - 1 idle workers join it, each
+/// pulling tasks from a shared counter.
+/////////////////////////////////////////////////////////////////////////
+static const uint32_t GmmTaskPoolMaxWorkers = 63;
+
+class GmmTaskPool
+{
+private:
+    std::mutex              JobMutex;   // Held by the job's submitter.
+    std::mutex              Mutex;      // Guards everything below.
+    std::condition_variable Wake;
+    std::condition_variable Done;
+    std::vector<std::thread> Workers;
+    uint64_t                Generation; // Bumped per job.
+    uint32_t                NumWanted;  // Workers that may still join the job.
+    uint32_t                NumActive;  // Workers running the job.
+    uint8_t                 Exit;
+    PFN_GMM_TASK            pfnTask;
+    void *                  pTaskContext;
+    uint32_t                NumTasks;
+    std::atomic<uint32_t>   NextTask;
+
+    /////////////////////////////////////////////////////////////////////////
+    /// Runs tasks of the current job until none are left.
+    /////////////////////////////////////////////////////////////////////////
+    void RunJob(PFN_GMM_TASK pfnJobTask, void *pJobContext, uint32_t NumJobTasks)
+    {
+        uint32_t Task;
+
+        while((Task = NextTask.fetch_add(1)) < NumJobTasks)
+        {
+            pfnJobTask(pJobContext, Task);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    /// Worker thread body: joins each job after Seen at most once, while
+    /// wanted.
+    /////////////////////////////////////////////////////////////////////////
+    void Work(uint64_t Seen)
+    {
+        std::unique_lock<std::mutex> Lock(Mutex);
+
+        for(;;)
+        {
+            Wake.wait(Lock, [&] { return Exit || ((Generation != Seen) && NumWanted); });
+
+            if(Exit)
+            {
+                return;
+            }
+
+            PFN_GMM_TASK pfnJobTask  = pfnTask;
+            void *       pJobContext = pTaskContext;
+            uint32_t     NumJobTasks = NumTasks;
+
+            Seen = Generation;
+            NumWanted--;
+            NumActive++;
+
+            Lock.unlock();
+            RunJob(pfnJobTask, pJobContext, NumJobTasks);
+            Lock.lock();
+
+            if(--NumActive == 0)
+            {
+                Done.notify_one();
+            }
+        }
+    }
+
+public:
+    GmmTaskPool() :
+        Generation(0),
+        NumWanted(0),
+        NumActive(0),
+        Exit(0),
+        pfnTask(NULL),
+        pTaskContext(NULL),
+        NumTasks(0),
+        NextTask(0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    /// Runs pfnTask(pTaskContext, i) for each i in [0, NumTasks) on the
+    /// calling thread plus up to NumHelpers workers.
+    ///
+    /// @return     0 if the pool is busy (or shut down), and nothing was run
+    /////////////////////////////////////////////////////////////////////////
+    uint8_t Run(uint32_t NumHelpers, uint32_t NumJobTasks, PFN_GMM_TASK pfnJobTask, void *pJobContext)
+    {
+        std::unique_lock<std::mutex> JobLock(JobMutex, std::try_to_lock);
+
+        if(!JobLock.owns_lock())
+        {
+            return 0; // Concurrent or nested job.
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+
+            if(Exit)
+            {
+                return 0;
+            }
+
+            NumHelpers = GFX_MIN(NumHelpers, GmmTaskPoolMaxWorkers);
+
+            try
+            {
+                while(Workers.size() < NumHelpers)
+                {
+                    Workers.emplace_back(&GmmTaskPool::Work, this, Generation); // Joins the job below.
+                }
+            }
+            catch(...)
+            {
+                // Thread creation failure just means less parallelism.
+            }
+
+            pfnTask      = pfnJobTask;
+            pTaskContext = pJobContext;
+            NumTasks     = NumJobTasks;
+            NextTask     = 0;
+            NumWanted    = GFX_MIN(NumHelpers, static_cast<uint32_t>(Workers.size()));
+            Generation++;
+        }
+
+        Wake.notify_all();
+
+        RunJob(pfnJobTask, pJobContext, NumJobTasks);
+
+        std::unique_lock<std::mutex> Lock(Mutex);
+
+        NumWanted = 0; // Tasks are all claimed--late workers needn't join.
+        Done.wait(Lock, [&] { return NumActive == 0; });
+
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    /// Stops and joins the workers. Later jobs run on the calling thread.
+    /////////////////////////////////////////////////////////////////////////
+    void Shutdown()
+    {
+        std::vector<std::thread> Exiting;
+
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+
+            Exit = 1;
+            Exiting.swap(Workers);
+        }
+
+        Wake.notify_all();
+
+        for(auto &Thread : Exiting)
+        {
+            Thread.join();
+        }
+    }
+};
+
+// Never destructed: workers are stopped by GmmTaskRunnerShutdown() at library
+// unload, not by static destruction order.
+static GmmTaskPool *GmmGetTaskPool()
+{
+    static GmmTaskPool *pTaskPool = new GmmTaskPool();
+
+    return pTaskPool;
+}
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Returns the number of threads a parallel call may use under pParallel.
+///
+/// @param[in]  pParallel: Threading controls, or NULL for GmmLib defaults
+/// @return     Thread count, at least 1
+/////////////////////////////////////////////////////////////////////////////////////
+uint32_t GmmTaskMaxThreads(const GMM_TASK_PARALLEL *pParallel)
+{
+    uint32_t MaxThreads = pParallel ? pParallel->MaxThreads : 0;
+
+#ifndef __GMM_KMD__
+    if(!MaxThreads)
+    {
+        MaxThreads = GFX_MAX(std::thread::hardware_concurrency(), 1u);
+    }
+#else
+    if(!pParallel || !pParallel->pfnParallelFor)
+    {
+        MaxThreads = 1; // No GmmLib-internal threads in KMD.
+    }
+#endif
+
+    return GFX_MAX(MaxThreads, 1u);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Runs pfnTask(pTaskContext, i) for each i in [0, NumTasks)--on the caller's
+/// pool if pParallel provides one, else on up to MaxThreads threads of the
+/// GmmLib-internal GmmTaskPool (calling thread included), or just the calling
+/// thread if that pool is busy. Returns once all tasks have completed.
+///
+/// @param[in]  pParallel: Threading controls (for pfnParallelFor), or NULL
+/// @param[in]  MaxThreads: Upper bound on GmmLib-internal threads
+/// @param[in]  NumTasks: Number of tasks
+/// @param[in]  pfnTask: Task function
+/// @param[in]  pTaskContext: Passed through to pfnTask
+/////////////////////////////////////////////////////////////////////////////////////
+void GmmRunTasks(const GMM_TASK_PARALLEL *pParallel, uint32_t MaxThreads, uint32_t NumTasks, PFN_GMM_TASK pfnTask, void *pTaskContext)
+{
+    if(pParallel && pParallel->pfnParallelFor)
+    {
+        pParallel->pfnParallelFor(pParallel->pPoolContext, NumTasks, pfnTask, pTaskContext);
+    }
+    else
+    {
+#ifndef __GMM_KMD__
+        uint32_t NumHelpers = (NumTasks > 1) ? GFX_MIN(MaxThreads, NumTasks) - 1 : 0; // Calling thread also works.
+
+        if(NumHelpers && GmmGetTaskPool()->Run(NumHelpers, NumTasks, pfnTask, pTaskContext))
+        {
+            return;
+        }
+#endif
+        for(uint32_t Task = 0; Task < NumTasks; Task++)
+        {
+            pfnTask(pTaskContext, Task);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+/// Stops GmmLib-internal worker threads, at library unload.
+/////////////////////////////////////////////////////////////////////////////////////
+void GmmTaskRunnerShutdown()
+{
+#ifndef __GMM_KMD__
+    GmmGetTaskPool()->Shutdown();
+#endif
+}
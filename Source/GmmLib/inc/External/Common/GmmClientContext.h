@@ -76,6 +76,9 @@ namespace GmmLib
     /// are specific to each client.
     /////////////////////////////////////////////////////////////////////////
     class Context;
+    class GmmResInfoPool;
+    class GmmSharedResInfo;
+    class GmmResInfoBatchSet;
     class GMM_LIB_API NON_PAGED_SECTION GmmClientContext : public GmmMemAllocator
     {
     protected:
@@ -91,6 +94,13 @@ namespace GmmLib
         // Flag to indicate Device_callbacks received.
         uint8_t             IsDeviceCbReceived;
         Context *pGmmLibContext;
+        GmmResInfoPool      *pResInfoPool;  // Opt-in, see EnableResInfoPool().
+        GmmSharedResInfo    *pSharedResInfo; // Opt-in, see EnableSharedLayouts().
+        uint8_t             LayoutCacheEnabled; // Opt-in, see SetLayoutCacheEnable().
+        GmmResInfoBatchSet  *pResInfoBatches; // Blocks from CreateResInfoObjects().
+
+        GMM_RESOURCE_INFO*  AllocResInfoObject(GmmClientContext *pClientContextIn);
+        void                FreeResInfoObject(GMM_RESOURCE_INFO *pResInfo);
 
     public:
         /* Constructor */
@@ -115,6 +125,15 @@ namespace GmmLib
             return pGmmLibContext;
         }
 
+        /////////////////////////////////////////////////////////////////////////////////////
+        /// Returns whether this client's creates use the lib context's layout cache.
+        /// @return     1 if opted in via SetLayoutCacheEnable(), 0 otherwise
+        /////////////////////////////////////////////////////////////////////////////////////
+        GMM_INLINE uint8_t IsLayoutCacheEnabled()
+        {
+            return (LayoutCacheEnabled);
+        }
+
         /* Function prototypes */
         /* CachePolicy Related Exported Functions from GMM Lib */
         GMM_VIRTUAL MEMORY_OBJECT_CONTROL_STATE         GMM_STDCALL CachePolicyGetMemoryObject(GMM_RESOURCE_INFO *pResInfo, GMM_RESOURCE_USAGE_TYPE Usage);
@@ -184,6 +203,20 @@ namespace GmmLib
 	
 	GMM_VIRTUAL void GMM_STDCALL            GmmSetAIL(GMM_AIL_STRUCT *pAilFlags);
 	GMM_VIRTUAL const uint64_t *GMM_STDCALL GmmGetAIL();
+        GMM_VIRTUAL CPU_SWIZZLE_BLT_KERNEL GMM_STDCALL  GetSwizzleBltKernel(EXTERNAL_SWIZZLE_NAME ExternalSwizzleName, EXTERNAL_RES_TYPE ResType, uint8_t bpe, bool Upload, bool isStdSwizzle = false);
+        GMM_VIRTUAL void GMM_STDCALL                    SwizzleOffsetBatch(const SWIZZLE_DESCRIPTOR *pSwizzle, int Pitch, int Count, const int *pOffsetX, const int *pOffsetY, const int *pOffsetZ, int *pSwizzledOffset);
+        GMM_VIRTUAL void GMM_STDCALL                    SwizzleOffsetInverseBatch(const SWIZZLE_DESCRIPTOR *pSwizzle, int Pitch, int Count, const int *pSwizzledOffset, int *pOffsetX, int *pOffsetY, int *pOffsetZ);
+        GMM_VIRTUAL void GMM_STDCALL                    GetLayoutCacheStats(GMM_LAYOUT_CACHE_STATS *pStats);
+        GMM_VIRTUAL void GMM_STDCALL                    SetLayoutCacheEnable(uint8_t Enable);
+        GMM_VIRTUAL void GMM_STDCALL                    FlushLayoutCache();
+        GMM_VIRTUAL GMM_STATUS GMM_STDCALL              CreateResInfoObjects(GMM_RESCREATE_PARAMS *pCreateParams, uint32_t Count, GMM_RESOURCE_INFO **ppRes, const GMM_TASK_PARALLEL *pParallel);
+        GMM_VIRTUAL void GMM_STDCALL                    DestroyResInfoObjects(GMM_RESOURCE_INFO **ppRes, uint32_t Count);
+        GMM_VIRTUAL GMM_STATUS GMM_STDCALL              EnableResInfoPool();
+        GMM_VIRTUAL GMM_STATUS GMM_STDCALL              EnableSharedLayouts();
+        GMM_VIRTUAL GMM_STATUS GMM_STDCALL              GetTileModeAdvice(const GMM_RESCREATE_PARAMS *pCreateParams, GMM_TILE_ADVICE *pAdvice);
+        GMM_VIRTUAL GMM_STATUS GMM_STDCALL              EstimateResourceSize(const GMM_RESCREATE_PARAMS *pCreateParams, GMM_SIZE_ESTIMATE *pEstimate);
+        GMM_VIRTUAL GMM_STATUS GMM_STDCALL              PackResInfoObjects(GMM_RESOURCE_INFO **ppRes, uint32_t Count, const GMM_SUBALLOC_PARAMS *pParams, GMM_SUBALLOC_PLACEMENT *pPlacements, GMM_SUBALLOC_REPORT *pReport);
+        GMM_VIRTUAL uint8_t GMM_STDCALL                 IsSharedResInfo(const GMM_RESOURCE_INFO *pResInfo);
     };
 }
 
@@ -203,6 +236,7 @@ extern "C" {
     GMM_CLIENT_CONTEXT *GMM_STDCALL GmmCreateClientContextForAdapter(GMM_CLIENT ClientType, 
 		                               ADAPTER_BDF sBdf, const void *_pSkuTable);
     void GMM_STDCALL GmmDeleteClientContext(GMM_CLIENT_CONTEXT *pGmmClientContext);
+    GMM_STATUS GMM_STDCALL GmmEstimateResourceSize(GMM_CLIENT_CONTEXT *pGmmClientContext, const GMM_RESCREATE_PARAMS *pCreateParams, GMM_SIZE_ESTIMATE *pEstimate);
 
 #if GMM_LIB_DLL
 #ifdef _WIN32
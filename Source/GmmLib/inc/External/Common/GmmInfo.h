@@ -76,6 +76,8 @@ typedef struct GMM_UMD_CONTEXT_REC
 
 namespace GmmLib
 {
+    class GmmLayoutCache;
+
     class NON_PAGED_SECTION Context : public GmmMemAllocator
     {
     private:
@@ -117,6 +119,10 @@ namespace GmmLib
         uint64_t               InternalGpuVaMax;
         uint32_t               AllowedPaddingFor64KBTileSurf;
 
+        // Bumped on any change to state resource layouts depend on, to invalidate pLayoutCache
+        uint32_t               LayoutGeneration;
+        GmmLayoutCache         *pLayoutCache;
+
 #ifdef GMM_LIB_DLL
         // Mutex Object used for synchronization of ProcessSingleton Context
         static GMM_MUTEX_HANDLE           SingletonContextSyncMutex;
@@ -319,6 +325,38 @@ namespace GmmLib
 	GMM_INLINE void SetAllowedPaddingFor64KBTileSurf(uint32_t Value)
         {
             AllowedPaddingFor64KBTileSurf = Value;
+            BumpLayoutGeneration();
+        }
+
+        /////////////////////////////////////////////////////////////////////////
+        /// Returns the layout generation, which changes whenever context state
+        /// that resource layouts depend on does.
+        /// @return   layout generation
+        /////////////////////////////////////////////////////////////////////////
+        GMM_INLINE uint32_t GetLayoutGeneration()
+        {
+            return (LayoutGeneration);
+        }
+
+        /////////////////////////////////////////////////////////////////////////
+        /// Invalidates layouts memoized against the current context state.
+        /////////////////////////////////////////////////////////////////////////
+        GMM_INLINE void BumpLayoutGeneration()
+        {
+#if defined(_WIN32)
+            InterlockedIncrement((LONG *)&LayoutGeneration);
+#else
+            __sync_fetch_and_add(&LayoutGeneration, 1);
+#endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////
+        /// Returns the resource layout cache, or NULL if there's none.
+        /// @return   layout cache ptr
+        /////////////////////////////////////////////////////////////////////////
+        GMM_INLINE GmmLayoutCache* GetLayoutCache()
+        {
+            return (pLayoutCache);
         }
 
     #ifdef GMM_LIB_DLL
@@ -512,6 +550,7 @@ namespace GmmLib
         GMM_INLINE void SetSkuTable(SKU_FEATURE_TABLE SkuTable)
         {
             this->SkuTable = SkuTable;
+            BumpLayoutGeneration();
         }
 
         /////////////////////////////////////////////////////////////////////////
@@ -521,6 +560,7 @@ namespace GmmLib
         GMM_INLINE void SetWaTable(WA_TABLE WaTable)
         {
             this->WaTable = WaTable;
+            BumpLayoutGeneration();
         }
 
     #if(_DEBUG || _RELEASE_INTERNAL)
@@ -549,6 +589,7 @@ namespace GmmLib
         GMM_INLINE void SetOverridePlatformInfoObj(GMM_PLATFORM_INFO_CLASS *pPlatformInfoObj)
         {
             Override.pPlatformInfo = pPlatformInfoObj;
+            BumpLayoutGeneration();
         }
 
         /////////////////////////////////////////////////////////////////////////
@@ -566,6 +607,7 @@ namespace GmmLib
         GMM_INLINE void SetOverrideTextureCalc(GMM_TEXTURE_CALC *pTextureCalc)
         {
             Override.pTextureCalc = pTextureCalc;
+            BumpLayoutGeneration();
         }
     #endif // (_DEBUG || _RELEASE_INTERNAL)
 
@@ -605,6 +647,7 @@ namespace GmmLib
         GMM_INLINE void SetUsageBasedPaddingFor64KBTileSurf(uint32_t Value)
         {
             UsageBasedPaddingFor64KBTileSurf = Value;
+            BumpLayoutGeneration();
         }
 
         /////////////////////////////////////////////////////////////////////////
@@ -81,6 +81,12 @@ namespace GmmLib
 
         private:
             GMM_STATUS          ApplyExistingSysMemRestrictions();
+            GMM_STATUS          GetCpuBltOffset(GMM_TEXTURE_INFO *pTexInfo, GMM_RES_COPY_BLT *pBlt, GMM_REQ_OFFSET_INFO &ReqInfo);
+            uint8_t             GetCpuBltCachePolicy(GMM_RES_COPY_BLT *pBlt);
+            uint8_t             GetCpuBltCachePolicy(uint8_t CachePolicy, uint64_t TransferBytes);
+            uint8_t             CpuBltInternal(GMM_RES_COPY_BLT *pBlt, const GMM_REQ_OFFSET_INFO *pOffset, CPU_SWIZZLE_BLT_SURFACE *pFill, int FillPeriodBytes, const GMM_RES_COPY_BLT_RECT *pRects, uint32_t NumRects);
+            uint8_t             CpuBltCheck(GMM_RES_COPY_BLT *pBlt, uint32_t *pHash, GMM_RES_CPU_COMPARE *pCompare);
+            static void GMM_STDCALL CpuBltSubresourcesTask(void *pTaskContext, uint32_t TaskIndex);
 
         protected:
             /* Function prototypes */
@@ -121,6 +127,24 @@ namespace GmmLib
                 return TiledMode;
             }
 
+            /////////////////////////////////////////////////////////////////////////////////////
+            /// Returns whether the Override*/Set* mutators may modify this object--i.e. it
+            /// isn't shared between resources by GmmClientContext::EnableSharedLayouts().
+            /// Writes through the GetResFlags() reference can't be caught here.
+            /// @return     1 if mutable, 0 (and asserts) if shared
+            /////////////////////////////////////////////////////////////////////////////////////
+            GMM_INLINE uint8_t IsMutable()
+            {
+#ifndef __GMM_KMD__
+                if(pClientContext && pClientContext->IsSharedResInfo((GMM_RESOURCE_INFO *)this))
+                {
+                    GMM_ASSERTDPF(0, "Shared ResInfo objects are immutable!");
+                    return 0;
+                }
+#endif
+                return 1;
+            }
+
     public:
             /* Constructors */
             GmmResourceInfoCommon():
@@ -186,6 +210,7 @@ namespace GmmLib
             GMM_VIRTUAL GMM_STATUS              GMM_STDCALL Create(Context &GmmLibContext, GMM_RESCREATE_PARAMS &CreateParams);
             GMM_VIRTUAL uint8_t                 GMM_STDCALL ValidateParams();
             GMM_VIRTUAL GMM_STATUS              GMM_STDCALL Create(GMM_RESCREATE_PARAMS &CreateParams);
+            GMM_STATUS                          GMM_STDCALL Create(Context &GmmLibContext, GMM_RESCREATE_PARAMS &CreateParams, uint8_t UseLayoutCache);
             GMM_VIRTUAL void                    GMM_STDCALL GetRestrictions(__GMM_BUFFER_TYPE& Restrictions);
             GMM_VIRTUAL uint32_t                GMM_STDCALL GetPaddedWidth(uint32_t MipLevel);
             GMM_VIRTUAL uint32_t                GMM_STDCALL GetPaddedHeight(uint32_t MipLevel);
@@ -715,6 +740,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL SetMmcMode(GMM_RESOURCE_MMC_INFO Mode, uint32_t ArrayIndex)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 __GMM_ASSERT((Mode == GMM_MMC_DISABLED) || (Mode == GMM_MMC_HORIZONTAL) || (Mode == GMM_MMC_VERTICAL) || (Mode == GMM_MMC_MC) || (Mode == GMM_MMC_RC));
                 
                 __GMM_ASSERT(ArrayIndex < GMM_MAX_MMC_INDEX);
@@ -762,6 +792,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL SetMmcHint(GMM_RESOURCE_MMC_HINT Hint, uint32_t ArrayIndex)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 __GMM_ASSERT(ArrayIndex < GMM_MAX_MMC_INDEX);
                 __GMM_ASSERT(GMM_MMC_HINT_ON == 0);
                 __GMM_ASSERT(GMM_MMC_HINT_OFF == 1);
@@ -968,6 +1003,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL SetPrivateData(void *pNewPrivateData)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 this->pPrivateData = reinterpret_cast<uint64_t>(pNewPrivateData);
             }
 
@@ -1659,6 +1699,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideSize(GMM_GFX_SIZE_T Size)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.Size = Size;
             }
 
@@ -1668,6 +1713,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverridePitch(GMM_GFX_SIZE_T Pitch)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.Pitch = Pitch;
             }
 
@@ -1677,6 +1727,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideUnifiedAuxPitch(GMM_GFX_SIZE_T Pitch)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 __GMM_ASSERT(Surf.Flags.Gpu.UnifiedAuxSurface);
                 AuxSurf.Pitch = Pitch;
             }
@@ -1687,6 +1742,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideAllocationFlags(GMM_RESOURCE_FLAG& Flags)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.Flags = Flags;
             }
 
@@ -1696,6 +1756,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideHAlign(uint32_t HAlign)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.Alignment.HAlign = HAlign;
             }
 
@@ -1705,6 +1770,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideBaseAlignment(uint32_t Alignment)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.Alignment.BaseAlignment = Alignment;
             }
 
@@ -1714,6 +1784,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideBaseWidth(GMM_GFX_SIZE_T BaseWidth)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.BaseWidth = BaseWidth;
             }
 
@@ -1723,6 +1798,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideBaseHeight(uint32_t BaseHeight)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.BaseHeight = BaseHeight;
             }
 
@@ -1732,6 +1812,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideDepth(uint32_t Depth)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.Depth = Depth;
             }
 
@@ -1741,6 +1826,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideTileMode(GMM_TILE_MODE TileMode)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.TileMode = TileMode;
             }
 
@@ -1750,6 +1840,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideUnifiedAuxTileMode(GMM_TILE_MODE TileMode)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 __GMM_ASSERT(Surf.Flags.Gpu.UnifiedAuxSurface);
                 AuxSurf.TileMode = TileMode;
             }
@@ -1760,6 +1855,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideSurfaceFormat(GMM_RESOURCE_FORMAT Format)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.Format = Format;
             }
 
@@ -1769,6 +1869,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideSurfaceType(GMM_RESOURCE_TYPE Type)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.Type = Type;
             }
 
@@ -1778,6 +1883,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideSvmGfxAddress(GMM_GFX_ADDRESS SvmGfxAddress)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 this->SvmAddress = SvmGfxAddress;
             }
 
@@ -1787,6 +1897,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideArraySize(uint32_t ArraySize)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.ArraySize = ArraySize;
             }
 
@@ -1796,6 +1911,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideMaxLod(uint32_t MaxLod)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.MaxLod = MaxLod;
             }
 
@@ -1805,6 +1925,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideCachePolicyUsage(GMM_RESOURCE_USAGE_TYPE Usage)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 Surf.CachePolicy.Usage = Usage;
             }
 
@@ -1816,6 +1941,11 @@ namespace GmmLib
             #if(_DEBUG || _RELEASE_INTERNAL)
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverridePlatform(PLATFORM Platform)
                 {
+                    if(!IsMutable())
+                    {
+                        return;
+                    }
+
                     Surf.Platform = Platform;
                 }
             #endif
@@ -1826,6 +1956,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverrideGmmLibContext(Context *pNewGmmLibContext)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
 #if(defined(__GMM_KMD__))
                 this->pGmmKmdLibContext = reinterpret_cast<uint64_t>(pNewGmmLibContext);
 #else
@@ -1840,6 +1975,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverridePlanarXOffset(GMM_YUV_PLANE Plane, GMM_GFX_SIZE_T XOffset)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 __GMM_ASSERT(Plane < GMM_MAX_PLANE);
                 if (static_cast<uint32_t>(Plane) < GMM_MAX_PLANE)
                 {
@@ -1854,6 +1994,11 @@ namespace GmmLib
             /////////////////////////////////////////////////////////////////////////////////////
             GMM_INLINE_VIRTUAL GMM_INLINE_EXPORTED void GMM_STDCALL OverridePlanarYOffset(GMM_YUV_PLANE Plane, GMM_GFX_SIZE_T YOffset)
             {
+                if(!IsMutable())
+                {
+                    return;
+                }
+
                 __GMM_ASSERT(Plane < GMM_MAX_PLANE);
                 if (static_cast<uint32_t>(Plane) < GMM_MAX_PLANE)
                 {
@@ -2190,6 +2335,22 @@ namespace GmmLib
 	    
 	    GMM_VIRTUAL uint64_t GMM_STDCALL       Get2DFastClearSurfaceWidthFor3DSurface(uint32_t MipLevel);
 	    GMM_VIRTUAL uint64_t GMM_STDCALL       Get2DFastClearSurfaceHeightFor3DSurface(uint32_t MipLevel);
+            GMM_VIRTUAL uint8_t GMM_STDCALL        CpuBltParallel(GMM_RES_COPY_BLT *pBlt, const GMM_TASK_PARALLEL *pParallel);
+            GMM_VIRTUAL uint8_t GMM_STDCALL        CpuBltResource(GMM_RES_COPY_BLT_RESOURCE *pBlt);
+            GMM_VIRTUAL uint8_t GMM_STDCALL        CpuBltStream(GMM_RES_COPY_BLT *pBlt, const GMM_RES_COPY_BLT_STREAM *pStream);
+            GMM_VIRTUAL uint8_t GMM_STDCALL        CpuBltConvert(GMM_RES_COPY_BLT *pBlt, const GMM_RES_COPY_BLT_CONVERT *pConvert);
+            GMM_VIRTUAL uint8_t GMM_STDCALL        CpuFill(GMM_RES_CPU_FILL *pFill);
+            GMM_VIRTUAL uint8_t GMM_STDCALL        CpuBltSubresources(GMM_RES_COPY_BLT_SUBRESOURCES *pBlt);
+            GMM_VIRTUAL GMM_GFX_SIZE_T GMM_STDCALL GetCpuBltSubresourceLayout(GMM_RES_COPY_BLT_SUBRESOURCE *pSubresources, uint32_t *pNumSubresources);
+            GMM_VIRTUAL uint8_t GMM_STDCALL        CpuBltPlanar(GMM_RES_COPY_BLT_PLANAR *pBlt);
+            GMM_VIRTUAL uint8_t GMM_STDCALL        CpuBltRects(GMM_RES_COPY_BLT *pBlt, GMM_RES_COPY_BLT_RECTS *pRects);
+            GMM_VIRTUAL uint8_t GMM_STDCALL        CpuHash(GMM_RES_COPY_BLT *pBlt, uint32_t *pHash);
+            GMM_VIRTUAL uint8_t GMM_STDCALL        CpuCompare(GMM_RES_COPY_BLT *pBlt, GMM_RES_CPU_COMPARE *pCompare);
+            GMM_VIRTUAL GMM_STATUS GMM_STDCALL     CreateOffsetTable(GMM_RES_OFFSET_TABLE **ppTable);
+            GMM_VIRTUAL GMM_STATUS GMM_STDCALL     GetOffsetFromTable(const GMM_RES_OFFSET_TABLE *pTable, GMM_REQ_OFFSET_INFO &ReqInfo);
+            GMM_VIRTUAL void GMM_STDCALL           DestroyOffsetTable(GMM_RES_OFFSET_TABLE *pTable);
+            GMM_VIRTUAL uint32_t GMM_STDCALL       GetAllSubresourceOffsets(const GMM_SUBRESOURCE_RANGE *pRange, GMM_SUBRESOURCE_OFFSET *pOffsets, uint32_t NumOffsets);
+            GMM_VIRTUAL uint32_t GMM_STDCALL       GetMappingSpans(GMM_GET_MAPPING_TYPE Type, GMM_MAPPING_SPAN *pSpans, uint32_t NumSpans);
 		
     };
 
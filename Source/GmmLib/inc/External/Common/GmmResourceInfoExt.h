@@ -497,6 +497,24 @@ typedef enum
     GMM_MAIN_SURF_PHYSICAL,
 } GMM_SIZE_PARAM;
 
+//===========================================================================
+// typedef:
+//        GMM_CPU_BLT_CACHE_POLICY
+//
+// Description:
+//     How a CpuBlt accesses the GPU resource side of the BLT. Streaming
+//     (non-temporal) accesses bypass the CPU caches, so large transfers don't
+//     evict the working set; temporal accesses leave the data cache-resident
+//     for a consumer that reads it again soon. GMM_CPU_BLT_CACHE_AUTO chooses
+//     per call by comparing the transfer size against the LLC size.
+//---------------------------------------------------------------------------
+typedef enum GMM_CPU_BLT_CACHE_POLICY_ENUM
+{
+    GMM_CPU_BLT_CACHE_AUTO = 0,
+    GMM_CPU_BLT_CACHE_STREAMING,
+    GMM_CPU_BLT_CACHE_TEMPORAL,
+} GMM_CPU_BLT_CACHE_POLICY;
+
 //===========================================================================
 // typedef:
 //        GMM_RES_COPY_BLT
@@ -511,7 +529,7 @@ typedef struct GMM_RES_COPY_BLT_REC
         void            *pData;         // Pointer to base of the mapped resource data (e.g. D3DDDICB_LOCK.pData).
         uint32_t           Slice;          // Array/Volume Slice or Cube Face; zero if N/A.
         uint32_t           MipLevel;       // Index of applicable MIP, or zero if N/A.
-        //uint32_t         MsaaSample;     // Index of applicable MSAA sample, or zero if N/A.
+        uint32_t           MsaaSample;     // Index of applicable MSAA sample (first of Blt.MsaaSamples), or zero if N/A.
         uint32_t           OffsetX;        // Pixel offset from left-edge of specified (Slice/MipLevel) subresource.
         uint32_t           OffsetY;        // Pixel row offset from top of specified subresource.
         uint32_t           OffsetSubpixel; // Byte offset into the surface pixel of the applicable subpixel.
@@ -523,7 +541,7 @@ typedef struct GMM_RES_COPY_BLT_REC
         uint32_t           RowPitch;       // Row pitch in bytes of pData surface.
         uint32_t           SlicePitch;     // Slice pitch in bytes of pData surface; ignored if Blt.Slices <= 1.
         uint32_t           PixelPitch;     // Number of bytes from one pData pixel to its horizontal neighbor; 0 = "Same as GPU Resource".
-        //uint32_t         MsaaSamplePitch;// Number of bytes from one pData MSAA sample to the next; ignored if Blt.MsaaSamples <= 1.
+        uint32_t           MsaaSamplePitch;// Number of bytes from one pData MSAA sample to the next; ignored if Blt.MsaaSamples <= 1.
         uint32_t           BufferSize;     // Number of bytes at pData. (Value used only in asserts to catch overuns.)
     }               Sys;                // Description of system memory surface being BLT'ed to/from the GPU surface.
 
@@ -533,11 +551,392 @@ typedef struct GMM_RES_COPY_BLT_REC
         uint32_t           Height;         // Copy height in pixel rows; 0 = "Full Height" of specified subresource.
         uint32_t           Slices;         // Number of slices being copied; 0 = 1 = "N/A or single slice".
         uint32_t           BytesPerPixel;  // Number of bytes to copy, per pixel; 0 = "Same as Sys.PixelPitch".
-        //uint32_t         MsaaSamples;    // Number of samples to copy per pixel; 0 = 1 = "N/A or single sample".
+        uint32_t           MsaaSamples;    // Number of samples to copy per pixel; 0 = 1 = "N/A or single sample".
         uint8_t            Upload;         // true = Sys-->Gpu; false = Gpu-->Sys.
+        uint8_t            CachePolicy;    // GMM_CPU_BLT_CACHE_POLICY hint; 0 = GMM_CPU_BLT_CACHE_AUTO.
+        uint8_t            CachePolicyUsed;// Out: GMM_CPU_BLT_CACHE_STREAMING or _TEMPORAL, as chosen for this BLT.
     }               Blt;                // Description of the BLT being performed.
 } GMM_RES_COPY_BLT;
 
+//===========================================================================
+// typedef:
+//        GMM_TASK_PARALLEL
+//
+// Description:
+//     Describes how GmmLib may spread a call's work across threads--used by
+//     GmmResCpuBltParallel, GMM_RES_COPY_BLT_SUBRESOURCES/_PLANAR BLTs and
+//     GmmClientContext::CreateResInfoObjects. CpuBlt's are split into bands of
+//     whole tile rows, so no two tasks touch the same swizzled cache line, and
+//     the result is bit-exact with GmmResCpuBlt.
+//
+//     When pfnParallelFor is provided, the caller's thread pool runs the
+//     tasks: it must call pfnTask(pTaskContext, i) once for each i in
+//     [0, NumTasks), from any threads, and return only once all have
+//     completed. Otherwise, GmmLib runs them on up to MaxThreads threads
+//     (calling thread included) of its own--workers started on first use and
+//     kept until library unload. A call made while another call is using
+//     those workers (e.g. from a task) runs on its calling thread alone.
+//---------------------------------------------------------------------------
+typedef void (GMM_STDCALL *PFN_GMM_TASK)(void *pTaskContext, uint32_t TaskIndex);
+typedef void (GMM_STDCALL *PFN_GMM_PARALLEL_FOR)(void *pPoolContext, uint32_t NumTasks, PFN_GMM_TASK pfnTask, void *pTaskContext);
+
+typedef struct GMM_TASK_PARALLEL_REC
+{
+    uint32_t                        MaxThreads;         // Upper bound on worker threads; 0 = one per hardware thread.
+    uint32_t                        MinTileRowsPerTask; // CpuBlt's: minimum work per task, in tile rows; 0 = GmmLib chooses.
+    PFN_GMM_PARALLEL_FOR            pfnParallelFor;     // Optional caller-provided pool; NULL = GmmLib-internal threads.
+    void                            *pPoolContext;      // Passed through to pfnParallelFor.
+} GMM_TASK_PARALLEL;
+
+//===========================================================================
+// typedef:
+//        GMM_RES_COPY_BLT_STREAM
+//
+// Description:
+//     Describes a GmmResCpuBltStream session--a GMM_RES_COPY_BLT whose system
+//     memory side is never whole, but passed through the caller's callback in
+//     horizontal bands of whole tile rows (first band ending at the first
+//     tile-row boundary). For uploads, pfnBand produces each band (e.g. by
+//     decoding or reading a file) into pBand; for downloads, it consumes each
+//     band from pBand. With Overlap set, GmmLib swizzles one band on a helper
+//     thread while the callback produces/consumes the next, double-buffering
+//     the bands.
+//
+//     FirstRow/NumRows are pixel rows relative to the BLT rectangle; pBand
+//     holds NumRows (in compression-block rows for compressed formats) at
+//     RowPitch. Callback returns nonzero to continue, or zero to abort the
+//     session (which then returns failure).
+//---------------------------------------------------------------------------
+typedef uint8_t (GMM_STDCALL *PFN_GMM_CPU_BLT_STREAM_BAND)(void *pStreamContext, uint32_t Slice, uint32_t FirstRow, uint32_t NumRows, void *pBand, uint32_t RowPitch);
+
+typedef struct GMM_RES_COPY_BLT_STREAM_REC
+{
+    PFN_GMM_CPU_BLT_STREAM_BAND     pfnBand;            // Band producer (upload) or consumer (download).
+    void                            *pStreamContext;    // Passed through to pfnBand.
+    uint32_t                        BandTileRows;       // Band height in tile rows; 0 = GmmLib chooses.
+    uint8_t                         Overlap;            // true = swizzle on helper thread, concurrently with pfnBand.
+} GMM_RES_COPY_BLT_STREAM;
+
+//===========================================================================
+// typedef:
+//        GMM_RES_COPY_BLT_CONVERT
+//
+// Description:
+//     Describes the system memory format of a GmmResCpuBltConvert, which
+//     converts pixels between SysFormat and the resource's format as part of
+//     the BLT. Supported (SysFormat, resource format) pairs:
+//         B8G8R8A8/X8 <--> R8G8B8A8/X8 (and vice versa; also _SRGB)
+//         R8G8B8      <--> R8G8B8X8/A8 (X/A = 0xff on upload)
+//         D24_UNORM_X8_UINT + R8_UINT plane <--> R24G8_TYPELESS (depth/stencil split)
+//---------------------------------------------------------------------------
+typedef struct GMM_RES_COPY_BLT_CONVERT_REC
+{
+    GMM_RESOURCE_FORMAT     SysFormat;      // Format of GMM_RES_COPY_BLT.Sys.pData pixels.
+    void                    *pData2;        // Second system plane (e.g. stencil of depth/stencil split), else NULL.
+    uint32_t                RowPitch2;      // Row pitch in bytes of pData2.
+    uint32_t                SlicePitch2;    // Slice pitch in bytes of pData2; ignored if Blt.Slices <= 1.
+} GMM_RES_COPY_BLT_CONVERT;
+
+//===========================================================================
+// typedef:
+//        GMM_RES_COPY_BLT_RESOURCE
+//
+// Description:
+//     Describes a GmmResCpuBltResource operation--a CPU copy from one mapped
+//     GPU resource to another, transcoding between their tile layouts (e.g.
+//     TileY to Tile4) without an intermediate linear copy of the surface.
+//     Resources must have the same bits per pixel and compression block
+//     dimensions.
+//---------------------------------------------------------------------------
+typedef struct GMM_RES_COPY_BLT_RESOURCE_REC
+{
+    struct // Source Surface Description...
+    {
+        GMM_RESOURCE_INFO   *pResInfo;      // Source resource.
+        void                *pData;         // Pointer to base of the mapped source resource data.
+        uint32_t            Slice;          // Array/Volume Slice or Cube Face; zero if N/A.
+        uint32_t            MipLevel;       // Index of applicable MIP, or zero if N/A.
+        uint32_t            OffsetX;        // Pixel offset from left-edge of specified (Slice/MipLevel) subresource.
+        uint32_t            OffsetY;        // Pixel row offset from top of specified subresource.
+    }               Src;
+
+    struct // Destination Surface Description (resource GmmResCpuBltResource is called on)...
+    {
+        void                *pData;         // Pointer to base of the mapped destination resource data.
+        uint32_t            Slice;          // Array/Volume Slice or Cube Face; zero if N/A.
+        uint32_t            MipLevel;       // Index of applicable MIP, or zero if N/A.
+        uint32_t            OffsetX;        // Pixel offset from left-edge of specified (Slice/MipLevel) subresource.
+        uint32_t            OffsetY;        // Pixel row offset from top of specified subresource.
+    }               Dst;
+
+    struct // BLT Description...
+    {
+        uint32_t            Width;          // Copy width in pixels; 0 = "Full Width" of specified source subresource.
+        uint32_t            Height;         // Copy height in pixel rows; 0 = "Full Height" of specified source subresource.
+        uint32_t            Slices;         // Number of slices being copied; 0 = 1 = "N/A or single slice".
+        uint8_t             CachePolicy;    // GMM_CPU_BLT_CACHE_POLICY hint for destination writes; 0 = GMM_CPU_BLT_CACHE_AUTO.
+        uint8_t             CachePolicyUsed;// Out: GMM_CPU_BLT_CACHE_STREAMING or _TEMPORAL, as chosen for destination writes.
+    }               Blt;
+} GMM_RES_COPY_BLT_RESOURCE;
+
+//===========================================================================
+// typedef:
+//        GMM_RES_CPU_FILL
+//
+// Description:
+//     Describes a GmmResCpuFill operation--filling a rectangle of a mapped
+//     GPU resource with a single pixel value (clears, poisoning) or a small
+//     repeating pattern tile, written directly into the resource's layout.
+//     Pattern pixels are in the resource's format (compression blocks for
+//     compressed formats); pattern's top-left lands on the rectangle's
+//     top-left, in each slice. MSAA resources have all samples filled.
+//---------------------------------------------------------------------------
+typedef struct GMM_RES_CPU_FILL_REC
+{
+    struct // GPU Surface Description...
+    {
+        void                *pData;         // Pointer to base of the mapped resource data.
+        uint32_t            Slice;          // Array/Volume Slice or Cube Face; zero if N/A.
+        uint32_t            MipLevel;       // Index of applicable MIP, or zero if N/A.
+        uint32_t            OffsetX;        // Pixel offset from left-edge of specified (Slice/MipLevel) subresource.
+        uint32_t            OffsetY;        // Pixel row offset from top of specified subresource.
+    }               Gpu;
+
+    struct // Fill Value or Pattern...
+    {
+        const void          *pData;         // Pixel value (1-16 bytes), or pattern tile.
+        uint32_t            Width;          // Pattern width in pixels; 0 = 1 = single pixel value.
+        uint32_t            Height;         // Pattern height in pixel rows; 0 = 1.
+        uint32_t            RowPitch;       // Row pitch in bytes of pattern; 0 = packed.
+    }               Pattern;
+
+    struct // Fill Description...
+    {
+        uint32_t            Width;          // Fill width in pixels; 0 = "Full Width" of specified subresource.
+        uint32_t            Height;         // Fill height in pixel rows; 0 = "Full Height" of specified subresource.
+        uint32_t            Slices;         // Number of slices being filled; 0 = 1 = "N/A or single slice".
+        uint8_t             CachePolicy;    // GMM_CPU_BLT_CACHE_POLICY hint; 0 = GMM_CPU_BLT_CACHE_AUTO.
+        uint8_t             CachePolicyUsed;// Out: GMM_CPU_BLT_CACHE_STREAMING or _TEMPORAL, as chosen for this fill.
+    }               Fill;
+} GMM_RES_CPU_FILL;
+
+//===========================================================================
+// typedef:
+//        GMM_RES_COPY_BLT_SUBRESOURCE
+//
+// Description:
+//     One entry of a GMM_RES_COPY_BLT_SUBRESOURCES table--where a run of
+//     slices of one MIP lives in the packed system memory image (e.g. as read
+//     from a KTX/DDS file's subresource table). Rows are in compression-block
+//     rows for compressed formats; MSAA samples of a slice follow one another
+//     at RowPitch * rows.
+//---------------------------------------------------------------------------
+typedef struct GMM_RES_COPY_BLT_SUBRESOURCE_REC
+{
+    uint32_t            MipLevel;       // Index of MIP.
+    uint32_t            Slice;          // First Array/Volume Slice or Cube Face; zero if N/A.
+    uint32_t            Slices;         // Number of slices; 0 = 1.
+    uint32_t            RowPitch;       // Row pitch in bytes; 0 = packed rows.
+    uint64_t            SlicePitch;     // Slice pitch in bytes; 0 = packed slices.
+    uint64_t            Offset;         // Byte offset of first slice from Sys.pData.
+} GMM_RES_COPY_BLT_SUBRESOURCE;
+
+//===========================================================================
+// typedef:
+//        GMM_RES_COPY_BLT_SUBRESOURCES
+//
+// Description:
+//     Describes a GmmResCpuBltSubresources operation--a CPU BLT of any set of
+//     whole subresources (e.g. full MIP chain of every array slice) between a
+//     mapped GPU resource and one packed system memory image, in a single
+//     call. Without a table, the image is the one GmmResGetCpuBltSubresourceLayout
+//     describes.
+//---------------------------------------------------------------------------
+typedef struct GMM_RES_COPY_BLT_SUBRESOURCES_REC
+{
+    struct // GPU Surface Description...
+    {
+        void                *pData;         // Pointer to base of the mapped resource data.
+    }               Gpu;
+
+    struct // System Image Description...
+    {
+        void                *pData;         // Pointer to system memory image.
+        uint64_t            BufferSize;     // Number of bytes at pData; table entries must lie within.
+    }               Sys;
+
+    struct // BLT Description...
+    {
+        const GMM_RES_COPY_BLT_SUBRESOURCE  *pSubresources;     // Subresource table; NULL = all subresources, packed.
+        uint32_t                            NumSubresources;    // Entries at pSubresources.
+        const GMM_TASK_PARALLEL     *pParallel;         // Threading controls; NULL = run on calling thread.
+        uint8_t                             Upload;             // true = Sys-->Gpu; false = Gpu-->Sys.
+        uint8_t                             CachePolicy;        // GMM_CPU_BLT_CACHE_POLICY hint; 0 = GMM_CPU_BLT_CACHE_AUTO.
+        uint8_t                             CachePolicyUsed;    // Out: GMM_CPU_BLT_CACHE_STREAMING or _TEMPORAL, as chosen for the whole BLT.
+    }               Blt;
+} GMM_RES_COPY_BLT_SUBRESOURCES;
+
+//===========================================================================
+// typedef:
+//        GMM_RES_COPY_BLT_PLANAR
+//
+// Description:
+//     Describes a GmmResCpuBltPlanar operation--a CPU BLT of a whole frame of
+//     a two-plane, UV-packed YUV resource (NV12, NV21, P010, P012, P016, P208,
+//     P216) to/from separate system memory Y and UV planes, in one call.
+//---------------------------------------------------------------------------
+typedef struct GMM_RES_COPY_BLT_PLANAR_REC
+{
+    struct // GPU Surface Description...
+    {
+        void                *pData;         // Pointer to base of the mapped resource data.
+        uint32_t            Slice;          // Array Slice; zero if N/A.
+    }               Gpu;
+
+    struct // System Planes Description...
+    {
+        void                *pY;            // Pointer to Y plane.
+        void                *pUV;           // Pointer to interleaved chroma plane.
+        uint32_t            YRowPitch;      // Row pitch in bytes of pY; 0 = packed rows.
+        uint32_t            UVRowPitch;     // Row pitch in bytes of pUV; 0 = packed rows.
+    }               Sys;
+
+    struct // BLT Description...
+    {
+        const GMM_TASK_PARALLEL     *pParallel;         // Threading controls; NULL = run on calling thread.
+        uint8_t                             Upload;             // true = Sys-->Gpu; false = Gpu-->Sys.
+        uint8_t                             CachePolicy;        // GMM_CPU_BLT_CACHE_POLICY hint; 0 = GMM_CPU_BLT_CACHE_AUTO.
+        uint8_t                             CachePolicyUsed;    // Out: GMM_CPU_BLT_CACHE_STREAMING or _TEMPORAL, as chosen for the frame.
+    }               Blt;
+} GMM_RES_COPY_BLT_PLANAR;
+
+//===========================================================================
+// typedef:
+//        GMM_RES_COPY_BLT_RECT
+//
+// Description:
+//     One damaged rectangle of a GmmResCpuBltRects, in pixels relative to the
+//     top-left of the GMM_RES_COPY_BLT's rectangle (in both the subresource
+//     and Sys.pData).
+//---------------------------------------------------------------------------
+typedef struct GMM_RES_COPY_BLT_RECT_REC
+{
+    uint32_t            OffsetX;        // Pixel offset from left-edge of BLT rectangle.
+    uint32_t            OffsetY;        // Pixel row offset from top of BLT rectangle.
+    uint32_t            Width;          // Width in pixels.
+    uint32_t            Height;         // Height in pixel rows.
+} GMM_RES_COPY_BLT_RECT;
+
+//===========================================================================
+// typedef:
+//        GMM_RES_COPY_BLT_RECTS
+//
+// Description:
+//     Describes the rectangles of a GmmResCpuBltRects, which BLT's only the
+//     damaged parts of a GMM_RES_COPY_BLT's rectangle, in a single call.
+//     Overlapping and adjacent rectangles are merged where their union is
+//     itself a rectangle. With MayOvercopy, the caller allows pixels outside
+//     the rectangles (but inside the BLT rectangle) to be copied too, so
+//     nearby rectangles are also merged into their bounding box when that
+//     costs little, and edges are widened to the swizzle's cache-line chunks.
+//---------------------------------------------------------------------------
+typedef struct GMM_RES_COPY_BLT_RECTS_REC
+{
+    const GMM_RES_COPY_BLT_RECT *pRects;    // Damaged rectangles; may overlap.
+    uint32_t                    NumRects;   // Entries at pRects.
+    uint8_t                     MayOvercopy;// true = pixels outside pRects may also be copied.
+    uint32_t                    NumBlts;    // Out: rectangles actually BLT'ed, after merging.
+} GMM_RES_COPY_BLT_RECTS;
+
+//===========================================================================
+// typedef:
+//        GMM_RES_CPU_COMPARE
+//
+// Description:
+//     Result of a GmmResCpuCompare, which compares a rectangle of a mapped
+//     resource against a linear reference image without downloading it. The
+//     first difference is reported in row-major order, in pixels relative to
+//     the BLT rectangle (compression-block origin for compressed formats).
+//---------------------------------------------------------------------------
+typedef struct GMM_RES_CPU_COMPARE_REC
+{
+    uint8_t             Match;          // Out: true = rectangle matches reference.
+    uint32_t            Slice;          // Out: Slice of first difference, relative to Gpu.Slice.
+    uint32_t            X;              // Out: Pixel column of first difference.
+    uint32_t            Y;              // Out: Pixel row of first difference.
+} GMM_RES_CPU_COMPARE;
+
+//===========================================================================
+// typedef:
+//        GMM_LAYOUT_CACHE_STATS
+//
+// Description:
+//     Counters of the lib context's resource layout cache, which memoizes
+//     the layouts computed for repeated resource creates with identical
+//     GMM_RESCREATE_PARAMS. Counts are cumulative since context creation.
+//---------------------------------------------------------------------------
+typedef struct GMM_LAYOUT_CACHE_STATS_REC
+{
+    uint8_t             Enabled;        // true = this client's creates consult the cache.
+    uint32_t            Capacity;       // Max layouts held.
+    uint32_t            Entries;        // Layouts currently held.
+    uint64_t            Hits;           // Creates served from the cache.
+    uint64_t            Misses;         // Cacheable creates computed from scratch.
+    uint64_t            Evictions;      // Layouts replaced to make room.
+} GMM_LAYOUT_CACHE_STATS;
+
+//===========================================================================
+// typedef:
+//        GMM_RES_OFFSET_TABLE
+//
+// Description:
+//     Opaque table of a resource's precomputed GmmResGetOffset results for
+//     every (mip, array slice, cube face, depth slice, plane), so offset
+//     queries from surface-state setup become indexed loads. Built for one
+//     resource by GmmResCreateOffsetTable and only valid with that resource.
+//---------------------------------------------------------------------------
+typedef struct GMM_RES_OFFSET_TABLE_REC GMM_RES_OFFSET_TABLE;
+
+//===========================================================================
+// typedef:
+//        GMM_SUBRESOURCE_RANGE
+//
+// Description:
+//     Mips and array elements whose offsets GmmResGetAllSubresourceOffsets
+//     returns. All cube faces, depth slices and planes of each are included.
+//---------------------------------------------------------------------------
+typedef struct GMM_SUBRESOURCE_RANGE_REC
+{
+    uint32_t            FirstMip;
+    uint32_t            NumMips;
+    uint32_t            FirstArray;     // Array element--whole cube map for cube arrays.
+    uint32_t            NumArray;
+} GMM_SUBRESOURCE_RANGE;
+
+//===========================================================================
+// typedef:
+//        GMM_SUBRESOURCE_OFFSET
+//
+// Description:
+//     Render and lock offsets of one subresource, as GmmResGetOffset would
+//     return them in GMM_REQ_OFFSET_INFO.Render/Lock.
+//---------------------------------------------------------------------------
+typedef struct GMM_SUBRESOURCE_OFFSET_REC
+{
+    uint32_t            MipLevel;
+    uint32_t            ArrayIndex;
+    uint32_t            Slice;          // Depth slice of 3D mips, else 0.
+    GMM_CUBE_FACE_ENUM  CubeFace;       // __GMM_NO_CUBE_MAP unless cube map.
+    GMM_YUV_PLANE       Plane;          // GMM_NO_PLANE unless planar.
+
+    GMM_GFX_SIZE_T      RenderOffset;   // Tile-aligned offset for SURFACE_STATE base.
+    uint32_t            RenderXOffset;  // In bytes.
+    uint32_t            RenderYOffset;  // In rows.
+    uint32_t            RenderZOffset;
+    GMM_GFX_SIZE_T      LockOffset;     // Offset for CPU access.
+    uint32_t            LockPitch;
+} GMM_SUBRESOURCE_OFFSET;
+
 //===========================================================================
 // typedef:
 //        GMM_GET_MAPPING
@@ -579,6 +978,130 @@ typedef struct GMM_GET_MAPPING_REC
         GMM_YUV_PLANE Plane, LastPlane;
     }                   Scratch; // Zero on initial call to GmmResGetMappingSpanDesc and then let persist.
 } GMM_GET_MAPPING;
+
+//===========================================================================
+// typedef:
+//        GMM_MAPPING_SPAN
+//
+// Description:
+//     One entry of the span list returned by GmmResGetMappingSpans--a run of
+//     pages at VirtualOffset (in the resource's layout) backed by physical
+//     pages at PhysicalOffset.
+//---------------------------------------------------------------------------
+typedef struct GMM_MAPPING_SPAN_REC
+{
+    GMM_GFX_SIZE_T      VirtualOffset;
+    GMM_GFX_SIZE_T      PhysicalOffset;
+    GMM_GFX_SIZE_T      Size;
+} GMM_MAPPING_SPAN;
+
+//===========================================================================
+// typedef:
+//        GMM_TILE_ADVICE
+//
+// Description:
+//     GmmClientContext::GetTileModeAdvice output--the layout a create would
+//     get under each candidate tile mode, so clients can weigh size against
+//     compression themselves rather than rely on GMM's fixed thresholds.
+//---------------------------------------------------------------------------
+typedef enum GMM_TILE_ADVICE_MODE_ENUM
+{
+    GMM_TILE_ADVICE_LINEAR = 0,
+    GMM_TILE_ADVICE_TILEX,
+    GMM_TILE_ADVICE_TILEY,
+    GMM_TILE_ADVICE_TILEYS,
+    GMM_TILE_ADVICE_TILE4,
+    GMM_TILE_ADVICE_TILE64,
+    GMM_TILE_ADVICE_MODES
+} GMM_TILE_ADVICE_MODE;
+
+typedef struct GMM_TILE_ADVICE_ENTRY_REC
+{
+    uint8_t             Valid;          // Mode applies to the platform and params; rest is 0 otherwise.
+    GMM_GFX_SIZE_T      Size;           // Main surface size.
+    GMM_GFX_SIZE_T      PaddingWaste;   // Size beyond the texel data itself (pitch, alignment and tile padding).
+    GMM_GFX_SIZE_T      AuxSize;        // Unified aux (CCS/HiZ/MCS) size.
+    uint32_t            BaseAlignment;
+    GMM_GFX_SIZE_T      Pitch;
+    uint8_t             Compressible;   // Requested compression survives GMM's waste heuristics.
+    uint8_t             Is64KBPageSuitable;
+} GMM_TILE_ADVICE_ENTRY;
+
+typedef struct GMM_TILE_ADVICE_REC
+{
+    GMM_TILE_ADVICE_MODE    Default;    // Mode GMM picks for the params as given (GMM_TILE_ADVICE_MODES if TileYf/TileW).
+    GMM_TILE_ADVICE_ENTRY   Modes[GMM_TILE_ADVICE_MODES];
+} GMM_TILE_ADVICE;
+
+//===========================================================================
+// typedef:
+//        GMM_SIZE_ESTIMATE
+//
+// Description:
+//     GmmEstimateResourceSize output--the sizes a GMM_RESOURCE_INFO created
+//     with the same params would report.
+//---------------------------------------------------------------------------
+typedef struct GMM_SIZE_ESTIMATE_REC
+{
+    GMM_GFX_SIZE_T      SizeAllocation;     // As GmmResGetSizeAllocation.
+    GMM_GFX_SIZE_T      SizeMainSurface;    // As GmmResGetSizeMainSurface.
+    GMM_GFX_SIZE_T      SizeAuxSurface;     // As GmmResGetSizeAuxSurface(GMM_AUX_SURF).
+    uint32_t            BaseAlignment;
+    uint8_t             Is64KBPageSuitable;
+} GMM_SIZE_ESTIMATE;
+
+//===========================================================================
+// typedef:
+//        GMM_SUBALLOC_PARAMS
+//
+// Description:
+//     GmmClientContext::PackResInfoObjects input--how to pack resources into
+//     suballocation heaps.
+//---------------------------------------------------------------------------
+typedef struct GMM_SUBALLOC_PARAMS_REC
+{
+    GMM_GFX_SIZE_T      HeapSize;           // Size of each heap; larger resources are left standalone.
+    uint8_t             Use64KBPages;       // Place 64KB-page suitable resources on 64KB boundaries.
+} GMM_SUBALLOC_PARAMS;
+
+//===========================================================================
+// typedef:
+//        GMM_SUBALLOC_PLACEMENT
+//
+// Description:
+//     Where PackResInfoObjects placed one resource.
+//---------------------------------------------------------------------------
+#define GMM_SUBALLOC_STANDALONE     0xffffffff
+
+typedef struct GMM_SUBALLOC_PLACEMENT_REC
+{
+    uint32_t            HeapIndex;          // GMM_SUBALLOC_STANDALONE if too large for a heap.
+    GMM_GFX_SIZE_T      Offset;             // Within the heap; 0 if standalone.
+    GMM_GFX_SIZE_T      Size;               // As GmmResGetSizeAllocation.
+    GMM_GFX_SIZE_T      Alignment;          // Offset alignment the resource needs.
+    uint8_t             Compressed;         // Heap holds compressed resources only.
+} GMM_SUBALLOC_PLACEMENT;
+
+//===========================================================================
+// typedef:
+//        GMM_SUBALLOC_REPORT
+//
+// Description:
+//     PackResInfoObjects summary, for judging how well resources packed.
+//---------------------------------------------------------------------------
+typedef struct GMM_SUBALLOC_REPORT_REC
+{
+    uint32_t            NumHeaps;
+    uint32_t            NumStandalone;
+    GMM_GFX_SIZE_T      HeapBytes;          // NumHeaps * HeapSize.
+    GMM_GFX_SIZE_T      UsedBytes;          // Packed resources' sizes.
+    GMM_GFX_SIZE_T      InteriorFreeBytes;  // Free gaps between packed resources (i.e. not heap tails).
+    GMM_GFX_SIZE_T      FreeBytes;          // HeapBytes - UsedBytes: gaps plus heap tails.
+    GMM_GFX_SIZE_T      LargestFreeBlock;
+    uint32_t            FragmentationPct;   // Share of FreeBytes outside LargestFreeBlock.
+    GMM_GFX_SIZE_T      SeparateBytes;      // Packed resources as separate allocations, each rounded up to its alignment.
+    GMM_GFX_SIZE_T      StandaloneBytes;    // Standalone resources' sizes.
+} GMM_SUBALLOC_REPORT;
 //***************************************************************************
 //
 //                      GMM_RESOURCE_INFO API
@@ -598,6 +1121,21 @@ uint8_t             GMM_STDCALL GmmGetLosslessCompressionType(void *pLibContext,
 GMM_RESOURCE_INFO*  GMM_STDCALL GmmResCopy(GMM_RESOURCE_INFO *pGmmResource);
 void                GMM_STDCALL GmmResMemcpy(void *pDst, void *pSrc);
 uint8_t             GMM_STDCALL GmmResCpuBlt(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt);
+uint8_t             GMM_STDCALL GmmResCpuBltParallel(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, const GMM_TASK_PARALLEL *pParallel);
+uint8_t             GMM_STDCALL GmmResCpuBltResource(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT_RESOURCE *pBlt);
+uint8_t             GMM_STDCALL GmmResCpuBltStream(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, const GMM_RES_COPY_BLT_STREAM *pStream);
+uint8_t             GMM_STDCALL GmmResCpuBltConvert(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, const GMM_RES_COPY_BLT_CONVERT *pConvert);
+uint8_t             GMM_STDCALL GmmResCpuFill(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_CPU_FILL *pFill);
+uint8_t             GMM_STDCALL GmmResCpuBltSubresources(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT_SUBRESOURCES *pBlt);
+GMM_GFX_SIZE_T      GMM_STDCALL GmmResGetCpuBltSubresourceLayout(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT_SUBRESOURCE *pSubresources, uint32_t *pNumSubresources);
+uint8_t             GMM_STDCALL GmmResCpuBltPlanar(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT_PLANAR *pBlt);
+uint8_t             GMM_STDCALL GmmResCpuBltRects(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, GMM_RES_COPY_BLT_RECTS *pRects);
+uint8_t             GMM_STDCALL GmmResCpuHash(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, uint32_t *pHash);
+uint8_t             GMM_STDCALL GmmResCpuCompare(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_COPY_BLT *pBlt, GMM_RES_CPU_COMPARE *pCompare);
+GMM_STATUS          GMM_STDCALL GmmResCreateOffsetTable(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_OFFSET_TABLE **ppTable);
+GMM_STATUS          GMM_STDCALL GmmResGetOffsetFromTable(GMM_RESOURCE_INFO *pGmmResource, const GMM_RES_OFFSET_TABLE *pTable, GMM_REQ_OFFSET_INFO *pReqInfo);
+void                GMM_STDCALL GmmResDestroyOffsetTable(GMM_RESOURCE_INFO *pGmmResource, GMM_RES_OFFSET_TABLE *pTable);
+uint32_t            GMM_STDCALL GmmResGetAllSubresourceOffsets(GMM_RESOURCE_INFO *pGmmResource, const GMM_SUBRESOURCE_RANGE *pRange, GMM_SUBRESOURCE_OFFSET *pOffsets, uint32_t NumOffsets);
 GMM_RESOURCE_INFO   *GMM_STDCALL GmmResCreate(GMM_RESCREATE_PARAMS *pCreateParams, GMM_LIB_CONTEXT *pLibContext);
 void                GMM_STDCALL GmmResFree(GMM_RESOURCE_INFO *pGmmResource);
 GMM_GFX_SIZE_T      GMM_STDCALL GmmResGetSizeMainSurface(const GMM_RESOURCE_INFO *pResourceInfo);
@@ -631,6 +1169,7 @@ GMM_GFX_ADDRESS     GMM_STDCALL GmmResGetGfxAddress(GMM_RESOURCE_INFO *pGmmResou
 uint32_t               GMM_STDCALL GmmResGetHAlign(GMM_RESOURCE_INFO *pGmmResource);
 #define                         GmmResGetLockPitch GmmResGetRenderPitch // Support old name until UMDs drop use.
 uint8_t                GMM_STDCALL GmmResGetMappingSpanDesc(GMM_RESOURCE_INFO *pGmmResource, GMM_GET_MAPPING *pMapping);
+uint32_t            GMM_STDCALL GmmResGetMappingSpans(GMM_RESOURCE_INFO *pGmmResource, GMM_GET_MAPPING_TYPE Type, GMM_MAPPING_SPAN *pSpans, uint32_t NumSpans);
 uint32_t            GMM_STDCALL GmmResGetMaxLod(GMM_RESOURCE_INFO *pGmmResource);
 GMM_GFX_SIZE_T      GMM_STDCALL GmmResGetStdLayoutSize(GMM_RESOURCE_INFO *pGmmResource);
 uint32_t               GMM_STDCALL GmmResGetSurfaceStateMipTailStartLod(GMM_RESOURCE_INFO *pGmmResource);
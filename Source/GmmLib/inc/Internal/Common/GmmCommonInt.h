@@ -30,3 +30,8 @@ OTHER DEALINGS IN THE SOFTWARE.
 #define GET_COHERENT_PATINDEX_LOWER_BITS(value) (value & (~(~0 << 5)))
 
 #define GET_COHERENT_PATINDEX_HIGHER_BIT(value) ((value >> 5) & __BIT(0))
+
+// Parallel task runner (GmmTaskRunner.cpp), shared by CpuBlt's and batch resource creation.
+uint32_t GmmTaskMaxThreads(const GMM_TASK_PARALLEL *pParallel);
+void     GmmRunTasks(const GMM_TASK_PARALLEL *pParallel, uint32_t MaxThreads, uint32_t NumTasks, PFN_GMM_TASK pfnTask, void *pTaskContext);
+void     GmmTaskRunnerShutdown();
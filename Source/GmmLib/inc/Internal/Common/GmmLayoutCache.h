@@ -0,0 +1,106 @@
+/*==============================================================================
+Copyright(c) 2017 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and / or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+============================================================================*/
+#pragma once
+
+#if defined(__cplusplus) && !defined(__GMM_KMD__)
+
+#include <atomic>
+#include <mutex>
+
+namespace GmmLib
+{
+    /////////////////////////////////////////////////////////////////////////
+    /// Memoizes the layouts computed by GmmResourceInfoCommon::Create, so
+    /// repeated creates with identical params (e.g. a media pipeline's pool of
+    /// NV12 surfaces) skip CopyClientParams/ValidateParams/AllocateTexture.
+    ///
+    /// Set-associative, with approximate LRU replacement within each set.
+    /// Lookups are lock-free: each entry is guarded by a sequence count (odd
+    /// while being rewritten), readers copy out and then recheck it. Inserts
+    /// are serialized by a mutex. Context state feeding layout is covered by
+    /// the key: SKU/WA tables and padding limits via the Context's layout
+    /// generation, bumped by their setters, and the GtSysInfo tile mask (which
+    /// clients may write in place via GetGtSysInfo()) directly. Only creates
+    /// of clients that opted in via GmmClientContext::SetLayoutCacheEnable()
+    /// use the cache.
+    /////////////////////////////////////////////////////////////////////////
+    class NON_PAGED_SECTION GmmLayoutCache : public GmmMemAllocator
+    {
+    public:
+        /// Everything a Create's layout is a function of.
+        typedef struct KEY_REC
+        {
+            GMM_RESCREATE_PARAMS    Params;         ///< Client params, with per-object fields cleared.
+            uint64_t                Ail;            ///< Client context's GMM_AIL_STRUCT.
+            GMM_CLIENT              ClientType;
+            uint8_t                 TileMask;       ///< GtSysInfo's, which ValidateParams checks against.
+            uint32_t                Generation;     ///< Context::GetLayoutGeneration().
+        } KEY;
+
+        /// Create's output.
+        typedef struct LAYOUT_REC
+        {
+            GMM_RESCREATE_PARAMS    Params;         ///< Params as normalized by CopyClientParams.
+            GMM_TEXTURE_INFO        Surf;
+            GMM_TEXTURE_INFO        AuxSurf;
+            GMM_TEXTURE_INFO        AuxSecSurf;
+            uint32_t                RotateInfo;
+            GMM_MULTI_TILE_ARCH     MultiTileArch;
+        } LAYOUT;
+
+    private:
+        static const uint32_t NumSets = 32;
+        static const uint32_t NumWays = 4;
+
+        typedef struct ENTRY_REC
+        {
+            std::atomic<uint32_t>   Sequence;       // Odd while entry is being rewritten.
+            std::atomic<uint64_t>   Hash;           // 0 = empty.
+            std::atomic<uint64_t>   LastUse;        // Clock at last hit/insert.
+            KEY                     Key;
+            LAYOUT                  Layout;
+        } ENTRY;
+
+        ENTRY                   Entries[NumSets][NumWays];
+        std::atomic<uint64_t>   Clock;
+        std::mutex              InsertMutex;
+
+        std::atomic<uint64_t>   Hits;
+        std::atomic<uint64_t>   Misses;
+        std::atomic<uint64_t>   Evictions;
+
+    public:
+        GmmLayoutCache();
+
+        static uint64_t         HashKey(const KEY &Key);
+
+        static void             MakeKey(Context *pGmmLibContext, GmmClientContext *pClientContext, GMM_CLIENT ClientType, const GMM_RESCREATE_PARAMS &CreateParams, KEY &Key);
+        static uint8_t          IsCacheable(const GMM_RESCREATE_PARAMS &CreateParams);
+
+        uint8_t                 Lookup(const KEY &Key, LAYOUT &Layout);
+        void                    Insert(const KEY &Key, const LAYOUT &Layout);
+        void                    Flush();
+        void                    GetStats(GMM_LAYOUT_CACHE_STATS *pStats);
+    };
+}
+
+#endif // defined(__cplusplus) && !defined(__GMM_KMD__)
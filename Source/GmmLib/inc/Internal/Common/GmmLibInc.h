@@ -63,6 +63,10 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "External/Common/GmmResourceInfo.h"
 #include "External/Common/GmmInfoExt.h"
 #include "External/Common/GmmInfo.h"
+#include "Internal/Common/GmmLayoutCache.h"
+#include "Internal/Common/GmmResInfoPool.h"
+#include "Internal/Common/GmmResInfoBatchSet.h"
+#include "Internal/Common/GmmSharedResInfo.h"
 #include "../Utility/GmmUtility.h"
 #include "External/Common/GmmPageTableMgr.h"
 #include "Internal/Common/GmmCommonInt.h"
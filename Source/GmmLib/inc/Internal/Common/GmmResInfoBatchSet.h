@@ -0,0 +1,120 @@
+/*==============================================================================
+Copyright(c) 2017 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and / or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+============================================================================*/
+#pragma once
+
+#if defined(__cplusplus) && !defined(__GMM_KMD__)
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+namespace GmmLib
+{
+    /////////////////////////////////////////////////////////////////////////
+    /// Blocks of ResInfo Objects allocated by a GmmClientContext's
+    /// CreateResInfoObjects(), so DestroyResInfoObject() can tell a batch
+    /// object (reset, freed with its block) from an individually allocated
+    /// one without marking client-visible resource flags.
+    /////////////////////////////////////////////////////////////////////////
+    class NON_PAGED_SECTION GmmResInfoBatchSet : public GmmMemAllocator
+    {
+    private:
+        std::mutex                      Mutex;
+        std::map<uintptr_t, uintptr_t>  Blocks;     // Block start --> end.
+        std::atomic<uint32_t>           NumBlocks;  // Lets Contains() skip the lock while empty.
+
+    public:
+        GmmResInfoBatchSet()
+            : NumBlocks(0)
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////
+        /// Registers a block.
+        /// @param[in]  pBlock: Block start
+        /// @param[in]  Size: Block size, in bytes
+        /// @return     1 on success, 0 on allocation failure
+        /////////////////////////////////////////////////////////////////////////
+        uint8_t Add(void *pBlock, size_t Size)
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+
+            try
+            {
+                Blocks[reinterpret_cast<uintptr_t>(pBlock)] = reinterpret_cast<uintptr_t>(pBlock) + Size;
+            }
+            catch(...)
+            {
+                return 0;
+            }
+
+            NumBlocks.store(static_cast<uint32_t>(Blocks.size()), std::memory_order_release);
+            return 1;
+        }
+
+        /////////////////////////////////////////////////////////////////////////
+        /// Unregisters a block.
+        /// @param[in]  pBlock: Block start, as passed to Add()
+        /// @return     1 if the block was registered, 0 otherwise
+        /////////////////////////////////////////////////////////////////////////
+        uint8_t Remove(const void *pBlock)
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+
+            if(!Blocks.erase(reinterpret_cast<uintptr_t>(pBlock)))
+            {
+                return 0;
+            }
+
+            NumBlocks.store(static_cast<uint32_t>(Blocks.size()), std::memory_order_release);
+            return 1;
+        }
+
+        /////////////////////////////////////////////////////////////////////////
+        /// Returns whether an object lies in a registered block.
+        /// @param[in]  pObject: Any object pointer
+        /// @return     1 if in a block, 0 otherwise
+        /////////////////////////////////////////////////////////////////////////
+        uint8_t Contains(const void *pObject)
+        {
+            uintptr_t Object = reinterpret_cast<uintptr_t>(pObject);
+
+            if(!NumBlocks.load(std::memory_order_acquire))
+            {
+                return 0;
+            }
+
+            std::lock_guard<std::mutex> Lock(Mutex);
+
+            std::map<uintptr_t, uintptr_t>::iterator It = Blocks.upper_bound(Object);
+            if(It == Blocks.begin())
+            {
+                return 0;
+            }
+            --It;
+
+            return (Object < It->second) ? 1 : 0;
+        }
+    };
+}
+
+#endif // defined(__cplusplus) && !defined(__GMM_KMD__)
@@ -0,0 +1,97 @@
+/*==============================================================================
+Copyright(c) 2017 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and / or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+============================================================================*/
+#pragma once
+
+#if defined(__cplusplus) && !defined(__GMM_KMD__)
+
+#include <atomic>
+#include <mutex>
+
+namespace GmmLib
+{
+    /////////////////////////////////////////////////////////////////////////
+    /// Slab pool of fixed-size objects (GMM_RESOURCE_INFO's), owned by a
+    /// GmmClientContext which opted in via EnableResInfoPool().
+    ///
+    /// Objects are carved from size-aligned slabs, so Owns() is a lookup of
+    /// the pointer's slab in a lock-free hash set--objects not from the pool
+    /// (created before the pool, or once the slab table is full) are simply
+    /// not owned. Freed objects are recycled through free lists sharded by
+    /// thread, each thread using its own shard first and stealing from others
+    /// before growing the pool. All slabs are released in bulk when the pool
+    /// is destroyed, after DestroyAllocated() has destroyed objects the client
+    /// leaked. Live pools are registered process-wide, so an object freed
+    /// through another client context can be routed back to its pool.
+    /////////////////////////////////////////////////////////////////////////
+    class NON_PAGED_SECTION GmmResInfoPool : public GmmMemAllocator
+    {
+    private:
+        static const uint32_t   SlabShift  = 18;            // 256KB slabs.
+        static const size_t     SlabSize   = (size_t)1 << SlabShift;
+        static const uint32_t   NumShards  = 16;
+        static const uint32_t   TableSize  = 8192;          // Slab hash set; at most half used.
+
+        static const uint64_t   FreeMagic  = 0x46524545504f4f4cull; // Marks free slots in place.
+
+        typedef struct FREE_NODE_REC
+        {
+            struct FREE_NODE_REC    *pNext;
+            uint64_t                Magic;                  // FreeMagic while on a free list.
+        } FREE_NODE;
+
+        typedef struct SHARD_REC
+        {
+            std::mutex              Mutex;
+            FREE_NODE               *pFree;
+            uint8_t                 Pad[64];                // Keep shards off each other's cache lines.
+        } SHARD;
+
+        size_t                  ObjectSize;
+        SHARD                   Shards[NumShards];
+        std::mutex              SlabMutex;
+        std::atomic<uintptr_t>  SlabTable[TableSize];
+        uint32_t                NumSlabs;
+        GmmResInfoPool          *pNextPool;                 // Registry link, under RegistryMutex.
+
+        static std::mutex               RegistryMutex;
+        static GmmResInfoPool           *pRegistry;
+        static std::atomic<uint32_t>    NumPools;
+
+        static uint32_t         GetThreadShard();
+        static uint32_t         HashSlab(uintptr_t Slab);
+        FREE_NODE *             AllocateSlab();
+
+    public:
+        GmmResInfoPool(size_t ObjectSize);
+        ~GmmResInfoPool();
+
+        void *                  Allocate();
+        uint8_t                 Owns(const void *pObject);
+        void                    Free(void *pObject);
+        uint32_t                GetNumSlabs();
+        void                    DestroyAllocated(void (*pfnDestroy)(void *pObject));
+
+        static GmmResInfoPool * FindOwner(const void *pObject);
+    };
+}
+
+#endif // defined(__cplusplus) && !defined(__GMM_KMD__)
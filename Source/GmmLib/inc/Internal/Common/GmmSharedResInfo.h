@@ -0,0 +1,70 @@
+/*==============================================================================
+Copyright(c) 2017 Intel Corporation
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files(the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and / or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+============================================================================*/
+#pragma once
+
+#if defined(__cplusplus) && !defined(__GMM_KMD__)
+
+#include <mutex>
+#include <unordered_map>
+
+namespace GmmLib
+{
+    /////////////////////////////////////////////////////////////////////////
+    /// Interning table of immutable, reference-counted ResInfo objects, owned
+    /// by a GmmClientContext which opted in via EnableSharedLayouts().
+    ///
+    /// Creates with identical params (same GmmLayoutCache::KEY) resolve to one
+    /// shared object--so N identical resources cost one object instead of N.
+    /// The object is freed when its last reference is destroyed, and its
+    /// Override*/Set* mutators refuse to modify it while shared.
+    /////////////////////////////////////////////////////////////////////////
+    class NON_PAGED_SECTION GmmSharedResInfo : public GmmMemAllocator
+    {
+    private:
+        typedef struct ENTRY_REC
+        {
+            GmmLayoutCache::KEY     Key;
+            uint64_t                Hash;
+            GMM_RESCREATE_PARAMS    Params;         // Params as normalized by Create.
+            GMM_RESOURCE_INFO       *pRes;
+            uint32_t                RefCount;
+        } ENTRY;
+
+        std::mutex                                              Mutex;
+        std::unordered_multimap<uint64_t, ENTRY *>              ByKey;
+        std::unordered_map<const GMM_RESOURCE_INFO *, ENTRY *>  ByRes;
+
+        ENTRY *                 Find(const GmmLayoutCache::KEY &Key, uint64_t Hash);
+        void                    Remove(ENTRY *pEntry);
+
+    public:
+        ~GmmSharedResInfo();
+
+        GMM_RESOURCE_INFO *     Acquire(const GmmLayoutCache::KEY &Key, GMM_RESCREATE_PARAMS &CreateParams);
+        GMM_RESOURCE_INFO *     Publish(const GmmLayoutCache::KEY &Key, const GMM_RESCREATE_PARAMS &CreateParams, GMM_RESOURCE_INFO *pRes);
+        uint8_t                 Release(const GMM_RESOURCE_INFO *pRes, uint8_t *pLast);
+        uint8_t                 Contains(const GMM_RESOURCE_INFO *pRes);
+        uint32_t                GetNumShared();
+    };
+}
+
+#endif // defined(__cplusplus) && !defined(__GMM_KMD__)